@@ -4,3 +4,10 @@ insmod fpga_buzzer_driver.ko
 insmod fpga_fnd_driver.ko
 insmod fpga_led_driver.ko
 insmod fpga_text_lcd_driver.ko
+# 푸시 스위치 모듈은 미리 빌드해 두지 않았다: example/fpga_push_switch_k6 에서
+# 'make && make install_modules' 로 만들어 이 디렉토리에 복사한다
+if [ -f fpga_push_switch_driver.ko ]; then
+	insmod fpga_push_switch_driver.ko
+else
+	echo "fpga_push_switch_driver.ko not found, build it in example/fpga_push_switch_k6 (make install_modules)"
+fi
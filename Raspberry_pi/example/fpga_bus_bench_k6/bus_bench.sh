@@ -0,0 +1,70 @@
+#!/bin/bash
+# fpga_bus_bench 실행 스크립트
+#
+# 사용법: ./bus_bench.sh [--sim] [--no-reorder] [--iterations N] [--pattern NAME]
+#   --sim          fpga_interface_driver 를 sim=1 로 올린다 (보드 없는 CI 용)
+#   --no-reorder   배치 쓰기를 제출 순서대로 보낸다 (reorder=0, 토글 수 비교용)
+#   --iterations N 패턴마다 반복 수 (기본 10000)
+#   --pattern NAME write | read | sweep_read | sweep_write | dot | lcd | fnd | frame | all (기본 all)
+#
+# 결과 뒤에 /sys/kernel/debug/fpga/bus 의 영역별 핀 토글 수와 배치 요약을 붙인다.
+#
+# fpga_interface_driver.ko 와 fpga_bus_bench.ko 는 스크립트와 같은 디렉토리나
+# 각자의 빌드 디렉토리에서 찾는다. 디스플레이 드라이버가 올라가 있으면
+# 인터페이스 드라이버를 다시 올릴 수 없으므로 먼저 내린다.
+
+SIM=0
+REORDER=1
+ITERATIONS=10000
+PATTERN=all
+HERE=$(cd "$(dirname "$0")" && pwd)
+DEBUGFS=/sys/kernel/debug/fpga_bus_bench
+
+while [ $# -gt 0 ]; do
+    case "$1" in
+    --sim) SIM=1 ;;
+    --no-reorder) REORDER=0 ;;
+    --iterations) ITERATIONS=$2; shift ;;
+    --pattern) PATTERN=$2; shift ;;
+    *) echo "<Usage> $0 [--sim] [--no-reorder] [--iterations N] [--pattern NAME]"; exit 1 ;;
+    esac
+    shift
+done
+
+find_ko() {
+    for dir in "$HERE" "$HERE/../fpga_interface_driver_k6"; do
+        [ -f "$dir/$1" ] && { echo "$dir/$1"; return; }
+    done
+}
+
+INTERFACE_KO=$(find_ko fpga_interface_driver.ko)
+BENCH_KO=$(find_ko fpga_bus_bench.ko)
+[ -n "$INTERFACE_KO" ] && [ -n "$BENCH_KO" ] || { echo "❌ fpga_interface_driver.ko / fpga_bus_bench.ko not found"; exit 1; }
+
+mountpoint -q /sys/kernel/debug || mount -t debugfs none /sys/kernel/debug
+
+rmmod fpga_bus_bench 2>/dev/null
+rmmod fpga_interface_driver 2>/dev/null
+if lsmod | grep -q '^fpga_interface_driver'; then
+    echo "❌ fpga_interface_driver is in use, unload the display drivers first"
+    exit 1
+fi
+
+# 트랜잭션마다 찍는 로그를 끄지 않으면 printk 시간을 재게 된다
+insmod "$INTERFACE_KO" sim=$SIM verbose=0 reorder=$REORDER || { echo "❌ Failed to insert fpga_interface_driver.ko"; exit 1; }
+insmod "$BENCH_KO" || { echo "❌ Failed to insert fpga_bus_bench.ko"; rmmod fpga_interface_driver; exit 1; }
+
+echo "$ITERATIONS" > $DEBUGFS/iterations
+if echo "$PATTERN" > $DEBUGFS/run; then
+    cat $DEBUGFS/results
+    echo
+    cat /sys/kernel/debug/fpga/bus
+    STATUS=0
+else
+    echo "❌ Unknown pattern: $PATTERN"
+    STATUS=1
+fi
+
+rmmod fpga_bus_bench
+rmmod fpga_interface_driver
+exit $STATUS
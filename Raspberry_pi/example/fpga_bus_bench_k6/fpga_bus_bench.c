@@ -0,0 +1,360 @@
+/*
+ * FPGA Bus Transaction Microbenchmark for Linux Kernel 6.x
+ *
+ * Measures iom_fpga_itf_write()/iom_fpga_itf_read() from inside the kernel,
+ * so the numbers contain only the interface driver and the bus, not the
+ * syscall and copy_from_user path of the device drivers. It runs on
+ * whatever backend fpga_interface_driver was loaded with: the GPIO bus, or
+ * the in-memory register file with sim=1 (usable in CI without the board).
+ *
+ * Control files under /sys/kernel/debug/fpga_bus_bench/:
+ *   iterations : operations per pattern (default 10000)
+ *   run        : echo <pattern|all> > run, runs synchronously
+ *   results    : ns/transaction, transactions/s, percentiles and a latency
+ *                histogram for every pattern of the last run
+ *
+ * Patterns (one "operation" is one timed unit):
+ *   write       : one write to the LED register
+ *   read        : one read of the DIP switch register
+ *   sweep_read  : reads across the whole 11-bit address space
+ *   sweep_write : writes across every display register (LED, FND, DOT, LCD)
+ *   dot         : one dot matrix frame, 10 writes like fpga_dot_driver
+ *   lcd         : one text LCD screen, 32 writes like fpga_text_lcd_driver
+ *   fnd         : one FND number, 2 writes like fpga_fnd_driver
+ *   frame       : dot + LCD + FND + LED of one update as a single
+ *                 iom_fpga_itf_write_batch(); compare the toggle counts in
+ *                 /sys/kernel/debug/fpga/bus with reorder=1 and reorder=0
+ *
+ * Every operation is timed with ktime_get_ns(); the clock overhead is
+ * reported so it can be told apart from the transaction cost. Load the
+ * interface driver with verbose=0, otherwise pr_info() dominates, and keep
+ * the display applications closed while measuring: their writes would
+ * queue on the bus lock between the patterns, and the patterns overwrite
+ * what the devices show.
+ */
+#include <linux/module.h>
+#include <linux/kernel.h>
+#include <linux/debugfs.h>
+#include <linux/fs.h>
+#include <linux/ktime.h>
+#include <linux/log2.h>
+#include <linux/mutex.h>
+#include <linux/sched.h>
+#include <linux/seq_file.h>
+#include <linux/string.h>
+#include <linux/uaccess.h>
+
+#include "../fpga_interface_driver_k6/fpga_interface.h"
+
+#define BENCH_NAME "fpga_bus_bench"
+
+/* 디바이스 드라이버들이 쓰는 FPGA 물리 주소 */
+#define IOM_DIP_SWITCH_ADDRESS 0x000
+#define IOM_FND1_ADDRESS 0x003
+#define IOM_FND2_ADDRESS 0x004
+#define IOM_LED_ADDRESS 0x016
+#define IOM_FPGA_TEXT_LCD_ADDRESS 0x090
+#define IOM_FPGA_DOT_ADDRESS 0x210
+
+#define FPGA_ADDRESS_SPACE (1 << 11)
+#define TEXT_LCD_SIZE 32
+#define DOT_ROWS 10
+
+#define MAX_ITERATIONS 10000000
+
+/* 히스토그램: 2 배 구간마다 4 칸 (구간 안에서 최대 25% 오차), 약 130ms 까지 */
+#define HIST_SUB_BITS 2
+#define HIST_SUB (1 << HIST_SUB_BITS)
+#define HIST_BUCKETS (26 * HIST_SUB)
+
+enum bench_pattern {
+    PATTERN_WRITE,
+    PATTERN_READ,
+    PATTERN_SWEEP_READ,
+    PATTERN_SWEEP_WRITE,
+    PATTERN_DOT,
+    PATTERN_LCD,
+    PATTERN_FND,
+    PATTERN_FRAME,
+    PATTERN_COUNT,
+};
+
+static const char *const pattern_names[PATTERN_COUNT] = {
+    "write", "read", "sweep_read", "sweep_write", "dot", "lcd", "fnd", "frame",
+};
+
+#define FRAME_WRITES (DOT_ROWS + TEXT_LCD_SIZE + 2 + 1)
+
+/* 패턴 하나의 결과 */
+struct bench_result {
+    bool valid;
+    u32 ops;
+    u32 tx_per_op;
+    u64 total_ns;  // 반복 전체의 벽시계 시간
+    u64 max_ns;
+    u32 hist[HIST_BUCKETS];
+};
+
+/* display 드라이버들이 쓰는 레지스터만 쓰기 sweep 대상으로 한다 (스텝 모터 등은 건드리지 않는다) */
+static unsigned int display_addresses[2 + 1 + TEXT_LCD_SIZE + DOT_ROWS];
+
+static u32 iterations = 10000;
+static u64 clock_ns;  // ktime_get_ns() 한 번의 비용
+static struct bench_result results[PATTERN_COUNT];
+static DEFINE_MUTEX(bench_lock);
+static struct dentry *bench_dir;
+
+static unsigned int hist_bucket(u64 ns)
+{
+    unsigned int octave, idx;
+
+    if (ns < HIST_SUB)
+        return ns;
+    octave = ilog2(ns);
+    idx = (octave - HIST_SUB_BITS + 1) * HIST_SUB + ((ns >> (octave - HIST_SUB_BITS)) & (HIST_SUB - 1));
+    return min_t(unsigned int, idx, HIST_BUCKETS - 1);
+}
+
+// 칸 idx 의 하한 (ns)
+static u64 hist_lower(unsigned int idx)
+{
+    unsigned int octave;
+
+    if (idx < HIST_SUB)
+        return idx;
+    octave = idx / HIST_SUB + HIST_SUB_BITS - 1;
+    return (u64)(HIST_SUB + idx % HIST_SUB) << (octave - HIST_SUB_BITS);
+}
+
+// 칸 단위 백분위수, 그 칸의 상한을 돌려준다
+static u64 hist_percentile(const struct bench_result *r, unsigned int pct)
+{
+    u64 rank = div_u64((u64)r->ops * pct + 99, 100);
+    u64 seen = 0;
+    unsigned int i;
+
+    for (i = 0; i < HIST_BUCKETS; i++) {
+        seen += r->hist[i];
+        if (seen >= rank && seen)
+            return i + 1 < HIST_BUCKETS ? hist_lower(i + 1) : r->max_ns;
+    }
+    return r->max_ns;
+}
+
+/* 연산 하나: 돌려주는 값은 그 연산의 버스 트랜잭션 수 */
+static unsigned int bench_op(enum bench_pattern pattern, u32 n)
+{
+    static struct fpga_bus_write frame[FRAME_WRITES];
+    unsigned int i, k;
+    unsigned char v = n;
+
+    switch (pattern) {
+    case PATTERN_WRITE:
+        iom_fpga_itf_write(IOM_LED_ADDRESS, v);
+        return 1;
+    case PATTERN_READ:
+        iom_fpga_itf_read(IOM_DIP_SWITCH_ADDRESS);
+        return 1;
+    case PATTERN_SWEEP_READ:
+        iom_fpga_itf_read(n % FPGA_ADDRESS_SPACE);
+        return 1;
+    case PATTERN_SWEEP_WRITE:
+        iom_fpga_itf_write(display_addresses[n % ARRAY_SIZE(display_addresses)], v);
+        return 1;
+    case PATTERN_DOT:
+        // 매 프레임 값이 바뀌도록 행마다 다른 패턴을 쓴다
+        for (i = 0; i < DOT_ROWS; i++)
+            iom_fpga_itf_write(IOM_FPGA_DOT_ADDRESS + i, (v + i * 0x15) & 0x7F);
+        return DOT_ROWS;
+    case PATTERN_LCD:
+        for (i = 0; i < TEXT_LCD_SIZE; i++)
+            iom_fpga_itf_write(IOM_FPGA_TEXT_LCD_ADDRESS + i, 'A' + (n + i) % 26);
+        return TEXT_LCD_SIZE;
+    case PATTERN_FND:
+        iom_fpga_itf_write(IOM_FND1_ADDRESS, ((n / 1000 % 10) << 4) | (n / 100 % 10));
+        iom_fpga_itf_write(IOM_FND2_ADDRESS, ((n / 10 % 10) << 4) | (n % 10));
+        return 2;
+    case PATTERN_FRAME:
+        // 디바이스 순서대로 쌓는다, 섞는 것은 인터페이스 드라이버가 한다
+        k = 0;
+        for (i = 0; i < DOT_ROWS; i++, k++) {
+            frame[k].addr = IOM_FPGA_DOT_ADDRESS + i;
+            frame[k].value = (v + i * 0x15) & 0x7F;
+        }
+        for (i = 0; i < TEXT_LCD_SIZE; i++, k++) {
+            frame[k].addr = IOM_FPGA_TEXT_LCD_ADDRESS + i;
+            frame[k].value = 'A' + (n + i) % 26;
+        }
+        frame[k].addr = IOM_FND1_ADDRESS;
+        frame[k++].value = ((n / 1000 % 10) << 4) | (n / 100 % 10);
+        frame[k].addr = IOM_FND2_ADDRESS;
+        frame[k++].value = ((n / 10 % 10) << 4) | (n % 10);
+        frame[k].addr = IOM_LED_ADDRESS;
+        frame[k++].value = v;
+        iom_fpga_itf_write_batch(frame, k);
+        return k;
+    default:
+        return 0;
+    }
+}
+
+static void bench_run(enum bench_pattern pattern, u32 ops)
+{
+    struct bench_result *r = &results[pattern];
+    u64 start, t0, t1;
+    u32 n;
+
+    memset(r, 0, sizeof(*r));
+    r->ops = ops;
+
+    start = ktime_get_ns();
+    for (n = 0; n < ops; n++) {
+        t0 = ktime_get_ns();
+        r->tx_per_op = bench_op(pattern, n);
+        t1 = ktime_get_ns();
+
+        r->hist[hist_bucket(t1 - t0)]++;
+        r->max_ns = max(r->max_ns, t1 - t0);
+        // GPIO 백엔드는 트랜잭션마다 udelay 가 있어 오래 걸린다, 중간중간 양보한다
+        if ((n & 255) == 255)
+            cond_resched();
+    }
+    r->total_ns = ktime_get_ns() - start;
+    r->valid = true;
+}
+
+static void bench_measure_clock(void)
+{
+    u64 start = ktime_get_ns();
+    unsigned int i;
+
+    for (i = 0; i < 1000; i++)
+        (void)ktime_get_ns();
+    clock_ns = div_u64(ktime_get_ns() - start, 1000);
+}
+
+/* ---------------------------------------------------------------------- */
+
+static ssize_t bench_run_write(struct file *file, const char __user *buf, size_t len, loff_t *off)
+{
+    char name[32], *pattern;
+    int i, ran = 0;
+
+    if (len == 0 || len >= sizeof(name))
+        return -EINVAL;
+    if (copy_from_user(name, buf, len))
+        return -EFAULT;
+    name[len] = '\0';
+    pattern = strim(name);
+
+    if (iterations == 0 || iterations > MAX_ITERATIONS)
+        return -EINVAL;
+
+    mutex_lock(&bench_lock);
+    bench_measure_clock();
+    for (i = 0; i < PATTERN_COUNT; i++) {
+        if (strcmp(pattern, "all") == 0 || strcmp(pattern, pattern_names[i]) == 0) {
+            bench_run(i, iterations);
+            ran++;
+        }
+    }
+    mutex_unlock(&bench_lock);
+
+    return ran ? len : -EINVAL;
+}
+
+static const struct file_operations bench_run_fops = {
+    .owner = THIS_MODULE,
+    .open  = simple_open,
+    .write = bench_run_write,
+};
+
+static int results_show(struct seq_file *m, void *v)
+{
+    const struct bench_result *r;
+    u64 hist_max, ns_per_tx, tx;
+    unsigned int i, j;
+    int p;
+
+    mutex_lock(&bench_lock);
+    seq_printf(m, "backend %s, ktime_get_ns %llu ns (included in per-op times)\n",
+               iom_fpga_itf_sim() ? "sim" : "gpio", clock_ns);
+    seq_printf(m, "%-12s %8s %5s %10s %12s %10s %10s %10s %10s\n",
+               "pattern", "ops", "tx/op", "ns/tx", "tx/s", "ns/op", "p50_ns", "p99_ns", "max_ns");
+
+    for (p = 0; p < PATTERN_COUNT; p++) {
+        r = &results[p];
+        if (!r->valid)
+            continue;
+        tx = (u64)r->ops * r->tx_per_op;
+        ns_per_tx = tx ? div64_u64(r->total_ns, tx) : 0;
+        seq_printf(m, "%-12s %8u %5u %10llu %12llu %10llu %10llu %10llu %10llu\n",
+                   pattern_names[p], r->ops, r->tx_per_op, ns_per_tx,
+                   r->total_ns ? div64_u64(tx * NSEC_PER_SEC, r->total_ns) : 0,
+                   div_u64(r->total_ns, r->ops), hist_percentile(r, 50), hist_percentile(r, 99), r->max_ns);
+    }
+
+    // 패턴마다 0 이 아닌 칸만 막대로 보여 준다
+    for (p = 0; p < PATTERN_COUNT; p++) {
+        r = &results[p];
+        if (!r->valid)
+            continue;
+
+        hist_max = 1;
+        for (i = 0; i < HIST_BUCKETS; i++)
+            hist_max = max_t(u64, hist_max, r->hist[i]);
+
+        seq_printf(m, "\n%s: ns per op\n", pattern_names[p]);
+        for (i = 0; i < HIST_BUCKETS; i++) {
+            if (!r->hist[i])
+                continue;
+            seq_printf(m, "  %10llu - %-10llu %9u ", hist_lower(i),
+                       i + 1 < HIST_BUCKETS ? hist_lower(i + 1) : r->max_ns, r->hist[i]);
+            for (j = 0; j < div64_u64((u64)r->hist[i] * 40 + hist_max - 1, hist_max); j++)
+                seq_putc(m, '#');
+            seq_putc(m, '\n');
+        }
+    }
+    mutex_unlock(&bench_lock);
+    return 0;
+}
+DEFINE_SHOW_ATTRIBUTE(results);
+
+// 모듈 초기화 함수
+static int __init fpga_bus_bench_init(void)
+{
+    unsigned int i, n = 0;
+
+    display_addresses[n++] = IOM_FND1_ADDRESS;
+    display_addresses[n++] = IOM_FND2_ADDRESS;
+    display_addresses[n++] = IOM_LED_ADDRESS;
+    for (i = 0; i < TEXT_LCD_SIZE; i++)
+        display_addresses[n++] = IOM_FPGA_TEXT_LCD_ADDRESS + i;
+    for (i = 0; i < DOT_ROWS; i++)
+        display_addresses[n++] = IOM_FPGA_DOT_ADDRESS + i;
+
+    bench_dir = debugfs_create_dir(BENCH_NAME, NULL);
+    if (IS_ERR(bench_dir))
+        return PTR_ERR(bench_dir);
+
+    debugfs_create_u32("iterations", 0644, bench_dir, &iterations);
+    debugfs_create_file("run", 0200, bench_dir, NULL, &bench_run_fops);
+    debugfs_create_file("results", 0444, bench_dir, NULL, &results_fops);
+
+    pr_info("init module, %s (%s backend)\n", BENCH_NAME, iom_fpga_itf_sim() ? "sim" : "gpio");
+    return 0;
+}
+
+// 모듈 종료 함수
+static void __exit fpga_bus_bench_exit(void)
+{
+    debugfs_remove_recursive(bench_dir);
+    pr_info("exit module, %s\n", BENCH_NAME);
+}
+
+module_init(fpga_bus_bench_init);
+module_exit(fpga_bus_bench_exit);
+
+MODULE_LICENSE("GPL");
+MODULE_AUTHOR("Your Name");
+MODULE_DESCRIPTION("FPGA bus transaction microbenchmark");
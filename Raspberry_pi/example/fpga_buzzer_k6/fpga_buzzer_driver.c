@@ -12,22 +12,16 @@
 #include <linux/fs.h>
 #include <linux/uaccess.h> // For copy_from_user/copy_to_user
 
+// 버스 접근/통계 함수 ('fpga_interface_driver.ko' 를 먼저 insmod 해야 합니다)
+#include "../fpga_interface_driver_k6/fpga_interface.h"
+
 #define IOM_BUZZER_MAJOR 264
 #define IOM_BUZZER_NAME "fpga_buzzer"
 
 #define IOM_BUZZER_ADDRESS 0x070 // Buzzer의 물리 주소
 
-/*
- * 이 함수들은 'fpga_interface_driver.ko' 모듈에 의해 제공됩니다.
- * 'extern'은 컴파일러에게 이 함수들이 다른 곳에 정의되어 있음을 알리고,
- * 모듈이 로드될 때 커널이 이들을 연결해 줍니다.
- * 중요: 이 드라이버를 insmod 하기 전에 반드시 fpga_interface_driver.ko를 먼저 로드해야 합니다.
- */
-extern unsigned char iom_fpga_itf_read(unsigned int addr);
-extern ssize_t iom_fpga_itf_write(unsigned int addr, unsigned char value);
-
-// 여러 프로그램이 동시에 접근하는 것을 막기 위한 전역 변수
-static int buzzer_port_usage = 0;
+// /sys/kernel/fpga/devices/buzzer 카운터
+static struct fpga_dev_stats *buzzer_stats;
 
 /* 함수 프로토타입 선언 */
 static int iom_buzzer_open(struct inode *inode, struct file *file);
@@ -42,22 +36,27 @@ static const struct file_operations iom_buzzer_fops = {
     .write   = iom_buzzer_write,
     .read    = iom_buzzer_read,
     .release = iom_buzzer_release,
+    .unlocked_ioctl = fpga_cmd_ioctl,
+    .compat_ioctl = compat_ptr_ioctl,
+    .uring_cmd = fpga_cmd_uring_cmd,
 };
 
 // /dev/fpga_buzzer 장치 파일을 열 때 호출되는 함수
 static int iom_buzzer_open(struct inode *inode, struct file *file)
 {
-    if (buzzer_port_usage != 0)
+    if (fpga_cmd_claim(FPGA_CMD_BUZZER)) {
+        fpga_dev_stats_inc(buzzer_stats, FPGA_DEV_BUSY);
         return -EBUSY; // 이미 사용 중이면 오류 반환
+    }
 
-    buzzer_port_usage = 1;
+    fpga_dev_stats_inc(buzzer_stats, FPGA_DEV_OPENS);
     return 0;
 }
 
 // /dev/fpga_buzzer 장치 파일을 닫을 때 호출되는 함수
 static int iom_buzzer_release(struct inode *inode, struct file *file)
 {
-    buzzer_port_usage = 0;
+    fpga_cmd_unclaim(FPGA_CMD_BUZZER);
     return 0;
 }
 
@@ -65,12 +64,19 @@ static int iom_buzzer_release(struct inode *inode, struct file *file)
 static ssize_t iom_buzzer_write(struct file *file, const char __user *buf, size_t len, loff_t *off)
 {
     unsigned char value;
+    u64 start;
 
     if (copy_from_user(&value, buf, 1)) {
+        fpga_dev_stats_inc(buzzer_stats, FPGA_DEV_FAULTS);
         return -EFAULT;
     }
 
+    start = trace_fpga_dev_write_enabled() ? ktime_get_ns() : 0;
     iom_fpga_itf_write((unsigned int)IOM_BUZZER_ADDRESS, value);
+    trace_fpga_dev_write("buzzer", *off, 1, start);
+    fpga_dev_stats_inc(buzzer_stats, FPGA_DEV_WRITES);
+    if (len != 1)
+        fpga_dev_stats_inc(buzzer_stats, FPGA_DEV_SHORT_WRITES);
     return 1;
 }
 
@@ -80,14 +86,26 @@ static ssize_t iom_buzzer_read(struct file *file, char __user *buf, size_t len,
     unsigned char value;
 
     value = iom_fpga_itf_read((unsigned int)IOM_BUZZER_ADDRESS);
+    fpga_dev_stats_inc(buzzer_stats, FPGA_DEV_READS);
 
     if (copy_to_user(buf, &value, 1)) {
+        fpga_dev_stats_inc(buzzer_stats, FPGA_DEV_FAULTS);
         return -EFAULT;
     }
 
     return 1;
 }
 
+// FPGA_IOC_SUBMIT 명령 하나를 버스 쓰기로 바꾼다 (write() 와 같은 1 바이트)
+static int iom_buzzer_encode(const struct fpga_cmd *cmd, struct fpga_bus_write *tx)
+{
+    if (cmd->len != 1)
+        return -EINVAL;
+    tx[0].addr = IOM_BUZZER_ADDRESS;
+    tx[0].value = cmd->data[0];
+    return 1;
+}
+
 // 모듈이 커널에 로드될 때 호출되는 초기화 함수
 static int __init iom_buzzer_init(void)
 {
@@ -100,12 +118,17 @@ static int __init iom_buzzer_init(void)
     }
 
     pr_info("init module, %s major number : %d\n", IOM_BUZZER_NAME, IOM_BUZZER_MAJOR);
+    buzzer_stats = fpga_dev_stats_register("buzzer");
+    if (fpga_cmd_register(FPGA_CMD_BUZZER, iom_buzzer_encode, buzzer_stats))
+        pr_warn("%s: FPGA_IOC_SUBMIT is not available\n", IOM_BUZZER_NAME);
     return 0;
 }
 
 // 모듈이 커널에서 제거될 때 호출되는 종료 함수
 static void __exit iom_buzzer_exit(void)
 {
+    fpga_cmd_unregister(FPGA_CMD_BUZZER);
+    fpga_dev_stats_unregister(buzzer_stats);
     unregister_chrdev(IOM_BUZZER_MAJOR, IOM_BUZZER_NAME);
     pr_info("exit module, %s\n", IOM_BUZZER_NAME);
 }
@@ -0,0 +1,46 @@
+/* FPGA Buzzer Test Application
+File : fpga_test_buzzer.cpp*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <signal.h>
+
+#include "fpga.hpp"
+
+static volatile sig_atomic_t quit = 0;
+
+static void user_signal1(int sig)
+{
+	(void)sig;
+	quit = 1;
+}
+
+int main(void)
+{
+	bool state=false;
+
+	fpga::Buzzer buzzer = fpga::Buzzer::open();
+	if (!buzzer.ok()) {
+		printf("Device open error : %s\n",fpga::kBuzzerDevice);
+		exit(1);
+	}
+
+	(void)signal(SIGINT, user_signal1);
+
+	printf("Press <ctrl+c> to exit.\n");
+
+	// 3초마다 부저를 켜고 끈다 (처음에는 끈 상태로 시작)
+	while(!quit) {
+		if(buzzer.set(state)<0) {
+			printf("Write Error!\n");
+			return -1;
+		}
+		state=!state;
+		sleep(3);
+	}
+
+	printf("Current Buzzer Value : 0x%x\n",!state);
+
+	return(0);
+}
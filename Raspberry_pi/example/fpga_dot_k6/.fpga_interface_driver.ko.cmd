@@ -1 +0,0 @@
-savedcmd_/home/kjh/example/fpga_dot_k6/fpga_interface_driver.ko := aarch64-linux-gnu-ld -r -EL  -maarch64elf -z noexecstack --no-warn-rwx-segments --build-id=sha1  -T arch/arm64/module.lds -o /home/kjh/example/fpga_dot_k6/fpga_interface_driver.ko /home/kjh/example/fpga_dot_k6/fpga_interface_driver.o /home/kjh/example/fpga_dot_k6/fpga_interface_driver.mod.o /home/kjh/example/fpga_dot_k6/.module-common.o
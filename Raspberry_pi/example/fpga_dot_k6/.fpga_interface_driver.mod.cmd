@@ -1 +0,0 @@
-savedcmd_/home/kjh/example/fpga_dot_k6/fpga_interface_driver.mod := printf '%s\n'   fpga_interface_driver.o | awk '!x[$$0]++ { print("/home/kjh/example/fpga_dot_k6/"$$0) }' > /home/kjh/example/fpga_dot_k6/fpga_interface_driver.mod
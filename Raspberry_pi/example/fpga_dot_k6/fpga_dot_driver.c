@@ -5,37 +5,195 @@
  * dot matrix display. It relies on the 'fpga_interface_driver' for the
  * actual low-level hardware access.
  *
+ * Besides raw row bytes the driver renders text (FPGA_IOC_DOT_MODE, see
+ * fpga_ioctl.h). It keeps a glyph cache of all 256 character codes: the
+ * printable ASCII characters are built in (5x7 letters, the 10 row digits
+ * of libfpga fpga_font.hpp kDotDigits) and any code can be replaced with
+ * FPGA_IOC_DOT_GLYPH. Every glyph is cached both as row bytes and as
+ * columns, so showing a character copies its rows into the frame buffer
+ * and a scrolling step shifts the frame by one column and inserts one
+ * cached column instead of rendering the whole string again. After either
+ * only the rows that differ from the last write are put on the bus, as one
+ * batch. Batches sent with FPGA_IOC_SUBMIT or scenes bypass the frame
+ * buffer; selecting a mode writes all rows again on the next update.
+ *
  * Updated for modern kernel conventions and stability.
  */
 #include <linux/module.h>
 #include <linux/kernel.h>
 #include <linux/fs.h>
+#include <linux/mutex.h>
+#include <linux/workqueue.h>
 #include <linux/uaccess.h> // For copy_from_user
 
-// The font data is expected to be in the same directory.
-// 이 파일은 컴파일 시 같은 디렉토리에 있어야 합니다.
-#include "fpga_dot_font.h"
+// 버스 접근/통계 함수 ('fpga_interface_driver.ko' 를 먼저 insmod 해야 합니다)
+#include "../fpga_interface_driver_k6/fpga_interface.h"
 
 #define IOM_FPGA_DOT_MAJOR 262
 #define IOM_FPGA_DOT_NAME "fpga_dot"
 
 #define IOM_FPGA_DOT_ADDRESS 0x210 // Dot Matrix의 물리 주소
 
+#define DOT_ROWS FPGA_DOT_ROWS
+#define DOT_COLS 7           // bit 6 (왼쪽) ~ bit 0 (오른쪽)
+#define DOT_FONT_TOP 1       // 5x7 글자를 놓는 첫 행
+#define DOT_SPACE_WIDTH 3    // 빈 글리프가 흐를 때 차지하는 열 수
+
+static unsigned int scroll_ms = 150;
+module_param(scroll_ms, uint, 0644);
+MODULE_PARM_DESC(scroll_ms, "Default column step of FPGA_DOT_SCROLL in ms (default 150)");
+
+// /sys/kernel/fpga/devices/dot 카운터
+static struct fpga_dev_stats *dot_stats;
+
+// 숫자 글리프 (libfpga fpga_font.hpp 의 kDotDigits 와 같다)
+static const u8 dot_digits[10][DOT_ROWS] = {
+    {0x3e, 0x7f, 0x63, 0x73, 0x73, 0x6f, 0x67, 0x63, 0x7f, 0x3e}, // 0
+    {0x0c, 0x1c, 0x1c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x1e}, // 1
+    {0x7e, 0x7f, 0x03, 0x03, 0x3f, 0x7e, 0x60, 0x60, 0x7f, 0x7f}, // 2
+    {0xfe, 0x7f, 0x03, 0x03, 0x7f, 0x7f, 0x03, 0x03, 0x7f, 0x7e}, // 3
+    {0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x7f, 0x7f, 0x06, 0x06}, // 4
+    {0x7f, 0x7f, 0x60, 0x60, 0x7e, 0x7f, 0x03, 0x03, 0x7f, 0x7e}, // 5
+    {0x60, 0x60, 0x60, 0x60, 0x7e, 0x7f, 0x63, 0x63, 0x7f, 0x3e}, // 6
+    {0x7f, 0x7f, 0x63, 0x63, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03}, // 7
+    {0x3e, 0x7f, 0x63, 0x63, 0x7f, 0x7f, 0x63, 0x63, 0x7f, 0x3e}, // 8
+    {0x3e, 0x7f, 0x63, 0x63, 0x7f, 0x3f, 0x03, 0x03, 0x03, 0x03}, // 9
+};
+
+// 0x20 ~ 0x7E 의 5x7 글자, 글자마다 왼쪽부터 5 열 (bit 0 = 맨 윗행)
+static const u8 dot_font5x7[95][5] = {
+    {0x00, 0x00, 0x00, 0x00, 0x00}, // ' '
+    {0x00, 0x00, 0x5f, 0x00, 0x00}, // '!'
+    {0x00, 0x07, 0x00, 0x07, 0x00}, // '"'
+    {0x14, 0x7f, 0x14, 0x7f, 0x14}, // '#'
+    {0x24, 0x2a, 0x7f, 0x2a, 0x12}, // '$'
+    {0x23, 0x13, 0x08, 0x64, 0x62}, // '%'
+    {0x36, 0x49, 0x55, 0x22, 0x50}, // '&'
+    {0x00, 0x05, 0x03, 0x00, 0x00}, // '\''
+    {0x00, 0x1c, 0x22, 0x41, 0x00}, // '('
+    {0x00, 0x41, 0x22, 0x1c, 0x00}, // ')'
+    {0x08, 0x2a, 0x1c, 0x2a, 0x08}, // '*'
+    {0x08, 0x08, 0x3e, 0x08, 0x08}, // '+'
+    {0x00, 0x50, 0x30, 0x00, 0x00}, // ','
+    {0x08, 0x08, 0x08, 0x08, 0x08}, // '-'
+    {0x00, 0x60, 0x60, 0x00, 0x00}, // '.'
+    {0x20, 0x10, 0x08, 0x04, 0x02}, // '/'
+    {0x3e, 0x51, 0x49, 0x45, 0x3e}, // '0'
+    {0x00, 0x42, 0x7f, 0x40, 0x00}, // '1'
+    {0x42, 0x61, 0x51, 0x49, 0x46}, // '2'
+    {0x21, 0x41, 0x45, 0x4b, 0x31}, // '3'
+    {0x18, 0x14, 0x12, 0x7f, 0x10}, // '4'
+    {0x27, 0x45, 0x45, 0x45, 0x39}, // '5'
+    {0x3c, 0x4a, 0x49, 0x49, 0x30}, // '6'
+    {0x01, 0x71, 0x09, 0x05, 0x03}, // '7'
+    {0x36, 0x49, 0x49, 0x49, 0x36}, // '8'
+    {0x06, 0x49, 0x49, 0x29, 0x1e}, // '9'
+    {0x00, 0x36, 0x36, 0x00, 0x00}, // ':'
+    {0x00, 0x56, 0x36, 0x00, 0x00}, // ';'
+    {0x08, 0x14, 0x22, 0x41, 0x00}, // '<'
+    {0x14, 0x14, 0x14, 0x14, 0x14}, // '='
+    {0x00, 0x41, 0x22, 0x14, 0x08}, // '>'
+    {0x02, 0x01, 0x51, 0x09, 0x06}, // '?'
+    {0x32, 0x49, 0x79, 0x41, 0x3e}, // '@'
+    {0x7e, 0x11, 0x11, 0x11, 0x7e}, // 'A'
+    {0x7f, 0x49, 0x49, 0x49, 0x36}, // 'B'
+    {0x3e, 0x41, 0x41, 0x41, 0x22}, // 'C'
+    {0x7f, 0x41, 0x41, 0x22, 0x1c}, // 'D'
+    {0x7f, 0x49, 0x49, 0x49, 0x41}, // 'E'
+    {0x7f, 0x09, 0x09, 0x01, 0x01}, // 'F'
+    {0x3e, 0x41, 0x41, 0x51, 0x32}, // 'G'
+    {0x7f, 0x08, 0x08, 0x08, 0x7f}, // 'H'
+    {0x00, 0x41, 0x7f, 0x41, 0x00}, // 'I'
+    {0x20, 0x40, 0x41, 0x3f, 0x01}, // 'J'
+    {0x7f, 0x08, 0x14, 0x22, 0x41}, // 'K'
+    {0x7f, 0x40, 0x40, 0x40, 0x40}, // 'L'
+    {0x7f, 0x02, 0x04, 0x02, 0x7f}, // 'M'
+    {0x7f, 0x04, 0x08, 0x10, 0x7f}, // 'N'
+    {0x3e, 0x41, 0x41, 0x41, 0x3e}, // 'O'
+    {0x7f, 0x09, 0x09, 0x09, 0x06}, // 'P'
+    {0x3e, 0x41, 0x51, 0x21, 0x5e}, // 'Q'
+    {0x7f, 0x09, 0x19, 0x29, 0x46}, // 'R'
+    {0x46, 0x49, 0x49, 0x49, 0x31}, // 'S'
+    {0x01, 0x01, 0x7f, 0x01, 0x01}, // 'T'
+    {0x3f, 0x40, 0x40, 0x40, 0x3f}, // 'U'
+    {0x1f, 0x20, 0x40, 0x20, 0x1f}, // 'V'
+    {0x7f, 0x20, 0x18, 0x20, 0x7f}, // 'W'
+    {0x63, 0x14, 0x08, 0x14, 0x63}, // 'X'
+    {0x03, 0x04, 0x78, 0x04, 0x03}, // 'Y'
+    {0x61, 0x51, 0x49, 0x45, 0x43}, // 'Z'
+    {0x00, 0x7f, 0x41, 0x41, 0x00}, // '['
+    {0x02, 0x04, 0x08, 0x10, 0x20}, // '\\'
+    {0x00, 0x41, 0x41, 0x7f, 0x00}, // ']'
+    {0x04, 0x02, 0x01, 0x02, 0x04}, // '^'
+    {0x40, 0x40, 0x40, 0x40, 0x40}, // '_'
+    {0x00, 0x01, 0x02, 0x04, 0x00}, // '`'
+    {0x20, 0x54, 0x54, 0x54, 0x78}, // 'a'
+    {0x7f, 0x48, 0x44, 0x44, 0x38}, // 'b'
+    {0x38, 0x44, 0x44, 0x44, 0x20}, // 'c'
+    {0x38, 0x44, 0x44, 0x48, 0x7f}, // 'd'
+    {0x38, 0x54, 0x54, 0x54, 0x18}, // 'e'
+    {0x08, 0x7e, 0x09, 0x01, 0x02}, // 'f'
+    {0x08, 0x54, 0x54, 0x54, 0x3c}, // 'g'
+    {0x7f, 0x08, 0x04, 0x04, 0x78}, // 'h'
+    {0x00, 0x44, 0x7d, 0x40, 0x00}, // 'i'
+    {0x20, 0x40, 0x44, 0x3d, 0x00}, // 'j'
+    {0x7f, 0x10, 0x28, 0x44, 0x00}, // 'k'
+    {0x00, 0x41, 0x7f, 0x40, 0x00}, // 'l'
+    {0x7c, 0x04, 0x18, 0x04, 0x78}, // 'm'
+    {0x7c, 0x08, 0x04, 0x04, 0x78}, // 'n'
+    {0x38, 0x44, 0x44, 0x44, 0x38}, // 'o'
+    {0x7c, 0x14, 0x14, 0x14, 0x08}, // 'p'
+    {0x08, 0x14, 0x14, 0x18, 0x7c}, // 'q'
+    {0x7c, 0x08, 0x04, 0x04, 0x08}, // 'r'
+    {0x48, 0x54, 0x54, 0x54, 0x20}, // 's'
+    {0x04, 0x3f, 0x44, 0x40, 0x20}, // 't'
+    {0x3c, 0x40, 0x40, 0x20, 0x7c}, // 'u'
+    {0x1c, 0x20, 0x40, 0x20, 0x1c}, // 'v'
+    {0x3c, 0x40, 0x30, 0x40, 0x3c}, // 'w'
+    {0x44, 0x28, 0x10, 0x28, 0x44}, // 'x'
+    {0x0c, 0x50, 0x50, 0x50, 0x3c}, // 'y'
+    {0x44, 0x64, 0x54, 0x4c, 0x44}, // 'z'
+    {0x00, 0x08, 0x36, 0x41, 0x00}, // '{'
+    {0x00, 0x00, 0x7f, 0x00, 0x00}, // '|'
+    {0x00, 0x41, 0x36, 0x08, 0x00}, // '}'
+    {0x08, 0x04, 0x04, 0x08, 0x04}, // '~'
+};
+
+struct dot_glyph {
+    u8 rows[DOT_ROWS];   // 행 바이트 (글자 표시용)
+    u16 cols[DOT_COLS];  // 같은 글리프의 열, bit 0 = 맨 윗행 (흐르는 문자열용)
+    u8 first;            // 점이 있는 첫 열
+    u8 width;            // 흐를 때 차지하는 열 수
+};
+
 /*
- * 이 함수들은 'fpga_interface_driver.ko' 모듈에 의해 제공됩니다.
- * 'extern'은 컴파일러에게 이 함수들이 다른 곳에 정의되어 있음을 알리고,
- * 모듈이 로드될 때 커널이 이들을 연결해 줍니다.
- * 중요: 이 드라이버를 insmod 하기 전에 반드시 fpga_interface_driver.ko를 먼저 로드해야 합니다.
+ * dot_lock 이 아래 상태를 모두 보호한다. dot_written 은 마지막으로 버스에 쓴 행,
+ * dot_known 이 false 면 모든 행을 다시 쓴다.
  */
-extern ssize_t iom_fpga_itf_write(unsigned int addr, unsigned char value);
+static DEFINE_MUTEX(dot_lock);
+static struct dot_glyph dot_font[256];
+static u8 dot_frame[DOT_ROWS];
+static u8 dot_written[DOT_ROWS];
+static bool dot_known;
+static u32 dot_mode = FPGA_DOT_RAW;
+static int dot_shown = -1;           // FPGA_DOT_TEXT 로 표시 중인 문자 (-1: 없음)
 
-// 여러 프로그램이 동시에 접근하는 것을 막기 위한 전역 변수
-static int fpga_dot_port_usage = 0;
+struct dot_scroll {
+    char text[FPGA_DOT_SCROLL_MAX];
+    unsigned int len;                // 0 이면 멈춰 있다
+    unsigned int pos;                // 다음 열을 꺼낼 글자 (len 이면 끝의 빈 열)
+    unsigned int col;                // 그 글자 안의 열
+    unsigned int step_ms;
+};
+static struct dot_scroll dot_scroll;
+static void iom_fpga_dot_scroll_fn(struct work_struct *work);
+static DECLARE_DELAYED_WORK(dot_scroll_work, iom_fpga_dot_scroll_fn);
 
 /* 함수 프로토타입 선언 */
 static int iom_fpga_dot_open(struct inode *inode, struct file *file);
 static int iom_fpga_dot_release(struct inode *inode, struct file *file);
 static ssize_t iom_fpga_dot_write(struct file *file, const char __user *buf, size_t len, loff_t *off);
+static long iom_fpga_dot_ioctl(struct file *file, unsigned int cmd, unsigned long arg);
 
 /* 파일 오퍼레이션 구조체 (최신 스타일로 정의) */
 static const struct file_operations iom_fpga_dot_fops = {
@@ -43,48 +201,309 @@ static const struct file_operations iom_fpga_dot_fops = {
     .open    = iom_fpga_dot_open,
     .write   = iom_fpga_dot_write,
     .release = iom_fpga_dot_release,
+    .unlocked_ioctl = iom_fpga_dot_ioctl,
+    .compat_ioctl = compat_ptr_ioctl,
+    .uring_cmd = fpga_cmd_uring_cmd,
 };
 
 // dev/fpga_dot 장치 파일을 열 때 호출되는 함수
 static int iom_fpga_dot_open(struct inode *inode, struct file *file)
 {
-    if (fpga_dot_port_usage != 0)
+    if (fpga_cmd_claim(FPGA_CMD_DOT)) {
+        fpga_dev_stats_inc(dot_stats, FPGA_DEV_BUSY);
         return -EBUSY; // 이미 사용 중이면 오류 반환
+    }
 
-    fpga_dot_port_usage = 1;
+    // 새로 연 쪽은 항상 행 바이트로 시작한다 (흐르던 문자열은 다음 write 까지 계속 흐른다)
+    mutex_lock(&dot_lock);
+    dot_mode = FPGA_DOT_RAW;
+    mutex_unlock(&dot_lock);
+    fpga_dev_stats_inc(dot_stats, FPGA_DEV_OPENS);
     return 0;
 }
 
 // dev/fpga_dot 장치 파일을 닫을 때 호출되는 함수
 static int iom_fpga_dot_release(struct inode *inode, struct file *file)
 {
-    fpga_dot_port_usage = 0;
+    fpga_cmd_unclaim(FPGA_CMD_DOT);
+    return 0;
+}
+
+// 행 바이트로 글리프 캐시 항목을 만든다 (열 표와 폭도 여기서 한 번만 계산)
+static void dot_glyph_set(struct dot_glyph *g, const u8 *rows)
+{
+    int r, c, last = -1;
+
+    g->first = 0;
+    for (r = 0; r < DOT_ROWS; r++)
+        g->rows[r] = rows[r] & 0x7F;
+    for (c = 0; c < DOT_COLS; c++) {
+        u16 col = 0;
+
+        for (r = 0; r < DOT_ROWS; r++)
+            if (g->rows[r] & (0x40 >> c))
+                col |= 1 << r;
+        g->cols[c] = col;
+        if (col) {
+            if (last < 0)
+                g->first = c;
+            last = c;
+        }
+    }
+    g->width = last < 0 ? DOT_SPACE_WIDTH : last - g->first + 1;
+}
+
+// 내장 글리프: 숫자는 10 행 글자, 나머지 ASCII 는 5x7 글자를 가운데에, 그 밖은 빈 글리프
+static void dot_glyph_default(unsigned int code)
+{
+    u8 rows[DOT_ROWS] = { 0 };
+    int r, c;
+
+    if (code >= '0' && code <= '9') {
+        memcpy(rows, dot_digits[code - '0'], DOT_ROWS);
+    } else if (code >= 0x20 && code <= 0x7E) {
+        for (c = 0; c < 5; c++)
+            for (r = 0; r < 7; r++)
+                if (dot_font5x7[code - 0x20][c] & (1 << r))
+                    rows[DOT_FONT_TOP + r] |= 0x20 >> c;
+    }
+    dot_glyph_set(&dot_font[code], rows);
+}
+
+// 프레임 버퍼에서 바뀐 행만 한 배치로 보낸다, 돌려주는 값은 쓴 행 수
+static unsigned int dot_push_locked(loff_t cookie)
+{
+    struct fpga_bus_write tx[DOT_ROWS];
+    unsigned int i, n = 0;
+    u64 start;
+
+    for (i = 0; i < DOT_ROWS; i++) {
+        if (dot_known && dot_frame[i] == dot_written[i])
+            continue;
+        tx[n].addr = IOM_FPGA_DOT_ADDRESS + i;
+        tx[n].value = dot_frame[i];
+        n++;
+    }
+    if (n) {
+        start = trace_fpga_dev_write_enabled() ? ktime_get_ns() : 0;
+        iom_fpga_itf_write_batch(tx, n);
+        trace_fpga_dev_write("dot", cookie, n, start);
+    }
+    memcpy(dot_written, dot_frame, DOT_ROWS);
+    dot_known = true;
+    return n;
+}
+
+// 흐르는 문자열의 다음 열 (글자 사이 한 칸, 끝에는 화면 폭만큼 빈 열)
+static u16 dot_scroll_next_col(struct dot_scroll *sc)
+{
+    const struct dot_glyph *g;
+
+    if (sc->pos == sc->len) {
+        if (++sc->col >= DOT_COLS) {
+            sc->pos = 0;
+            sc->col = 0;
+        }
+        return 0;
+    }
+    g = &dot_font[(u8)sc->text[sc->pos]];
+    if (sc->col < g->width)
+        return g->cols[g->first + sc->col++];
+    sc->pos++;
+    sc->col = 0;
     return 0;
 }
 
+// 한 열씩 민다: 캐시된 열 하나만 꺼내고 전체 문자열은 다시 그리지 않는다
+static void iom_fpga_dot_scroll_fn(struct work_struct *work)
+{
+    u16 col;
+    int r;
+
+    mutex_lock(&dot_lock);
+    if (!dot_scroll.len) {
+        mutex_unlock(&dot_lock);
+        return;
+    }
+    col = dot_scroll_next_col(&dot_scroll);
+    for (r = 0; r < DOT_ROWS; r++)
+        dot_frame[r] = ((dot_frame[r] << 1) | ((col >> r) & 1)) & 0x7F;
+    dot_push_locked(0);
+    queue_delayed_work(system_wq, &dot_scroll_work, msecs_to_jiffies(dot_scroll.step_ms));
+    mutex_unlock(&dot_lock);
+}
+
+// 흐르던 문자열을 멈춘다 (dot_lock 을 잡지 않은 채로 부른다)
+static void dot_scroll_stop(void)
+{
+    mutex_lock(&dot_lock);
+    dot_scroll.len = 0;
+    mutex_unlock(&dot_lock);
+    cancel_delayed_work_sync(&dot_scroll_work);
+}
+
 // dev/fpga_dot 장치 파일에 write()를 할 때 호출되는 함수
 static ssize_t iom_fpga_dot_write(struct file *file, const char __user *buf, size_t len, loff_t *off)
 {
     int i;
+    char text[FPGA_DOT_SCROLL_MAX];
     unsigned char value[10];
-    size_t length_to_copy = len > sizeof(value) ? sizeof(value) : len;
+    struct fpga_bus_write tx[10];
+    size_t length_to_copy;
+    size_t text_len;
+    u64 start;
+    u32 mode;
+
+    dot_scroll_stop();
+    mutex_lock(&dot_lock);
+    mode = dot_mode;
+    mutex_unlock(&dot_lock);
+
+    if (mode != FPGA_DOT_RAW) {
+        // 글자 모드: 글리프를 프레임 버퍼에 그리고 바뀐 행만 쓴다
+        length_to_copy = min(len, sizeof(text));
+        if (copy_from_user(text, buf, length_to_copy)) {
+            fpga_dev_stats_inc(dot_stats, FPGA_DEV_FAULTS);
+            return -EFAULT;
+        }
+        text_len = length_to_copy;
+        if (text_len && text[text_len - 1] == '\n')
+            text_len--;
+
+        mutex_lock(&dot_lock);
+        if (text_len && mode == FPGA_DOT_TEXT) {
+            dot_shown = (u8)text[text_len - 1];
+            memcpy(dot_frame, dot_font[dot_shown].rows, DOT_ROWS);
+            dot_push_locked(*off);
+        } else if (text_len) {
+            // 빈 화면에서 시작해 오른쪽에서 한 열씩 들어온다
+            memcpy(dot_scroll.text, text, text_len);
+            dot_scroll.len = text_len;
+            dot_scroll.pos = 0;
+            dot_scroll.col = 0;
+            memset(dot_frame, 0, DOT_ROWS);
+            dot_push_locked(*off);
+            queue_delayed_work(system_wq, &dot_scroll_work, msecs_to_jiffies(dot_scroll.step_ms));
+        }
+        mutex_unlock(&dot_lock);
+
+        fpga_dev_stats_inc(dot_stats, FPGA_DEV_WRITES);
+        if (length_to_copy != len)
+            fpga_dev_stats_inc(dot_stats, FPGA_DEV_SHORT_WRITES);
+        return length_to_copy;
+    }
 
+    length_to_copy = len > sizeof(value) ? sizeof(value) : len;
     if (copy_from_user(value, buf, length_to_copy)) {
+        fpga_dev_stats_inc(dot_stats, FPGA_DEV_FAULTS);
         return -EFAULT;
     }
 
-    // 사용자로부터 받은 데이터로 Dot Matrix의 각 라인을 제어
+    // 사용자로부터 받은 데이터로 Dot Matrix의 각 라인을 제어 (한 배치로 보낸다)
     for (i = 0; i < length_to_copy; i++) {
-        iom_fpga_itf_write((unsigned int)IOM_FPGA_DOT_ADDRESS + i, value[i] & 0x7F);
+        tx[i].addr = IOM_FPGA_DOT_ADDRESS + i;
+        tx[i].value = value[i] & 0x7F;
     }
+    mutex_lock(&dot_lock);
+    start = trace_fpga_dev_write_enabled() ? ktime_get_ns() : 0;
+    iom_fpga_itf_write_batch(tx, length_to_copy);
+    // 행 바이트도 프레임 버퍼에 남겨 다음 글자 쓰기가 비교할 수 있게 한다
+    for (i = 0; i < length_to_copy; i++)
+        dot_frame[i] = dot_written[i] = tx[i].value;
+    dot_shown = -1;
+    mutex_unlock(&dot_lock);
 
+    trace_fpga_dev_write("dot", *off, length_to_copy, start);
+    fpga_dev_stats_inc(dot_stats, FPGA_DEV_WRITES);
+    if (len != sizeof(value))
+        fpga_dev_stats_inc(dot_stats, FPGA_DEV_SHORT_WRITES);
     return length_to_copy;
 }
 
+// FPGA_IOC_DOT_GLYPH: 글리프 하나를 바꾸거나 내장 글리프로 되돌린다
+static long iom_fpga_dot_glyph_ioctl(unsigned long arg)
+{
+    struct fpga_dot_glyph req;
+
+    if (copy_from_user(&req, (void __user *)arg, sizeof(req))) {
+        fpga_dev_stats_inc(dot_stats, FPGA_DEV_FAULTS);
+        return -EFAULT;
+    }
+    if ((req.flags & ~FPGA_DOT_GLYPH_DEFAULT) || memchr_inv(req.reserved, 0, sizeof(req.reserved)))
+        return -EINVAL;
+
+    mutex_lock(&dot_lock);
+    if (req.flags & FPGA_DOT_GLYPH_DEFAULT)
+        dot_glyph_default(req.code);
+    else
+        dot_glyph_set(&dot_font[req.code], req.rows);
+    // 지금 보이는 글자면 바로 다시 그린다 (흐르는 문자열은 다음 열부터 새 글리프를 쓴다)
+    if (dot_shown == req.code) {
+        memcpy(dot_frame, dot_font[req.code].rows, DOT_ROWS);
+        dot_push_locked(0);
+    }
+    mutex_unlock(&dot_lock);
+    return 0;
+}
+
+// FPGA_IOC_DOT_MODE: 다음 write() 의 뜻을 고른다
+static long iom_fpga_dot_mode_ioctl(unsigned long arg)
+{
+    struct fpga_dot_mode req;
+
+    if (copy_from_user(&req, (void __user *)arg, sizeof(req))) {
+        fpga_dev_stats_inc(dot_stats, FPGA_DEV_FAULTS);
+        return -EFAULT;
+    }
+    if (req.mode > FPGA_DOT_SCROLL || (req.step_ms && (req.step_ms < 10 || req.step_ms > 10000)))
+        return -EINVAL;
+
+    dot_scroll_stop();
+    mutex_lock(&dot_lock);
+    dot_mode = req.mode;
+    dot_scroll.step_ms = req.step_ms ? req.step_ms : clamp_t(unsigned int, scroll_ms, 10, 10000);
+    // 그 사이 FPGA_IOC_SUBMIT 이나 장면이 바꿨을 수 있으므로 다음에는 모든 행을 쓴다
+    dot_known = false;
+    mutex_unlock(&dot_lock);
+    return 0;
+}
+
+static long iom_fpga_dot_ioctl(struct file *file, unsigned int cmd, unsigned long arg)
+{
+    switch (cmd) {
+    case FPGA_IOC_DOT_GLYPH:
+        return iom_fpga_dot_glyph_ioctl(arg);
+    case FPGA_IOC_DOT_MODE:
+        return iom_fpga_dot_mode_ioctl(arg);
+    default:
+        // FPGA_IOC_SUBMIT, 장면
+        return fpga_cmd_ioctl(file, cmd, arg);
+    }
+}
+
+// FPGA_IOC_SUBMIT 명령 하나를 버스 쓰기로 바꾼다 (write() 와 같이 10 행까지, 7 비트)
+static int iom_fpga_dot_encode(const struct fpga_cmd *cmd, struct fpga_bus_write *tx)
+{
+    int i;
+
+    if (cmd->len > 10)
+        return -EINVAL;
+    for (i = 0; i < cmd->len; i++) {
+        tx[i].addr = IOM_FPGA_DOT_ADDRESS + i;
+        tx[i].value = cmd->data[i] & 0x7F;
+    }
+    return cmd->len;
+}
+
 // 모듈이 커널에 로드될 때 호출되는 초기화 함수
 static int __init iom_fpga_dot_init(void)
 {
     int result;
+    unsigned int code;
+
+    for (code = 0; code < ARRAY_SIZE(dot_font); code++)
+        dot_glyph_default(code);
+    dot_scroll.step_ms = clamp_t(unsigned int, scroll_ms, 10, 10000);
 
     result = register_chrdev(IOM_FPGA_DOT_MAJOR, IOM_FPGA_DOT_NAME, &iom_fpga_dot_fops);
     if (result < 0) {
@@ -93,12 +512,18 @@ static int __init iom_fpga_dot_init(void)
     }
 
     pr_info("init module, %s major number : %d\n", IOM_FPGA_DOT_NAME, IOM_FPGA_DOT_MAJOR);
+    dot_stats = fpga_dev_stats_register("dot");
+    if (fpga_cmd_register(FPGA_CMD_DOT, iom_fpga_dot_encode, dot_stats))
+        pr_warn("%s: FPGA_IOC_SUBMIT is not available\n", IOM_FPGA_DOT_NAME);
     return 0;
 }
 
 // 모듈이 커널에서 제거될 때 호출되는 종료 함수
 static void __exit iom_fpga_dot_exit(void)
 {
+    dot_scroll_stop();
+    fpga_cmd_unregister(FPGA_CMD_DOT);
+    fpga_dev_stats_unregister(dot_stats);
     unregister_chrdev(IOM_FPGA_DOT_MAJOR, IOM_FPGA_DOT_NAME);
     pr_info("exit module, %s\n", IOM_FPGA_DOT_NAME);
 }
@@ -1 +0,0 @@
-/home/kjh/example/fpga_dot_k6/fpga_interface_driver.o
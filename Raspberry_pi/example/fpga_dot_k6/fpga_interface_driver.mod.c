@@ -1,36 +0,0 @@
-#include <linux/module.h>
-#include <linux/export-internal.h>
-#include <linux/compiler.h>
-
-MODULE_INFO(name, KBUILD_MODNAME);
-
-__visible struct module __this_module
-__section(".gnu.linkonce.this_module") = {
-	.name = KBUILD_MODNAME,
-	.init = init_module,
-#ifdef CONFIG_MODULE_UNLOAD
-	.exit = cleanup_module,
-#endif
-	.arch = MODULE_ARCH_INIT,
-};
-
-KSYMTAB_FUNC(iom_fpga_itf_write, "", "");
-KSYMTAB_FUNC(iom_fpga_itf_read, "", "");
-
-SYMBOL_CRC(iom_fpga_itf_write, 0xff9cc569, "");
-SYMBOL_CRC(iom_fpga_itf_read, 0xa6620baa, "");
-
-static const struct modversion_info ____versions[]
-__used __section("__versions") = {
-	{ 0x122c3a7e, "_printk" },
-	{ 0xeae3dfd6, "__const_udelay" },
-	{ 0xedc03953, "iounmap" },
-	{ 0xaf56600a, "arm64_use_ng_mappings" },
-	{ 0x40863ba1, "ioremap_prot" },
-	{ 0x39ff040a, "module_layout" },
-};
-
-MODULE_INFO(depends, "");
-
-
-MODULE_INFO(srcversion, "E21D49DB37DC12D0FE6F80F");
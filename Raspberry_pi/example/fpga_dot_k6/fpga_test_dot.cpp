@@ -0,0 +1,77 @@
+/* FPGA DotMatirx Test Application
+File : fpga_test_dot.cpp
+
+Usage: fpga_test_dot <0~9>                  show a digit (raw rows)
+       fpga_test_dot char <c>               show a character from the driver's glyph cache
+       fpga_test_dot scroll <text> [ms]     scroll text in the kernel, <ctrl+c> to stop */
+
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "fpga.hpp"
+
+// 글자는 커널이 그리고, 흐르는 문자열은 이 프로그램이 자는 동안에도 커널이 민다
+static int run_text(int argc, char **argv)
+{
+	int ret;
+
+	fpga::Dot dot = fpga::Dot::open(fpga::Backend::Device);
+	if (!dot.ok()) {
+		printf("Device open error : %s\n",fpga::kDotDevice);
+		return -1;
+	}
+
+	if (!strcmp(argv[1], "char"))
+		ret = dot.show_char(argv[2][0]);
+	else
+		ret = dot.scroll(argv[2], argc > 3 ? atoi(argv[3]) : 0);
+	if (ret < 0) {
+		printf("Write Error! (%s)\n", strerror(-ret));
+		return -1;
+	}
+	if (!strcmp(argv[1], "scroll")) {
+		printf("Press <ctrl+c> to quit. \n");
+		// 닫은 뒤에도 계속 흐르므로 끝날 때 지운다
+		signal(SIGINT, [](int) {});
+		pause();
+		dot.clear();
+	}
+	return 0;
+}
+
+int main(int argc, char **argv)
+{
+	int set_num;
+
+	if(argc>=3 && (!strcmp(argv[1], "char") || !strcmp(argv[1], "scroll")))
+		return run_text(argc, argv);
+
+	if(argc!=2) {
+		printf("please input the parameter! \n");
+		printf("ex)./fpga_dot_test 7\n");
+		return -1;
+	}
+
+	set_num = atoi(argv[1]);
+	if(set_num<0||set_num>9) {
+		printf("Invalid Numner (0~9) !\n");
+		return -1;
+	}
+
+	fpga::Dot dot = fpga::Dot::open();
+	if (!dot.ok()) {
+		printf("Device open error : %s\n",fpga::kDotDevice);
+		exit(1);
+	}
+
+	// 글리프는 libfpga 의 constexpr 테이블(fpga_font.hpp)에서 가져온다
+	if(dot.show_digit(set_num)<0) {
+		printf("Write Error!\n");
+		return -1;
+	}
+
+	return 0;
+}
@@ -12,6 +12,9 @@
 #include <linux/fs.h>
 #include <linux/uaccess.h> // For copy_from_user/copy_to_user
 
+// 버스 접근/통계 함수 ('fpga_interface_driver.ko' 를 먼저 insmod 해야 합니다)
+#include "../fpga_interface_driver_k6/fpga_interface.h"
+
 #define IOM_FND_MAJOR 261
 #define IOM_FND_NAME "fpga_fnd"
 
@@ -19,15 +22,8 @@
 #define IOM_FND1_ADDRESS 0x003
 #define IOM_FND2_ADDRESS 0x004
 
-/*
- * 이 함수들은 'fpga_interface_driver.ko' 모듈에 의해 제공됩니다.
- * 중요: 이 드라이버를 insmod 하기 전에 반드시 fpga_interface_driver.ko를 먼저 로드해야 합니다.
- */
-extern unsigned char iom_fpga_itf_read(unsigned int addr);
-extern ssize_t iom_fpga_itf_write(unsigned int addr, unsigned char value);
-
-// 여러 프로그램이 동시에 접근하는 것을 막기 위한 전역 변수
-static int fpga_fnd_port_usage = 0;
+// /sys/kernel/fpga/devices/fnd 카운터
+static struct fpga_dev_stats *fnd_stats;
 
 /* 함수 프로토타입 선언 */
 static int iom_fnd_open(struct inode *inode, struct file *file);
@@ -42,22 +38,27 @@ static const struct file_operations iom_fpga_fnd_fops = {
     .write   = iom_fnd_write,
     .read    = iom_fnd_read,
     .release = iom_fnd_release,
+    .unlocked_ioctl = fpga_cmd_ioctl,
+    .compat_ioctl = compat_ptr_ioctl,
+    .uring_cmd = fpga_cmd_uring_cmd,
 };
 
 // /dev/fpga_fnd 장치 파일을 열 때 호출되는 함수
 static int iom_fnd_open(struct inode *inode, struct file *file)
 {
-    if (fpga_fnd_port_usage != 0)
+    if (fpga_cmd_claim(FPGA_CMD_FND)) {
+        fpga_dev_stats_inc(fnd_stats, FPGA_DEV_BUSY);
         return -EBUSY; // 이미 사용 중이면 오류 반환
+    }
 
-    fpga_fnd_port_usage = 1;
+    fpga_dev_stats_inc(fnd_stats, FPGA_DEV_OPENS);
     return 0;
 }
 
 // /dev/fpga_fnd 장치 파일을 닫을 때 호출되는 함수
 static int iom_fnd_release(struct inode *inode, struct file *file)
 {
-    fpga_fnd_port_usage = 0;
+    fpga_cmd_unclaim(FPGA_CMD_FND);
     return 0;
 }
 
@@ -65,16 +66,27 @@ static int iom_fnd_release(struct inode *inode, struct file *file)
 static ssize_t iom_fnd_write(struct file *file, const char __user *buf, size_t len, loff_t *off)
 {
     unsigned char value[4];
+    struct fpga_bus_write tx[2];
+    u64 start;
 
     // 사용자 공간에서 4바이트 데이터를 복사해옵니다.
     if (copy_from_user(value, buf, 4)) {
+        fpga_dev_stats_inc(fnd_stats, FPGA_DEV_FAULTS);
         return -EFAULT;
     }
 
+    start = trace_fpga_dev_write_enabled() ? ktime_get_ns() : 0;
     // 4바이트 데이터를 2개의 8비트 레지스터 값으로 조합하여 씁니다.
-    iom_fpga_itf_write((unsigned int)IOM_FND1_ADDRESS, (value[0] & 0x0F) << 4 | (value[1] & 0x0F));
-    iom_fpga_itf_write((unsigned int)IOM_FND2_ADDRESS, (value[2] & 0x0F) << 4 | (value[3] & 0x0F));
-
+    tx[0].addr = IOM_FND1_ADDRESS;
+    tx[0].value = (value[0] & 0x0F) << 4 | (value[1] & 0x0F);
+    tx[1].addr = IOM_FND2_ADDRESS;
+    tx[1].value = (value[2] & 0x0F) << 4 | (value[3] & 0x0F);
+    iom_fpga_itf_write_batch(tx, 2);
+
+    trace_fpga_dev_write("fnd", *off, len, start);
+    fpga_dev_stats_inc(fnd_stats, FPGA_DEV_WRITES);
+    if (len != 4)
+        fpga_dev_stats_inc(fnd_stats, FPGA_DEV_SHORT_WRITES);
     return len;
 }
 
@@ -86,6 +98,7 @@ static ssize_t iom_fnd_read(struct file *file, char __user *buf, size_t len, lof
 
     data1 = iom_fpga_itf_read((unsigned int)IOM_FND1_ADDRESS);
     data2 = iom_fpga_itf_read((unsigned int)IOM_FND2_ADDRESS);
+    fpga_dev_stats_inc(fnd_stats, FPGA_DEV_READS);
 
     value[0] = (data1 >> 4) & 0x0F;
     value[1] = data1 & 0x0F;
@@ -93,12 +106,25 @@ static ssize_t iom_fnd_read(struct file *file, char __user *buf, size_t len, lof
     value[3] = data2 & 0x0F;
 
     if (copy_to_user(buf, value, 4)) {
+        fpga_dev_stats_inc(fnd_stats, FPGA_DEV_FAULTS);
         return -EFAULT;
     }
 
     return 4;
 }
 
+// FPGA_IOC_SUBMIT 명령 하나를 버스 쓰기로 바꾼다 (write() 와 같은 4 자리 조합)
+static int iom_fnd_encode(const struct fpga_cmd *cmd, struct fpga_bus_write *tx)
+{
+    if (cmd->len != 4)
+        return -EINVAL;
+    tx[0].addr = IOM_FND1_ADDRESS;
+    tx[0].value = (cmd->data[0] & 0x0F) << 4 | (cmd->data[1] & 0x0F);
+    tx[1].addr = IOM_FND2_ADDRESS;
+    tx[1].value = (cmd->data[2] & 0x0F) << 4 | (cmd->data[3] & 0x0F);
+    return 2;
+}
+
 // 모듈이 커널에 로드될 때 호출되는 초기화 함수
 static int __init iom_fnd_init(void)
 {
@@ -111,12 +137,17 @@ static int __init iom_fnd_init(void)
     }
 
     pr_info("init module, %s major number : %d\n", IOM_FND_NAME, IOM_FND_MAJOR);
+    fnd_stats = fpga_dev_stats_register("fnd");
+    if (fpga_cmd_register(FPGA_CMD_FND, iom_fnd_encode, fnd_stats))
+        pr_warn("%s: FPGA_IOC_SUBMIT is not available\n", IOM_FND_NAME);
     return 0;
 }
 
 // 모듈이 커널에서 제거될 때 호출되는 종료 함수
 static void __exit iom_fnd_exit(void)
 {
+    fpga_cmd_unregister(FPGA_CMD_FND);
+    fpga_dev_stats_unregister(fnd_stats);
     unregister_chrdev(IOM_FND_MAJOR, IOM_FND_NAME);
     pr_info("exit module, %s\n", IOM_FND_NAME);
 }
@@ -0,0 +1,65 @@
+/* FPGA FND Test Application
+File : fpga_test_fnd.cpp*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <string.h>
+
+#include "fpga.hpp"
+
+int main(int argc, char **argv)
+{
+	fpga::FndDigits data{};
+	int i;
+	int str_size;
+
+	if(argc!=2) {
+		printf("please input the parameter! \n");
+		printf("ex)./test_led 1234\n");
+		return -1;
+	}
+
+	str_size=(strlen(argv[1]));
+	if(str_size>(int)fpga::kFndDigits)
+	{
+		printf("Warning! 4 Digit number only!\n");
+		str_size=fpga::kFndDigits;
+	}
+
+	for(i=0;i<str_size;i++)
+	{
+		if((argv[1][i]<0x30)||(argv[1][i])>0x39) {
+			printf("Error! Invalid Value!\n");
+			return -1;
+		}
+		data[i]=argv[1][i]-0x30;
+	}
+
+	fpga::Fnd fnd = fpga::Fnd::open();
+	if (!fnd.ok()) {
+		printf("Device open error : %s\n",fpga::kFndDevice);
+		exit(1);
+	}
+
+	if(fnd.set(data)<0) {
+		printf("Write Error!\n");
+		return -1;
+	}
+
+	data.fill(0);
+
+	sleep(1);
+
+	if(fnd.get(data)<0) {
+		printf("Read Error!\n");
+		return -1;
+	}
+
+	printf("Current FND Value : ");
+	for(i=0;i<str_size;i++)
+		printf("0x%x ",data[i]);
+	printf("\n");
+
+	return(0);
+}
@@ -0,0 +1,127 @@
+/*
+ * Interface exported by fpga_interface_driver to the FPGA device drivers
+ *
+ * Device drivers include this header instead of declaring the bus
+ * functions themselves. Besides the bus access it provides per-device
+ * statistics: a driver registers once at init and bumps its counters with
+ * fpga_dev_stats_inc(), a per-CPU increment that needs no lock or atomic
+ * on the hot path. The counters appear under
+ *   /sys/kernel/debug/fpga/devices       (one table for all devices)
+ *   /sys/kernel/fpga/devices/<name>/     (one file per counter)
+ * next to the per-region bus counters of the interface driver itself, and
+ * are cleared by writing to /sys/kernel/fpga/reset or
+ * /sys/kernel/debug/fpga/reset.
+ *
+ * Each write() also fires trace_fpga_dev_write() (fpga_trace.h) with the
+ * file offset as a cookie, for end-to-end latency tracing.
+ *
+ * A driver that writes several registers for one update hands them to
+ * iom_fpga_itf_write_batch() in one call. The interface driver may
+ * interleave the writes of different devices to cut pin toggles between
+ * successive bus words, but writes to the same device stay in the order
+ * given. The bus functions may sleep: callers wait for the bus by
+ * priority class (input, actuate, bulk, chosen by address region) and for
+ * the bytes/s budget of the region, see fpga_interface_driver.c. With the
+ * compositor on, writes to the display regions return once they are in
+ * the back buffer and reach the bus on the next refresh tick.
+ *
+ * Output drivers also register an encoder for their device commands
+ * (fpga_ioctl.h) and point .unlocked_ioctl and .uring_cmd of their
+ * file_operations at fpga_cmd_ioctl() and fpga_cmd_uring_cmd(). The
+ * interface driver then runs command batches for all registered devices,
+ * whichever device file they arrive on, as long as no other process holds
+ * them: their open()/release() take the shared fpga_cmd_claim() lock
+ * instead of a private in-use flag.
+ */
+#ifndef FPGA_INTERFACE_H
+#define FPGA_INTERFACE_H
+
+#include <linux/percpu.h>
+#include <linux/types.h>
+
+#include "fpga_ioctl.h"
+#include "fpga_trace.h"
+
+struct file;
+struct io_uring_cmd;
+struct kobject;
+
+/* 'fpga_interface_driver.ko' 가 제공하는 버스 접근 함수 */
+ssize_t iom_fpga_itf_write(unsigned int addr, unsigned char value);
+unsigned char iom_fpga_itf_read(unsigned int addr);
+bool iom_fpga_itf_sim(void);
+
+struct fpga_bus_write {
+    u16 addr;
+    u8 value;
+};
+
+// n 개의 쓰기를 한 번에 보낸다, 돌려주는 값은 n
+int iom_fpga_itf_write_batch(const struct fpga_bus_write *tx, unsigned int n);
+// 쓰기 합치기를 켠 영역에 남은 쓰기를 지금 보낸다
+void iom_fpga_itf_flush(void);
+// addr 가 곧 가질 값 (버스를 읽지 않는다), 아직 모르는 주소면 false
+bool iom_fpga_itf_shadow(unsigned int addr, unsigned char *value);
+// addr 부터 이어진 n 개 (64 까지) 를 버스를 한 번 잡고 읽는다, 돌려주는 값은 n 또는 -errno
+int iom_fpga_itf_read_batch(unsigned int addr, unsigned char *buf, unsigned int n);
+
+/* 디바이스 드라이버별 카운터 */
+enum fpga_dev_stat {
+    FPGA_DEV_OPENS,        // 성공한 open
+    FPGA_DEV_BUSY,         // 이미 열려 있어서 -EBUSY 로 거절한 open
+    FPGA_DEV_WRITES,
+    FPGA_DEV_READS,
+    FPGA_DEV_SHORT_WRITES, // 길이가 한 번 갱신 크기와 다른 write (잘리거나 일부만 씀)
+    FPGA_DEV_FAULTS,       // copy_from_user/copy_to_user 실패 (-EFAULT)
+    FPGA_DEV_STAT_COUNT,
+};
+
+struct fpga_dev_counters {
+    unsigned long v[FPGA_DEV_STAT_COUNT];
+};
+
+struct fpga_dev_stats {
+    const char *name;
+    struct fpga_dev_counters __percpu *counters;
+    struct kobject *kobj;
+};
+
+/*
+ * Register the counters of one device ("led", "dot", ...). Returns NULL
+ * when they cannot be allocated; the driver keeps working without them,
+ * fpga_dev_stats_inc() and fpga_dev_stats_unregister() accept NULL.
+ */
+struct fpga_dev_stats *fpga_dev_stats_register(const char *name);
+void fpga_dev_stats_unregister(struct fpga_dev_stats *stats);
+
+static inline void fpga_dev_stats_inc(struct fpga_dev_stats *stats, enum fpga_dev_stat stat)
+{
+    if (stats)
+        this_cpu_inc(stats->counters->v[stat]);
+}
+
+/*
+ * Turn one command (cmd->len already checked against FPGA_CMD_DATA) into
+ * register writes in tx, at most FPGA_CMD_DATA of them. Returns the number
+ * of writes or -EINVAL. Called under a mutex, must not sleep on the bus.
+ */
+typedef int (*fpga_cmd_encode_t)(const struct fpga_cmd *cmd, struct fpga_bus_write *tx);
+
+// stats 는 명령마다 FPGA_DEV_WRITES 를 센다 (NULL 가능), 해제는 fpga_dev_stats_unregister 보다 먼저
+int fpga_cmd_register(enum fpga_cmd_device device, fpga_cmd_encode_t encode, struct fpga_dev_stats *stats);
+void fpga_cmd_unregister(enum fpga_cmd_device device);
+
+/*
+ * Single-opener lock of a device, shared with FPGA_IOC_SUBMIT and scenes:
+ * open() calls fpga_cmd_claim() (-EBUSY while the device is open, or while
+ * another process's batch is writing it) and release() fpga_cmd_unclaim().
+ * A batch only writes devices that are not open or are open by the
+ * submitting process, otherwise it fails with -EBUSY and writes nothing.
+ */
+int fpga_cmd_claim(enum fpga_cmd_device device);
+void fpga_cmd_unclaim(enum fpga_cmd_device device);
+
+long fpga_cmd_ioctl(struct file *file, unsigned int cmd, unsigned long arg);
+int fpga_cmd_uring_cmd(struct io_uring_cmd *ioucmd, unsigned int issue_flags);
+
+#endif /* FPGA_INTERFACE_H */
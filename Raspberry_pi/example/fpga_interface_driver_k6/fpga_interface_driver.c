@@ -12,13 +12,157 @@
  * - Manually configures pin direction (GPFSEL) and state (GPSET/GPCLR).
  * - This method is independent of the kernel's GPIO driver readiness and
  * bypasses any pin ownership conflicts.
+ *
+ * Module parameters:
+ * - sim=1     : no GPIO access at all; transactions go to an in-memory
+ *               register file (same 11-bit address space as the bus). Lets
+ *               the display drivers and fpga_bus_bench run on any kernel,
+ *               e.g. a CI VM, to catch software overhead regressions.
+ * - verbose=0 : drop the pr_info() per transaction. Logging costs far more
+ *               than the bus cycle itself, so turn it off before measuring
+ *               (writable at runtime under /sys/module/.../parameters).
+ * - reorder=0 : send iom_fpga_itf_write_batch() writes in submission order
+ *               (writable at runtime, for comparing the toggle counts).
+ *
+ * Bus state: the level of the 11 address and 8 data pins is cached, and a
+ * transaction only touches the pins that change, with one GPSET and one
+ * GPCLR write for all of them instead of one register write per pin.
+ *
+ * Arbitration: every region belongs to a priority class, input (push
+ * switch, DIP switch), actuate (LED, FND, buzzer, step motor, other) or
+ * bulk (dot matrix, text LCD). The bus goes to the most urgent waiting
+ * class, and a bulk batch hands it over between two transactions when a
+ * more urgent class is waiting, so a button sample waits for at most one
+ * strobe instead of a whole LCD redraw. Each region may also have a
+ * bytes/s budget (token bucket, 100 ms burst); a caller over budget sleeps
+ * before it asks for the bus, so it never holds up the others. Waiting
+ * sleeps, so the bus functions must be called from process context.
+ * Class and budget are set per region in /sys/kernel/fpga/bus/<region>/.
+ *
+ * Coalescing: a region can opt in to a write-coalescing window by writing
+ * a window in microseconds to /sys/kernel/fpga/bus/<region>/coalesce
+ * ("off" to opt out). Its writes are then parked in a pending table and
+ * return at once; writes to the same address before the flush collapse to
+ * the last value. The flush runs from a work item, armed by an hrtimer at
+ * the end of the window of the first parked write, and sends all pending
+ * writes as one batch. Window 0 flushes as soon as the work runs, so only
+ * writes that pile up while the bus is busy collapse. Reading a register
+ * with a pending write, turning coalescing off, iom_fpga_itf_flush() and
+ * writing to /sys/kernel/fpga/bus/flush flush at once. Coalesced writes
+ * reach the bus late, so the fpga_dev_write trace of a parked write marks
+ * when it was parked, not when it was strobed.
+ *
+ * Compositor: writing a refresh rate to /sys/kernel/fpga/compositor/hz
+ * (1~1000, 0 turns it off) hands the display regions (dot matrix, text
+ * LCD, FND, LED) to a compositor. Their writes only update a back buffer
+ * and return at once; a periodic hrtimer queues a commit each tick that
+ * takes every dirty register, drops the ones the bus already holds, and
+ * sends the rest as one bus batch. All writes of one
+ * iom_fpga_itf_write_batch() (an FPGA_IOC_SUBMIT batch, a scene) enter the
+ * back buffer together, so related outputs such as the LCD text and the
+ * FND number of one frame always reach the bus in the same burst. Each
+ * tick reports its commit time and bytes in the fpga:fpga_compose
+ * tracepoint (fpga_trace.h) and in the compositor counters. Reading a
+ * register with a dirty value and turning the compositor off commit at
+ * once; iom_fpga_itf_flush() does not, the tick stays the only refresh.
+ * The compositor takes precedence over a coalescing window of the same
+ * region.
+ *
+ * Batches: iom_fpga_itf_write_batch() takes the writes of one update
+ * (possibly for several devices) and reorders them so that successive
+ * address/data words differ in as few pins as possible. Writes to the same
+ * region keep their submission order, so a device never sees its registers
+ * change in a different sequence; only writes of different devices are
+ * interleaved. Fewer toggles means less switching on the bus lines and
+ * fewer GPIO register writes. iom_fpga_itf_read_batch() reads a run of
+ * consecutive registers (e.g. the nine push switches) under one bus grant,
+ * switching the data pins to input and back once for the whole run.
+ *
+ * Statistics: every transaction is counted per address region (one region
+ * per peripheral plus "other") with writes, reads, bytes, pin toggles,
+ * total busy time, the longest transaction, the time spent throttled by
+ * the budget, and the writes parked by coalescing and eliminated by it.
+ * Batches also count how many toggles the reordering saved against the
+ * submission order, and each class counts its bus grants, the queueing
+ * delay before them and how often it was preempted. The counters are
+ * per-CPU, so the hot path only disables preemption around a few plain
+ * adds; readers sum all CPUs. The device drivers register their own
+ * counters through fpga_interface.h.
+ *   /sys/kernel/debug/fpga/bus, devices, scenes : tables
+ *   /sys/kernel/fpga/bus/<region>/      : writes reads bytes toggles busy_ns max_ns throttled_ns
+ *                                         deferred coalesced
+ *                                         class budget_bps coalesce (writable)
+ *   /sys/kernel/fpga/bus/               : batches batch_writes batch_toggles toggles_saved
+ *                                         flushes, flush (write)
+ *   /sys/kernel/fpga/bus/classes/<class>/ : grants wait_ns max_wait_ns preempted
+ *   /sys/kernel/fpga/compositor/        : ticks commits bytes max_bytes elided commit_ns
+ *                                         max_commit_ns overruns, hz (writable)
+ *   /sys/kernel/fpga/devices/<name>/    : opens busy writes reads short_writes faults
+ *   /sys/kernel/fpga/reset, /sys/kernel/debug/fpga/reset : write to clear all
+ * The bus is 8 bits wide, so bytes always equals writes + reads.
+ *
+ * Device commands: the output drivers register an encoder per device
+ * (fpga_cmd_register) and hand FPGA_IOC_SUBMIT ioctls and io_uring
+ * commands on their files to fpga_cmd_ioctl()/fpga_cmd_uring_cmd(). A
+ * batch of commands (fpga_ioctl.h) for any registered devices is encoded
+ * completely, then sent as one bus batch, so updating LED, FND, dot and
+ * LCD together costs one syscall. The ioctl runs in the caller; io_uring
+ * commands copy the batch at submission and run on an ordered workqueue,
+ * so the submitter never sleeps on the bus and completions arrive in
+ * submission order. Scenes (FPGA_IOC_SCENE_SET/ACTIVATE) are command
+ * batches stored in encoded form; activating one sends only the registers
+ * whose last bus value differs, see fpga_ioctl.h.
+ *
+ * Status page: the last value on the bus of every peripheral register,
+ * with an update counter and timestamp per peripheral, is kept in one page
+ * (fpga_status.h) that user space maps read-only from /dev/fpga_status.
+ * The page is updated by whoever holds the bus, once per transaction or
+ * batch chunk, inside a seqcount, so a monitor can sample the LED, FND,
+ * dot and LCD state at any rate with no syscall and no bus read.
+ *
+ * Tracing: this module defines the fpga:fpga_dev_write tracepoint
+ * (fpga_trace.h) that the device drivers fire after each write, tagged
+ * with the frame cookie libfpga passes as the pwrite() offset.
  */
 #include <linux/module.h>
+#include <linux/moduleparam.h>
 #include <linux/kernel.h>
 #include <linux/fs.h>
+#include <linux/bitmap.h>
+#include <linux/bitops.h>
 #include <linux/delay.h>
 #include <linux/io.h>
 #include <linux/uaccess.h>
+#include <linux/debugfs.h>
+#include <linux/hrtimer.h>
+#include <linux/kobject.h>
+#include <linux/list.h>
+#include <linux/miscdevice.h>
+#include <linux/mm.h>
+#include <linux/version.h>
+#include <linux/ktime.h>
+#include <linux/mutex.h>
+#include <linux/percpu.h>
+#include <linux/sched.h>
+#include <linux/seq_file.h>
+#include <linux/slab.h>
+#include <linux/spinlock.h>
+#include <linux/sysfs.h>
+#include <linux/u64_stats_sync.h>
+#include <linux/wait.h>
+#include <linux/workqueue.h>
+
+#include "fpga_interface.h"
+#include "fpga_status.h"
+
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(6, 7, 0)
+#include <linux/io_uring/cmd.h>
+#else
+#include <linux/io_uring.h>
+#endif
+
+#define CREATE_TRACE_POINTS
+#include "fpga_trace.h"
 
 /* RPi 4B BCM2711 GPIO Base Address */
 #define GPIO_BASE    0xfe200000
@@ -30,6 +174,9 @@
 #define GPCLR0       0x28
 #define GPLEV0       0x34
 
+/* FPGA 주소 버스 폭 (A1~A11) */
+#define FPGA_ADDRESS_SPACE (1 << 11)
+
 /* 제어 신호 인덱스 정의 */
 #define CTRL_nWE    0
 #define CTRL_nOE    1
@@ -38,8 +185,159 @@
 /* 함수 프로토타입 선언 */
 static int __init iom_fpga_itf_init(void);
 static void __exit iom_fpga_itf_exit(void);
-ssize_t iom_fpga_itf_write(unsigned int addr, unsigned char value);
-unsigned char iom_fpga_itf_read(unsigned int addr);
+
+static bool sim;
+module_param(sim, bool, 0444);
+MODULE_PARM_DESC(sim, "Simulate the bus with an in-memory register file instead of GPIO");
+
+static bool verbose = true;
+module_param(verbose, bool, 0644);
+MODULE_PARM_DESC(verbose, "Log every bus transaction (default on)");
+
+static bool reorder = true;
+module_param(reorder, bool, 0644);
+MODULE_PARM_DESC(reorder, "Reorder batched writes of different devices to minimise pin toggles (default on)");
+
+/* 배치 하나에서 한 번에 순서를 정하는 쓰기 수, 더 길면 나눠서 보낸다 */
+#define ITF_BATCH_MAX 64
+#define ITF_NONE 0xff
+
+/* sim=1 일 때의 레지스터 파일 */
+static unsigned char sim_regs[FPGA_ADDRESS_SPACE];
+
+/* 버스 우선순위 클래스, 숫자가 작을수록 먼저 */
+enum itf_class {
+    ITF_CLASS_INPUT,    // 버튼/스위치 샘플
+    ITF_CLASS_ACTUATE,  // 짧은 출력 (LED, FND, 부저, 모터)
+    ITF_CLASS_BULK,     // 큰 화면 갱신, 트랜잭션 사이에서 양보한다
+    ITF_CLASS_COUNT,
+};
+
+static const char *const itf_class_names[ITF_CLASS_COUNT] = { "input", "actuate", "bulk" };
+
+/* 주변장치별 주소 영역 (통계, 우선순위, 예산), 어디에도 속하지 않는 주소는 "other" */
+static const struct itf_region {
+    const char *name;
+    unsigned int first, last;
+    enum itf_class class;  // 기본 클래스 (sysfs 로 바꿀 수 있다)
+    bool composited;       // 컴포지터를 켜면 백 버퍼로 가는 화면 영역
+} itf_regions[] = {
+    { "dip_switch",  0x000, 0x000, ITF_CLASS_INPUT,   false },
+    { "fnd",         0x003, 0x004, ITF_CLASS_ACTUATE, true },
+    { "step_motor",  0x00C, 0x010, ITF_CLASS_ACTUATE, false },
+    { "led",         0x016, 0x016, ITF_CLASS_ACTUATE, true },
+    { "push_switch", 0x050, 0x058, ITF_CLASS_INPUT,   false },
+    { "buzzer",      0x070, 0x070, ITF_CLASS_ACTUATE, false },
+    { "text_lcd",    0x090, 0x0AF, ITF_CLASS_BULK,    true },
+    { "dot",         0x210, 0x219, ITF_CLASS_BULK,    true },
+    { "other",       1, 0, ITF_CLASS_ACTUATE,         false },
+};
+
+#define ITF_REGION_COUNT ARRAY_SIZE(itf_regions)
+#define ITF_REGION_OTHER (ITF_REGION_COUNT - 1)
+
+struct itf_region_counters {
+    u64 writes;
+    u64 reads;
+    u64 toggles;  // 주소/데이터 핀이 바뀐 횟수
+    u64 busy_ns;
+    u64 max_ns;
+    u64 throttled_ns;  // 예산을 넘어서 잔 시간
+    u64 deferred;      // 합치기 창에 넣은 쓰기
+    u64 coalesced;     // 그중 버스에 나가기 전에 덮어써져 없어진 쓰기
+};
+
+struct itf_class_counters {
+    u64 grants;
+    u64 wait_ns;      // 버스를 요청해서 받을 때까지 (큐 지연)
+    u64 max_wait_ns;
+    u64 preempted;    // 더 급한 클래스에 버스를 넘겨준 횟수
+};
+
+struct itf_batch_counters {
+    u64 batches;
+    u64 writes;
+    u64 toggles;
+    u64 saved;    // 제출 순서대로 보냈을 때보다 줄어든 토글 수
+    u64 flushes;  // 합치기 창을 비운 횟수
+};
+
+/* CPU 마다 하나, 자기 CPU 의 것만 갱신한다 */
+struct itf_cpu_stats {
+    struct u64_stats_sync syncp;
+    struct itf_region_counters region[ITF_REGION_COUNT];
+    struct itf_batch_counters batch;
+    struct itf_class_counters class[ITF_CLASS_COUNT];
+};
+
+static DEFINE_PER_CPU(struct itf_cpu_stats, itf_stats);
+static u8 itf_region_map[FPGA_ADDRESS_SPACE]; // 주소 -> 영역 번호
+static u8 itf_region_class[ITF_REGION_COUNT];  // 영역 -> 지금 클래스
+
+/* mmap 상태 페이지, 버스를 가진 쪽만 고친다 */
+static struct fpga_status *itf_status;
+static DECLARE_BITMAP(itf_known, FPGA_ADDRESS_SPACE);  // 상태 페이지 값이 버스 값인 주소
+#define STATUS_FIELD(field) offsetof(struct fpga_status, field)
+static const u16 itf_status_offset[FPGA_STATUS_REGIONS] = {
+    STATUS_FIELD(dip_switch), STATUS_FIELD(fnd), STATUS_FIELD(step_motor), STATUS_FIELD(led),
+    STATUS_FIELD(push_switch), STATUS_FIELD(buzzer), STATUS_FIELD(text_lcd), STATUS_FIELD(dot),
+};
+
+/* 영역별 초당 바이트 예산 (토큰 버킷) */
+struct itf_budget {
+    u32 bps;      // 0 이면 무제한
+    u64 credit;   // 남은 바이트 * NSEC_PER_SEC
+    u64 last_ns;  // 마지막으로 채운 시각
+};
+
+static struct itf_budget itf_budgets[ITF_REGION_COUNT];
+static DEFINE_SPINLOCK(itf_budget_lock);
+
+/*
+ * 쓰기 합치기: 켠 영역의 쓰기는 주소마다 마지막 값만 남겨 두었다가 한 배치로 보낸다.
+ * coalesce_order 는 처음 들어온 순서 (같은 디바이스 안의 순서를 되도록 지킨다).
+ */
+static int itf_coalesce_us[ITF_REGION_COUNT];  // 창 길이, -1 이면 끔
+static bool itf_coalescing;                    // 켠 영역이 하나라도 있는지
+static DEFINE_SPINLOCK(itf_coalesce_lock);
+static DECLARE_BITMAP(coalesce_pending, FPGA_ADDRESS_SPACE);
+static u8 coalesce_value[FPGA_ADDRESS_SPACE];
+static u16 coalesce_order[FPGA_ADDRESS_SPACE];
+static unsigned int coalesce_count;
+static u64 coalesce_deadline;                  // 걸어 둔 flush 시각, 0 이면 없음
+static struct hrtimer coalesce_timer;
+static struct work_struct coalesce_work;
+static DEFINE_MUTEX(coalesce_flush_lock);      // flush 끼리 순서가 뒤집히지 않게
+static struct fpga_bus_write coalesce_tx[FPGA_ADDRESS_SPACE];
+
+/*
+ * 컴포지터: 켜면 화면 영역의 쓰기는 백 버퍼 (comp_value) 에 남고, 틱마다 바뀐
+ * 레지스터를 한 배치로 보낸다. 화면 영역은 모두 합쳐 45 바이트라 배치 하나에 들어간다.
+ */
+#define ITF_COMP_MAX_HZ 1000
+
+struct itf_comp_counters {
+    u64 ticks;
+    u64 commits;        // 보낼 것이 있던 커밋
+    u64 bytes;          // 보낸 쓰기
+    u64 max_bytes;      // 커밋 하나의 최대
+    u64 elided;         // 버스 값과 같아서 뺀 쓰기
+    u64 commit_ns;      // 백 버퍼를 가져와서 배치가 끝날 때까지
+    u64 max_commit_ns;
+    u64 overruns;       // 한 주기보다 오래 걸린 틱
+};
+
+static unsigned int itf_comp_hz;               // 0 이면 끔
+static u64 comp_period_ns;
+static bool itf_compositing;                   // itf_comp_lock 안에서 바꾼다
+static DEFINE_SPINLOCK(itf_comp_lock);
+static DECLARE_BITMAP(comp_pending, FPGA_ADDRESS_SPACE);
+static u8 comp_value[FPGA_ADDRESS_SPACE];
+static struct hrtimer comp_timer;
+static struct work_struct comp_work;
+static DEFINE_MUTEX(comp_commit_lock);         // 커밋끼리 순서와 comp_stats 를 지킨다
+static DEFINE_MUTEX(comp_ctl_lock);            // hz 바꾸기
+static struct itf_comp_counters comp_stats;
 
 /* GPIO 핀 번호 정의 */
 static const int address_gpios[] = { 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21 };
@@ -49,6 +347,23 @@ static const int control_gpios[] = { 22, 23, 25 }; // nWE, nOE, nCS 순서
 /* I/O Memory 포인터 */
 static void __iomem *gpio_regs;
 
+/*
+ * 버스 중재: itf_bus_busy 는 지금 버스를 가진 쪽이 있는지, itf_bus_waiting 은
+ * 클래스별로 기다리는 수. 버스를 가진 동안에는 잠들어도 된다 (udelay 만 쓴다).
+ */
+static DEFINE_SPINLOCK(itf_bus_lock);
+static DECLARE_WAIT_QUEUE_HEAD(itf_bus_wq);
+static bool itf_bus_busy;
+static unsigned int itf_bus_waiting[ITF_CLASS_COUNT];
+
+/*
+ * 주소/데이터 핀의 현재 레벨 (GPIO 번호 = 비트 번호, 모두 GPSET0/GPCLR0 에 있다).
+ * sim=1 에서도 같은 상태를 따라가므로 토글 통계는 백엔드와 무관하다.
+ * 버스를 가진 쪽만 건드린다.
+ */
+static u32 bus_pins;
+static u32 address_mask, data_mask;
+
 /* Low-level GPIO functions */
 static void set_gpio_output(int pin) {
     u32 reg_index = pin / 10;
@@ -86,86 +401,2145 @@ static int get_gpio_value(int pin) {
     return (readl(gpio_regs + GPLEV0 + (reg_index * 4)) >> bit) & 1;
 }
 
-ssize_t iom_fpga_itf_write(unsigned int addr, unsigned char value)
+// 주소/데이터 버스에 addr, value 를 올렸을 때의 핀 레벨
+static u32 itf_bus_pins(unsigned int addr, unsigned char value)
 {
+    u32 pins = 0;
     int i;
-    // A0는 하드웨어 풀다운에 의해 LOW로 간주, 주소 버스는 A1부터 시작
-    unsigned int effective_addr = addr << 1;
 
-    pr_info("FPGA WRITE: address = 0x%x, data = 0x%x \n", addr, value);
+    // A0는 하드웨어 풀다운에 의해 LOW로 간주, 주소 버스는 A1부터 시작 (핀 i = addr 비트 i)
+    for (i = 0; i < ARRAY_SIZE(address_gpios); i++)
+        if ((addr >> i) & 0x1)
+            pins |= BIT(address_gpios[i]);
+    for (i = 0; i < ARRAY_SIZE(data_gpios); i++)
+        if ((value >> i) & 0x1)
+            pins |= BIT(data_gpios[i]);
+    return pins;
+}
 
-    for (i = 0; i < ARRAY_SIZE(address_gpios); i++) {
-        set_gpio_value(address_gpios[i], (effective_addr >> (i + 1)) & 0x1);
+/* mask 안에서 pins 와 다른 핀만 바꾸고, 바뀐 핀 수를 돌려준다 (버스를 가진 쪽에서) */
+static unsigned int itf_bus_drive(u32 pins, u32 mask)
+{
+    u32 change = (bus_pins ^ pins) & mask;
+
+    if (!sim) {
+        if (change & pins)
+            writel(change & pins, gpio_regs + GPSET0);
+        if (change & ~pins)
+            writel(change & ~pins, gpio_regs + GPCLR0);
     }
-    for (i = 0; i < ARRAY_SIZE(data_gpios); i++) {
-        set_gpio_value(data_gpios[i], (value >> i) & 0x1);
+    bus_pins ^= change;
+    return hweight32(change);
+}
+
+/* 트랜잭션 하나를 이 CPU 의 카운터에 더한다 */
+static void itf_account(unsigned int addr, bool write, unsigned int toggles, u64 start)
+{
+    u64 ns = ktime_get_ns() - start;
+    struct itf_cpu_stats *s = get_cpu_ptr(&itf_stats);
+    struct itf_region_counters *c = &s->region[itf_region_map[addr & (FPGA_ADDRESS_SPACE - 1)]];
+
+    u64_stats_update_begin(&s->syncp);
+    if (write)
+        c->writes++;
+    else
+        c->reads++;
+    c->toggles += toggles;
+    c->busy_ns += ns;
+    if (ns > c->max_ns)
+        c->max_ns = ns;
+    u64_stats_update_end(&s->syncp);
+    put_cpu_ptr(&itf_stats);
+}
+
+static void itf_account_batch(unsigned int writes, unsigned int toggles, unsigned int saved)
+{
+    struct itf_cpu_stats *s = get_cpu_ptr(&itf_stats);
+
+    u64_stats_update_begin(&s->syncp);
+    s->batch.batches++;
+    s->batch.writes += writes;
+    s->batch.toggles += toggles;
+    s->batch.saved += saved;
+    u64_stats_update_end(&s->syncp);
+    put_cpu_ptr(&itf_stats);
+}
+
+static void itf_account_grant(int class, u64 wait_ns, bool preempted)
+{
+    struct itf_cpu_stats *s = get_cpu_ptr(&itf_stats);
+    struct itf_class_counters *c = &s->class[class];
+
+    u64_stats_update_begin(&s->syncp);
+    c->grants++;
+    c->wait_ns += wait_ns;
+    if (wait_ns > c->max_wait_ns)
+        c->max_wait_ns = wait_ns;
+    if (preempted)
+        c->preempted++;
+    u64_stats_update_end(&s->syncp);
+    put_cpu_ptr(&itf_stats);
+}
+
+static void itf_account_throttle(int r, u64 ns)
+{
+    struct itf_cpu_stats *s = get_cpu_ptr(&itf_stats);
+
+    u64_stats_update_begin(&s->syncp);
+    s->region[r].throttled_ns += ns;
+    u64_stats_update_end(&s->syncp);
+    put_cpu_ptr(&itf_stats);
+}
+
+static void itf_account_deferred(int r, bool coalesced)
+{
+    struct itf_cpu_stats *s = get_cpu_ptr(&itf_stats);
+
+    u64_stats_update_begin(&s->syncp);
+    s->region[r].deferred++;
+    if (coalesced)
+        s->region[r].coalesced++;
+    u64_stats_update_end(&s->syncp);
+    put_cpu_ptr(&itf_stats);
+}
+
+static void itf_account_flush(void)
+{
+    struct itf_cpu_stats *s = get_cpu_ptr(&itf_stats);
+
+    u64_stats_update_begin(&s->syncp);
+    s->batch.flushes++;
+    u64_stats_update_end(&s->syncp);
+    put_cpu_ptr(&itf_stats);
+}
+
+/*
+ * 버스에 실린 값 n 개를 상태 페이지에 옮긴다 (버스를 가진 쪽에서). 같은 주소가
+ * 여러 번 있으면 마지막 값이 남는다. raw_write_seqcount_begin/end 와 같은 순서로
+ * seq 를 올리므로 사용자 공간은 fpga_status.h 의 방법으로 읽는다.
+ */
+static void itf_status_update(const struct fpga_bus_write *tx, unsigned int n)
+{
+    struct fpga_status *st = itf_status;
+    unsigned long touched = 0;
+    unsigned int i, addr, r;
+    u64 now = ktime_get_ns();
+
+    WRITE_ONCE(st->seq, st->seq + 1);
+    smp_wmb();
+    for (i = 0; i < n; i++) {
+        addr = tx[i].addr & (FPGA_ADDRESS_SPACE - 1);
+        r = itf_region_map[addr];
+        if (r == ITF_REGION_OTHER)
+            continue;
+        ((u8 *)st)[itf_status_offset[r] + addr - itf_regions[r].first] = tx[i].value;
+        set_bit(addr, itf_known);
+        touched |= BIT(r);
+    }
+    for_each_set_bit(r, &touched, FPGA_STATUS_REGIONS) {
+        st->region[r].updates++;
+        st->region[r].updated_ns = now;
+    }
+    st->updates++;
+    smp_wmb();
+    WRITE_ONCE(st->seq, st->seq + 1);
+}
+
+/* itf_bus_lock 안에서: 버스가 비었고 더 급한 클래스가 기다리지 않으면 가진다 */
+static bool itf_bus_grant(int class)
+{
+    int c;
+
+    if (itf_bus_busy)
+        return false;
+    for (c = 0; c < class; c++)
+        if (itf_bus_waiting[c])
+            return false;
+    itf_bus_busy = true;
+    return true;
+}
+
+static void itf_bus_acquire(int class, bool preempted)
+{
+    u64 start = ktime_get_ns();
+
+    spin_lock(&itf_bus_lock);
+    if (!itf_bus_grant(class)) {
+        itf_bus_waiting[class]++;
+        wait_event_cmd(itf_bus_wq, itf_bus_grant(class),
+                       spin_unlock(&itf_bus_lock), spin_lock(&itf_bus_lock));
+        itf_bus_waiting[class]--;
+    }
+    spin_unlock(&itf_bus_lock);
+    itf_account_grant(class, ktime_get_ns() - start, preempted);
+}
+
+static void itf_bus_release(void)
+{
+    spin_lock(&itf_bus_lock);
+    itf_bus_busy = false;
+    spin_unlock(&itf_bus_lock);
+    // 깨어난 쪽 중 가장 급한 클래스만 itf_bus_grant() 를 통과한다
+    wake_up_all(&itf_bus_wq);
+}
+
+/* 트랜잭션 사이에서: 더 급한 클래스가 기다리면 버스를 넘겨주고 다시 줄을 선다 */
+static void itf_bus_yield(int class)
+{
+    int c;
+
+    for (c = 0; c < class; c++) {
+        if (READ_ONCE(itf_bus_waiting[c])) {
+            itf_bus_release();
+            itf_bus_acquire(class, true);
+            return;
+        }
+    }
+}
+
+/* 영역 r 에 bytes 만큼 예산이 생길 때까지 잔다 (버스를 요청하기 전에) */
+static void itf_budget_wait(int r, unsigned int bytes)
+{
+    struct itf_budget *b = &itf_budgets[r];
+    u64 now, need, burst, delay, start = 0;
+
+    if (!READ_ONCE(b->bps))
+        return;
+
+    for (;;) {
+        spin_lock(&itf_budget_lock);
+        if (!b->bps) {
+            spin_unlock(&itf_budget_lock);
+            break;
+        }
+        // 100ms 만큼 모아 둘 수 있고, 배치 하나는 언제나 들어간다
+        now = ktime_get_ns();
+        burst = (u64)max_t(u32, b->bps / 10, ITF_BATCH_MAX) * NSEC_PER_SEC;
+        b->credit = min(burst, b->credit + min_t(u64, now - b->last_ns, NSEC_PER_SEC) * b->bps);
+        b->last_ns = now;
+        need = (u64)bytes * NSEC_PER_SEC;
+        if (b->credit >= need) {
+            b->credit -= need;
+            spin_unlock(&itf_budget_lock);
+            break;
+        }
+        delay = div_u64(need - b->credit, b->bps);
+        spin_unlock(&itf_budget_lock);
+
+        if (!start)
+            start = now;
+        fsleep(div_u64(delay, NSEC_PER_USEC) + 1);
+    }
+
+    if (start)
+        itf_account_throttle(r, ktime_get_ns() - start);
+}
+
+/* addr 의 마지막 버스 값, 모르면 false */
+static bool itf_bus_value(unsigned int addr, u8 *value)
+{
+    int r;
+
+    addr &= FPGA_ADDRESS_SPACE - 1;
+    r = itf_region_map[addr];
+    if (r == ITF_REGION_OTHER || !test_bit(addr, itf_known))
+        return false;
+    *value = READ_ONCE(((u8 *)itf_status)[itf_status_offset[r] + addr - itf_regions[r].first]);
+    return true;
+}
+
+/* addr 가 곧 가질 값: 백 버퍼에 남은 값, 없으면 버스 값 (장면 비교용) */
+static bool itf_shadow_get(unsigned int addr, u8 *value)
+{
+    bool pending = false;
+
+    addr &= FPGA_ADDRESS_SPACE - 1;
+    if (READ_ONCE(itf_compositing)) {
+        spin_lock(&itf_comp_lock);
+        pending = test_bit(addr, comp_pending);
+        if (pending)
+            *value = comp_value[addr];
+        spin_unlock(&itf_comp_lock);
+    }
+    return pending || itf_bus_value(addr, value);
+}
+
+static int itf_class_of(unsigned int addr)
+{
+    return READ_ONCE(itf_region_class[itf_region_map[addr & (FPGA_ADDRESS_SPACE - 1)]]);
+}
+
+/* 쓰기 트랜잭션 하나, 바뀐 핀 수를 돌려준다 (버스를 가진 쪽에서) */
+static unsigned int itf_write_locked(unsigned int addr, unsigned char value)
+{
+    unsigned int toggles;
+    u64 start = ktime_get_ns();
+
+    if (verbose)
+        pr_info("FPGA WRITE: address = 0x%x, data = 0x%x \n", addr, value);
+
+    toggles = itf_bus_drive(itf_bus_pins(addr, value), address_mask | data_mask);
+    if (sim) {
+        WRITE_ONCE(sim_regs[addr & (FPGA_ADDRESS_SPACE - 1)], value);
+    } else {
+        set_gpio_value(control_gpios[CTRL_nCS], 0); udelay(1);
+        set_gpio_value(control_gpios[CTRL_nWE], 0); udelay(5);
+        set_gpio_value(control_gpios[CTRL_nWE], 1);
+        set_gpio_value(control_gpios[CTRL_nCS], 1);
+    }
+
+    itf_account(addr, true, toggles, start);
+    return toggles;
+}
+
+static unsigned int itf_write_batch_direct(const struct fpga_bus_write *tx, unsigned int n);
+
+/*
+ * 합치기를 켠 영역의 쓰기면 대기표에 넣고 true. 같은 주소가 이미 있으면 값만 바꾼다.
+ * 대기표가 비어 있었거나 이 영역의 창이 더 일찍 끝나면 flush 시각을 당긴다.
+ */
+static bool itf_coalesce_park(unsigned int addr, unsigned char value)
+{
+    int r = itf_region_map[addr & (FPGA_ADDRESS_SPACE - 1)];
+    int us = READ_ONCE(itf_coalesce_us[r]);
+    bool replaced, now = false;
+    u64 deadline;
+
+    if (us < 0)
+        return false;
+
+    addr &= FPGA_ADDRESS_SPACE - 1;
+    deadline = ktime_get_ns() + (u64)us * NSEC_PER_USEC;
+
+    spin_lock(&itf_coalesce_lock);
+    replaced = __test_and_set_bit(addr, coalesce_pending);
+    if (!replaced)
+        coalesce_order[coalesce_count++] = addr;
+    coalesce_value[addr] = value;
+    if (!coalesce_deadline || deadline < coalesce_deadline) {
+        coalesce_deadline = deadline;
+        if (us)
+            hrtimer_start(&coalesce_timer, ns_to_ktime(deadline), HRTIMER_MODE_ABS);
+        else
+            now = true;
+    }
+    spin_unlock(&itf_coalesce_lock);
+
+    if (now)
+        queue_work(system_highpri_wq, &coalesce_work);
+    itf_account_deferred(r, replaced);
+    return true;
+}
+
+/* 대기 중인 쓰기를 모두 한 배치로 보낸다 (잠들 수 있다) */
+static void itf_coalesce_flush(void)
+{
+    unsigned int i, n;
+    u16 addr;
+
+    mutex_lock(&coalesce_flush_lock);
+    spin_lock(&itf_coalesce_lock);
+    n = coalesce_count;
+    for (i = 0; i < n; i++) {
+        addr = coalesce_order[i];
+        coalesce_tx[i].addr = addr;
+        coalesce_tx[i].value = coalesce_value[addr];
+        __clear_bit(addr, coalesce_pending);
+    }
+    coalesce_count = 0;
+    coalesce_deadline = 0;
+    spin_unlock(&itf_coalesce_lock);
+
+    if (n) {
+        itf_write_batch_direct(coalesce_tx, n);
+        itf_account_flush();
+    }
+    mutex_unlock(&coalesce_flush_lock);
+}
+
+static void itf_coalesce_work_fn(struct work_struct *work)
+{
+    itf_coalesce_flush();
+}
+
+static enum hrtimer_restart itf_coalesce_timer_fn(struct hrtimer *timer)
+{
+    queue_work(system_highpri_wq, &coalesce_work);
+    return HRTIMER_NORESTART;
+}
+
+static bool itf_composited(unsigned int addr)
+{
+    return itf_regions[itf_region_map[addr & (FPGA_ADDRESS_SPACE - 1)]].composited;
+}
+
+/*
+ * 컴포지터가 켜져 있으면 tx 중 화면 영역의 쓰기를 모두 한 번에 백 버퍼에 넣고
+ * true (틱이 배치 중간에 끼지 않는다). 같은 주소는 마지막 값이 남는다.
+ */
+static bool itf_comp_park_batch(const struct fpga_bus_write *tx, unsigned int n)
+{
+    unsigned int i, addr;
+    bool on, replaced;
+
+    if (!READ_ONCE(itf_compositing))
+        return false;
+
+    spin_lock(&itf_comp_lock);
+    on = itf_compositing;
+    for (i = 0; on && i < n; i++) {
+        addr = tx[i].addr & (FPGA_ADDRESS_SPACE - 1);
+        if (!itf_composited(addr))
+            continue;
+        replaced = __test_and_set_bit(addr, comp_pending);
+        comp_value[addr] = tx[i].value;
+        itf_account_deferred(itf_region_map[addr], replaced);
+    }
+    spin_unlock(&itf_comp_lock);
+    return on;
+}
+
+/*
+ * 백 버퍼의 바뀐 레지스터를 꺼내서 버스 값과 다른 것만 한 배치로 보낸다 (잠들 수
+ * 있다). tick 이면 틱 작업에서 부른 것이다.
+ */
+static void itf_comp_commit(bool tick)
+{
+    struct fpga_bus_write tx[ITF_BATCH_MAX];
+    unsigned int addr, i, n = 0, k = 0;
+    u64 start, ns;
+    u8 value;
+    int r;
+
+    mutex_lock(&comp_commit_lock);
+    start = ktime_get_ns();
+    spin_lock(&itf_comp_lock);
+    for (r = 0; r < ITF_REGION_OTHER; r++) {
+        if (!itf_regions[r].composited)
+            continue;
+        for (addr = itf_regions[r].first; addr <= itf_regions[r].last && n < ITF_BATCH_MAX; addr++) {
+            if (!__test_and_clear_bit(addr, comp_pending))
+                continue;
+            tx[n].addr = addr;
+            tx[n].value = comp_value[addr];
+            n++;
+        }
+    }
+    spin_unlock(&itf_comp_lock);
+
+    // 같은 값으로 되돌려 놓은 레지스터는 버스에 내보내지 않는다
+    for (i = 0; i < n; i++) {
+        if (itf_bus_value(tx[i].addr, &value) && value == tx[i].value)
+            continue;
+        tx[k++] = tx[i];
+    }
+    if (k)
+        itf_write_batch_direct(tx, k);
+    ns = ktime_get_ns() - start;
+
+    if (tick)
+        comp_stats.ticks++;
+    comp_stats.elided += n - k;
+    if (k) {
+        comp_stats.commits++;
+        comp_stats.bytes += k;
+        comp_stats.max_bytes = max_t(u64, comp_stats.max_bytes, k);
+        comp_stats.commit_ns += ns;
+        comp_stats.max_commit_ns = max(comp_stats.max_commit_ns, ns);
+    }
+    if (tick && ns > READ_ONCE(comp_period_ns))
+        comp_stats.overruns++;
+    if (n)
+        trace_fpga_compose(comp_stats.ticks, k, n - k, ns);
+    mutex_unlock(&comp_commit_lock);
+}
+
+static void itf_comp_work_fn(struct work_struct *work)
+{
+    itf_comp_commit(true);
+}
+
+static enum hrtimer_restart itf_comp_timer_fn(struct hrtimer *timer)
+{
+    // 작업이 밀려 있으면 queue_work 는 아무것도 하지 않는다 (그 틱은 다음 커밋에 합쳐진다)
+    hrtimer_forward_now(timer, ns_to_ktime(READ_ONCE(comp_period_ns)));
+    queue_work(system_highpri_wq, &comp_work);
+    return HRTIMER_RESTART;
+}
+
+/* 0 이면 끄고 남은 백 버퍼를 보낸다 */
+static int itf_comp_set_hz(unsigned int hz)
+{
+    if (hz > ITF_COMP_MAX_HZ)
+        return -EINVAL;
+
+    mutex_lock(&comp_ctl_lock);
+    hrtimer_cancel(&comp_timer);
+    WRITE_ONCE(itf_comp_hz, hz);
+    spin_lock(&itf_comp_lock);
+    WRITE_ONCE(itf_compositing, hz != 0);
+    spin_unlock(&itf_comp_lock);
+
+    if (hz) {
+        WRITE_ONCE(comp_period_ns, div_u64(NSEC_PER_SEC, hz));
+        // 합치기 창에 남은 화면 쓰기가 백 버퍼의 새 값보다 늦게 나가지 않게
+        itf_coalesce_flush();
+        hrtimer_start(&comp_timer, ns_to_ktime(comp_period_ns), HRTIMER_MODE_REL);
+    } else {
+        cancel_work_sync(&comp_work);
+        itf_comp_commit(false);
+    }
+    mutex_unlock(&comp_ctl_lock);
+    return 0;
+}
+
+static void itf_comp_reset(void)
+{
+    mutex_lock(&comp_commit_lock);
+    memset(&comp_stats, 0, sizeof(comp_stats));
+    mutex_unlock(&comp_commit_lock);
+}
+
+// 합치기 창에 남은 쓰기를 지금 버스로 보낸다 (드라이버가 갱신 끝을 알릴 때)
+void iom_fpga_itf_flush(void)
+{
+    if (READ_ONCE(itf_coalescing))
+        itf_coalesce_flush();
+}
+EXPORT_SYMBOL(iom_fpga_itf_flush);
+
+/*
+ * addr 가 곧 가질 값을 버스를 건드리지 않고 돌려준다: 합치기 창이나 백 버퍼에 남은 값,
+ * 없으면 마지막 버스 값. 한 번도 쓰거나 읽지 않은 주소면 false.
+ */
+bool iom_fpga_itf_shadow(unsigned int addr, unsigned char *value)
+{
+    bool parked = false;
+
+    addr &= FPGA_ADDRESS_SPACE - 1;
+    if (READ_ONCE(itf_coalescing)) {
+        spin_lock(&itf_coalesce_lock);
+        parked = test_bit(addr, coalesce_pending);
+        if (parked)
+            *value = coalesce_value[addr];
+        spin_unlock(&itf_coalesce_lock);
     }
+    return parked || itf_shadow_get(addr, (u8 *)value);
+}
+EXPORT_SYMBOL(iom_fpga_itf_shadow);
 
-    set_gpio_value(control_gpios[CTRL_nCS], 0); udelay(1);
-    set_gpio_value(control_gpios[CTRL_nWE], 0); udelay(5);
-    set_gpio_value(control_gpios[CTRL_nWE], 1);
-    set_gpio_value(control_gpios[CTRL_nCS], 1);
+ssize_t iom_fpga_itf_write(unsigned int addr, unsigned char value)
+{
+    struct fpga_bus_write tx = { .addr = addr, .value = value };
 
+    if (itf_comp_park_batch(&tx, 1) && itf_composited(addr))
+        return 1;
+    if (READ_ONCE(itf_coalescing) && itf_coalesce_park(addr, value))
+        return 1;
+
+    itf_budget_wait(itf_region_map[addr & (FPGA_ADDRESS_SPACE - 1)], 1);
+    itf_bus_acquire(itf_class_of(addr), false);
+    itf_write_locked(addr, value);
+    itf_status_update(&tx, 1);
+    itf_bus_release();
     return 1;
 }
 EXPORT_SYMBOL(iom_fpga_itf_write);
 
-unsigned char iom_fpga_itf_read(unsigned int addr)
+/* 읽기 전에: 읽을 주소에 아직 버스에 나가지 않은 값이 있으면 먼저 보낸다 */
+static void itf_read_prepare(unsigned int addr, unsigned int n)
 {
-    unsigned char value = 0;
-    int i;
-    unsigned int effective_addr = addr << 1;
+    bool coalesced = false, composited = false;
+    unsigned int i, a;
 
-    pr_info("FPGA READ: address = 0x%x\n", addr);
-    
-    for (i = 0; i < ARRAY_SIZE(address_gpios); i++) {
-        set_gpio_value(address_gpios[i], (effective_addr >> (i + 1)) & 0x1);
+    for (i = 0; i < n; i++) {
+        a = (addr + i) & (FPGA_ADDRESS_SPACE - 1);
+        coalesced |= READ_ONCE(itf_coalescing) && test_bit(a, coalesce_pending);
+        composited |= READ_ONCE(itf_compositing) && test_bit(a, comp_pending);
     }
+    if (coalesced)
+        itf_coalesce_flush();
+    if (composited)
+        itf_comp_commit(false);
+}
 
-    for (i = 0; i < ARRAY_SIZE(data_gpios); i++) {
-        set_gpio_input(data_gpios[i]);
+/*
+ * addr 부터 n 개를 읽는다 (버스를 가진 쪽에서). 데이터 핀은 처음에 한 번 입력으로
+ * 돌리고 끝에 한 번 출력으로 되돌린다, 출력 래치는 그대로 남는다.
+ */
+static void itf_read_locked(unsigned int addr, unsigned char *buf, unsigned int n)
+{
+    unsigned char value;
+    unsigned int i, toggles;
+    int k;
+    u64 start;
+
+    if (!sim) {
+        for (k = 0; k < ARRAY_SIZE(data_gpios); k++)
+            set_gpio_input(data_gpios[k]);
     }
 
-    set_gpio_value(control_gpios[CTRL_nCS], 0); udelay(1);
-    set_gpio_value(control_gpios[CTRL_nOE], 0); udelay(1);
+    for (i = 0; i < n; i++, addr++) {
+        start = ktime_get_ns();
+        if (verbose)
+            pr_info("FPGA READ: address = 0x%x\n", addr);
+        toggles = itf_bus_drive(itf_bus_pins(addr, 0), address_mask);
 
-    for (i = 0; i < ARRAY_SIZE(data_gpios); i++) {
-        value |= (get_gpio_value(data_gpios[i]) << i);
-    }
+        value = 0;
+        if (sim) {
+            value = READ_ONCE(sim_regs[addr & (FPGA_ADDRESS_SPACE - 1)]);
+        } else {
+            set_gpio_value(control_gpios[CTRL_nCS], 0); udelay(1);
+            set_gpio_value(control_gpios[CTRL_nOE], 0); udelay(1);
+            for (k = 0; k < ARRAY_SIZE(data_gpios); k++)
+                value |= (get_gpio_value(data_gpios[k]) << k);
+            set_gpio_value(control_gpios[CTRL_nOE], 1);
+            set_gpio_value(control_gpios[CTRL_nCS], 1);
+        }
+        buf[i] = value;
 
-    set_gpio_value(control_gpios[CTRL_nOE], 1);
-    set_gpio_value(control_gpios[CTRL_nCS], 1);
+        itf_account(addr, false, toggles, start);
+        if (verbose)
+            pr_info("FPGA READ value = 0x%x\n", value);
+    }
 
-    for (i = 0; i < ARRAY_SIZE(data_gpios); i++) {
-        set_gpio_output(data_gpios[i]);
+    if (!sim) {
+        for (k = 0; k < ARRAY_SIZE(data_gpios); k++)
+            set_gpio_output(data_gpios[k]);
     }
+}
+
+unsigned char iom_fpga_itf_read(unsigned int addr)
+{
+    unsigned char value;
 
-    pr_info("FPGA READ value = 0x%x\n", value);
+    iom_fpga_itf_read_batch(addr, &value, 1);
     return value;
 }
 EXPORT_SYMBOL(iom_fpga_itf_read);
 
-static void __exit iom_fpga_itf_exit(void)
+// addr 부터 n 개 (ITF_BATCH_MAX 까지) 를 버스를 한 번 잡고 읽는다, 돌려주는 값은 n
+int iom_fpga_itf_read_batch(unsigned int addr, unsigned char *buf, unsigned int n)
 {
-    pr_info("exit module: %s\n", __func__);
-    if (gpio_regs) {
-        iounmap(gpio_regs);
+    struct fpga_bus_write seen[ITF_BATCH_MAX];
+    u8 bytes[ITF_REGION_COUNT] = { 0 };
+    unsigned int i;
+    int r, class = ITF_CLASS_BULK;
+
+    if (n == 0 || n > ITF_BATCH_MAX)
+        return -EINVAL;
+
+    itf_read_prepare(addr, n);
+    for (i = 0; i < n; i++) {
+        bytes[itf_region_map[(addr + i) & (FPGA_ADDRESS_SPACE - 1)]]++;
+        class = min(class, itf_class_of(addr + i));
+    }
+    for (r = 0; r < ITF_REGION_COUNT; r++)
+        if (bytes[r])
+            itf_budget_wait(r, bytes[r]);
+
+    itf_bus_acquire(class, false);
+    itf_read_locked(addr, buf, n);
+    for (i = 0; i < n; i++) {
+        seen[i].addr = addr + i;
+        seen[i].value = buf[i];
     }
+    itf_status_update(seen, n);
+    itf_bus_release();
+    return n;
 }
+EXPORT_SYMBOL(iom_fpga_itf_read_batch);
 
-static int __init iom_fpga_itf_init(void)
+/*
+ * 배치 안의 쓰기 순서를 order 에 정한다. 영역(디바이스)마다 제출 순서대로 줄을
+ * 세우고, 매번 각 줄의 맨 앞 쓰기 중 지금 버스 상태와 다른 핀이 가장 적은 것을
+ * 고른다 (같으면 먼저 제출된 것). 욕심쟁이 방식이라 제출 순서보다 나빠질 수도
+ * 있으므로 그때는 제출 순서를 쓴다. 돌려주는 값은 제출 순서 대비 줄인 토글 수.
+ */
+static unsigned int itf_batch_order(const struct fpga_bus_write *tx, unsigned int n, u8 *order)
 {
-    int i;
+    u8 head[ITF_REGION_COUNT], tail[ITF_REGION_COUNT], next[ITF_BATCH_MAX];
+    u32 pins[ITF_BATCH_MAX], state = bus_pins;
+    unsigned int i, k, r, best, best_r, cost, best_cost;
+    unsigned int in_order = 0, greedy = 0;
+
+    memset(head, ITF_NONE, sizeof(head));
+    for (i = 0; i < n; i++) {
+        pins[i] = itf_bus_pins(tx[i].addr, tx[i].value);
+        in_order += hweight32(state ^ pins[i]);
+        state = pins[i];
+
+        r = itf_region_map[tx[i].addr & (FPGA_ADDRESS_SPACE - 1)];
+        next[i] = ITF_NONE;
+        if (head[r] == ITF_NONE)
+            head[r] = i;
+        else
+            next[tail[r]] = i;
+        tail[r] = i;
+    }
+
+    state = bus_pins;
+    for (k = 0; k < n; k++) {
+        best = ITF_NONE;
+        best_r = 0;
+        best_cost = UINT_MAX;
+        for (r = 0; r < ITF_REGION_COUNT; r++) {
+            i = head[r];
+            if (i == ITF_NONE)
+                continue;
+            cost = hweight32(state ^ pins[i]);
+            if (cost < best_cost || (cost == best_cost && i < best)) {
+                best = i;
+                best_r = r;
+                best_cost = cost;
+            }
+        }
+        order[k] = best;
+        head[best_r] = next[best];
+        state = pins[best];
+        greedy += best_cost;
+    }
+
+    if (greedy < in_order)
+        return in_order - greedy;
+    for (k = 0; k < n; k++)
+        order[k] = k;
+    return 0;
+}
+
+static unsigned int itf_write_batch_direct(const struct fpga_bus_write *tx, unsigned int n)
+{
+    u8 order[ITF_BATCH_MAX], bytes[ITF_REGION_COUNT];
+    unsigned int done, chunk, k, r, saved, toggles;
+    int class;
+
+    // 긴 배치는 ITF_BATCH_MAX 씩 나누고, 그 사이에는 다른 쪽이 버스를 쓸 수 있다
+    for (done = 0; done < n; done += chunk) {
+        chunk = min_t(unsigned int, n - done, ITF_BATCH_MAX);
+        toggles = 0;
+        saved = 0;
+
+        // 예산은 영역마다 따로, 클래스는 배치 안에서 가장 급한 것
+        memset(bytes, 0, sizeof(bytes));
+        class = ITF_CLASS_BULK;
+        for (k = 0; k < chunk; k++) {
+            bytes[itf_region_map[tx[done + k].addr & (FPGA_ADDRESS_SPACE - 1)]]++;
+            class = min(class, itf_class_of(tx[done + k].addr));
+        }
+        for (r = 0; r < ITF_REGION_COUNT; r++)
+            if (bytes[r])
+                itf_budget_wait(r, bytes[r]);
+
+        itf_bus_acquire(class, false);
+        if (reorder && chunk > 1) {
+            saved = itf_batch_order(tx + done, chunk, order);
+        } else {
+            for (k = 0; k < chunk; k++)
+                order[k] = k;
+        }
+        for (k = 0; k < chunk; k++) {
+            // 양보한 뒤에는 버스 상태가 바뀌어 있지만 순서 제약은 그대로 지켜진다
+            if (k && class == ITF_CLASS_BULK)
+                itf_bus_yield(class);
+            toggles += itf_write_locked(tx[done + order[k]].addr, tx[done + order[k]].value);
+        }
+        // 영역마다 제출 순서가 지켜졌으므로 제출 순서로 옮기면 마지막 값이 남는다
+        itf_status_update(tx + done, chunk);
+        itf_bus_release();
+
+        itf_account_batch(chunk, toggles, saved);
+    }
+    return n;
+}
+
+int iom_fpga_itf_write_batch(const struct fpga_bus_write *tx, unsigned int n)
+{
+    struct fpga_bus_write direct[ITF_BATCH_MAX];
+    unsigned int done, chunk, k, m;
+    bool comp;
+
+    if (!READ_ONCE(itf_coalescing) && !READ_ONCE(itf_compositing))
+        return itf_write_batch_direct(tx, n);
+
+    // 화면 영역은 백 버퍼로, 합치기를 켠 영역의 쓰기는 대기표로, 나머지만 바로 보낸다
+    comp = itf_comp_park_batch(tx, n);
+    for (done = 0; done < n; done += chunk) {
+        chunk = min_t(unsigned int, n - done, ITF_BATCH_MAX);
+        for (k = 0, m = 0; k < chunk; k++) {
+            if (comp && itf_composited(tx[done + k].addr))
+                continue;
+            if (READ_ONCE(itf_coalescing) && itf_coalesce_park(tx[done + k].addr, tx[done + k].value))
+                continue;
+            direct[m++] = tx[done + k];
+        }
+        if (m)
+            itf_write_batch_direct(direct, m);
+    }
+    return n;
+}
+EXPORT_SYMBOL(iom_fpga_itf_write_batch);
+
+/* ---------------------------------------------------------------------- */
+/* 디바이스 명령: ioctl(FPGA_IOC_SUBMIT) 과 io_uring 명령                   */
+
+static const char *const fpga_cmd_names[FPGA_CMD_DEVICES] = {
+    "led", "fnd", "dot", "text_lcd", "buzzer",
+};
+
+static struct {
+    fpga_cmd_encode_t encode;
+    struct fpga_dev_stats *stats;
+} fpga_cmd_devices[FPGA_CMD_DEVICES];
+static DEFINE_MUTEX(fpga_cmd_lock);        // 등록/해제와 변환이 겹치지 않게
+static struct workqueue_struct *fpga_cmd_wq;
+
+/*
+ * 디바이스마다 누가 쓰고 있는가. open() 은 아무도 없을 때만 잡고 (한 번에 한 프로그램),
+ * 배치는 비어 있거나 같은 프로세스가 잡고 있을 때만 그 디바이스에 쓴다. 그래서
+ * /dev/fpga_buzzer 만 연 프로그램이 다른 프로그램이 연 LED 를 배치로 건드리지 못한다.
+ */
+static struct {
+    pid_t tgid;            // 잡고 있는 프로세스 (0: 없음)
+    bool opened;           // 디바이스 파일이 열려 있다
+    unsigned int batches;  // 이 디바이스에 쓰는 중인 배치
+} fpga_cmd_claims[FPGA_CMD_DEVICES];
+static DEFINE_SPINLOCK(fpga_cmd_claim_lock);
+
+int fpga_cmd_claim(enum fpga_cmd_device device)
+{
+    int ret = 0;
+
+    if (device >= FPGA_CMD_DEVICES)
+        return -EINVAL;
+
+    spin_lock(&fpga_cmd_claim_lock);
+    if (fpga_cmd_claims[device].opened ||
+        (fpga_cmd_claims[device].batches && fpga_cmd_claims[device].tgid != current->tgid)) {
+        ret = -EBUSY;
+    } else {
+        fpga_cmd_claims[device].opened = true;
+        fpga_cmd_claims[device].tgid = current->tgid;
+    }
+    spin_unlock(&fpga_cmd_claim_lock);
+    return ret;
+}
+EXPORT_SYMBOL(fpga_cmd_claim);
+
+void fpga_cmd_unclaim(enum fpga_cmd_device device)
+{
+    if (device >= FPGA_CMD_DEVICES)
+        return;
+
+    spin_lock(&fpga_cmd_claim_lock);
+    fpga_cmd_claims[device].opened = false;
+    if (!fpga_cmd_claims[device].batches)
+        fpga_cmd_claims[device].tgid = 0;
+    spin_unlock(&fpga_cmd_claim_lock);
+}
+EXPORT_SYMBOL(fpga_cmd_unclaim);
+
+// 배치가 쓰는 디바이스를 모두 잡는다, 하나라도 다른 프로세스 것이면 아무것도 잡지 않고 -EBUSY
+static int fpga_cmd_claim_batch(unsigned long devices, pid_t tgid)
+{
+    unsigned int d;
+
+    spin_lock(&fpga_cmd_claim_lock);
+    for_each_set_bit(d, &devices, FPGA_CMD_DEVICES) {
+        if ((fpga_cmd_claims[d].opened || fpga_cmd_claims[d].batches) && fpga_cmd_claims[d].tgid != tgid) {
+            spin_unlock(&fpga_cmd_claim_lock);
+            return -EBUSY;
+        }
+    }
+    for_each_set_bit(d, &devices, FPGA_CMD_DEVICES) {
+        fpga_cmd_claims[d].batches++;
+        fpga_cmd_claims[d].tgid = tgid;
+    }
+    spin_unlock(&fpga_cmd_claim_lock);
+    return 0;
+}
+
+static void fpga_cmd_unclaim_batch(unsigned long devices)
+{
+    unsigned int d;
+
+    spin_lock(&fpga_cmd_claim_lock);
+    for_each_set_bit(d, &devices, FPGA_CMD_DEVICES) {
+        if (!--fpga_cmd_claims[d].batches && !fpga_cmd_claims[d].opened)
+            fpga_cmd_claims[d].tgid = 0;
+    }
+    spin_unlock(&fpga_cmd_claim_lock);
+}
+
+/* 배치 하나, io_uring 명령이면 완료 때까지 살아 있다 */
+struct fpga_cmd_req {
+    struct work_struct work;
+    struct io_uring_cmd *ioucmd;
+    pid_t tgid;                // 제출한 프로세스 (작업 큐에서 돌 때도 이 프로세스로 따진다)
+    int ret;
+    unsigned int count;
+    struct fpga_cmd cmds[FPGA_CMD_MAX];
+    struct fpga_bus_write tx[FPGA_CMD_MAX * FPGA_CMD_DATA];
+};
+
+int fpga_cmd_register(enum fpga_cmd_device device, fpga_cmd_encode_t encode, struct fpga_dev_stats *stats)
+{
+    int ret = 0;
+
+    if (device >= FPGA_CMD_DEVICES || !encode)
+        return -EINVAL;
+
+    mutex_lock(&fpga_cmd_lock);
+    if (fpga_cmd_devices[device].encode) {
+        ret = -EBUSY;
+    } else {
+        fpga_cmd_devices[device].encode = encode;
+        fpga_cmd_devices[device].stats = stats;
+    }
+    mutex_unlock(&fpga_cmd_lock);
+    return ret;
+}
+EXPORT_SYMBOL(fpga_cmd_register);
+
+void fpga_cmd_unregister(enum fpga_cmd_device device)
+{
+    if (device >= FPGA_CMD_DEVICES)
+        return;
+
+    // 변환 중인 배치가 끝난 뒤에 지운다 (그 뒤로 드라이버 모듈을 부르지 않는다)
+    mutex_lock(&fpga_cmd_lock);
+    fpga_cmd_devices[device].encode = NULL;
+    fpga_cmd_devices[device].stats = NULL;
+    mutex_unlock(&fpga_cmd_lock);
+}
+EXPORT_SYMBOL(fpga_cmd_unregister);
+
+/* 사용자 공간의 배치를 req 로 복사한다 (제출한 프로세스의 문맥에서) */
+static int fpga_cmd_copy(struct fpga_cmd_req *req, const struct fpga_cmd_batch *batch)
+{
+    if (batch->flags || batch->count == 0 || batch->count > FPGA_CMD_MAX)
+        return -EINVAL;
+    if (copy_from_user(req->cmds, u64_to_user_ptr(batch->cmds), batch->count * sizeof(struct fpga_cmd)))
+        return -EFAULT;
+    req->count = batch->count;
+    req->tgid = current->tgid;
+    return 0;
+}
+
+/*
+ * req 의 명령을 모두 req->tx 로 변환한다 (fpga_cmd_lock 을 잡고). device 가 있으면
+ * 쓰기마다 어느 디바이스 것인지 적는다. 쓰기 수나 -errno 를 돌려준다.
+ */
+static int fpga_cmd_encode(struct fpga_cmd_req *req, u8 *device)
+{
+    const struct fpga_cmd *cmd;
+    unsigned int i, k, n = 0;
+    int ret;
+
+    for (i = 0; i < req->count; i++) {
+        cmd = &req->cmds[i];
+        if (cmd->device >= FPGA_CMD_DEVICES || !fpga_cmd_devices[cmd->device].encode)
+            return -ENODEV;
+        // reserved 는 나중에 뜻을 붙일 수 있도록 0 이어야 한다
+        if (cmd->len > FPGA_CMD_DATA || memchr_inv(cmd->reserved, 0, sizeof(cmd->reserved)))
+            return -EINVAL;
+        ret = fpga_cmd_devices[cmd->device].encode(cmd, req->tx + n);
+        if (ret < 0)
+            return ret;
+        if (device) {
+            for (k = 0; k < ret; k++)
+                device[n + k] = cmd->device;
+        }
+        n += ret;
+    }
+    return n;
+}
+
+/* 모든 명령을 먼저 변환하고, 하나라도 틀리면 아무것도 쓰지 않는다 */
+static int fpga_cmd_run(struct fpga_cmd_req *req)
+{
+    unsigned long devices = 0;
+    unsigned int i, n;
+    u64 start;
+    int ret;
+
+    for (i = 0; i < req->count; i++) {
+        if (req->cmds[i].device >= FPGA_CMD_DEVICES)
+            return -ENODEV;
+        devices |= BIT(req->cmds[i].device);
+    }
+    ret = fpga_cmd_claim_batch(devices, req->tgid);
+    if (ret)
+        return ret;
+
+    mutex_lock(&fpga_cmd_lock);
+    ret = fpga_cmd_encode(req, NULL);
+    if (ret >= 0) {
+        for (i = 0; i < req->count; i++)
+            fpga_dev_stats_inc(fpga_cmd_devices[req->cmds[i].device].stats, FPGA_DEV_WRITES);
+    }
+    mutex_unlock(&fpga_cmd_lock);
+    if (ret < 0)
+        goto out;
+    n = ret;
+
+    start = trace_fpga_dev_write_enabled() ? ktime_get_ns() : 0;
+    iom_fpga_itf_write_batch(req->tx, n);
+    for (i = 0; i < req->count; i++)
+        trace_fpga_dev_write(fpga_cmd_names[req->cmds[i].device], req->cmds[i].cookie,
+                             req->cmds[i].len, start);
+    ret = req->count;
+out:
+    fpga_cmd_unclaim_batch(devices);
+    return ret;
+}
+
+static long fpga_scene_ioctl(unsigned int cmd, unsigned long arg);
+
+long fpga_cmd_ioctl(struct file *file, unsigned int cmd, unsigned long arg)
+{
+    struct fpga_cmd_batch batch;
+    struct fpga_cmd_req *req;
+    long ret;
+
+    if (cmd == FPGA_IOC_SCENE_SET || cmd == FPGA_IOC_SCENE_ACTIVATE)
+        return fpga_scene_ioctl(cmd, arg);
+    if (cmd != FPGA_IOC_SUBMIT)
+        return -ENOTTY;
+    if (copy_from_user(&batch, (void __user *)arg, sizeof(batch)))
+        return -EFAULT;
+
+    req = kmalloc(sizeof(*req), GFP_KERNEL);
+    if (!req)
+        return -ENOMEM;
+    ret = fpga_cmd_copy(req, &batch);
+    if (!ret)
+        ret = fpga_cmd_run(req);
+    kfree(req);
+    return ret;
+}
+EXPORT_SYMBOL(fpga_cmd_ioctl);
+
+static void fpga_cmd_uring_done(struct io_uring_cmd *ioucmd, unsigned int issue_flags)
+{
+    struct fpga_cmd_req *req = *(struct fpga_cmd_req **)ioucmd->pdu;
+    int ret = req->ret;
+
+    kfree(req);
+    io_uring_cmd_done(ioucmd, ret, 0, issue_flags);
+}
+
+static void fpga_cmd_work_fn(struct work_struct *work)
+{
+    struct fpga_cmd_req *req = container_of(work, struct fpga_cmd_req, work);
+
+    req->ret = fpga_cmd_run(req);
+    // 완료는 제출한 태스크 문맥에서 알린다
+    io_uring_cmd_complete_in_task(req->ioucmd, fpga_cmd_uring_done);
+}
+
+int fpga_cmd_uring_cmd(struct io_uring_cmd *ioucmd, unsigned int issue_flags)
+{
+    const struct fpga_cmd_batch *sqe_batch = io_uring_sqe_cmd(ioucmd->sqe);
+    struct fpga_cmd_batch batch;
+    struct fpga_cmd_req *req;
+    int ret;
+
+    if (ioucmd->cmd_op != FPGA_IOC_SUBMIT)
+        return -ENOTTY;
+
+    // SQE 는 사용자와 공유하는 메모리이므로 한 번만 읽는다
+    batch.cmds = READ_ONCE(sqe_batch->cmds);
+    batch.count = READ_ONCE(sqe_batch->count);
+    batch.flags = READ_ONCE(sqe_batch->flags);
+
+    req = kmalloc(sizeof(*req), GFP_KERNEL);
+    if (!req)
+        return -ENOMEM;
+    ret = fpga_cmd_copy(req, &batch);
+    if (ret) {
+        kfree(req);
+        return ret;
+    }
+
+    req->ioucmd = ioucmd;
+    *(struct fpga_cmd_req **)ioucmd->pdu = req;
+    INIT_WORK(&req->work, fpga_cmd_work_fn);
+    queue_work(fpga_cmd_wq, &req->work);
+    return -EIOCBQUEUED;
+}
+EXPORT_SYMBOL(fpga_cmd_uring_cmd);
+
+/* ---------------------------------------------------------------------- */
+/* 장면: 이름 붙은 명령 배치, 켤 때 버스 값과 다른 레지스터만 보낸다      */
+
+struct fpga_scene_entry {
+    struct list_head node;
+    char name[FPGA_SCENE_NAME];
+    unsigned int n;
+    u64 activations;
+    u64 sent;     // 보낸 레지스터 쓰기
+    u64 skipped;  // 버스 값과 같아서 뺀 쓰기
+    u8 device[FPGA_SCENE_WRITES];
+    struct fpga_bus_write tx[FPGA_SCENE_WRITES];
+};
+
+static LIST_HEAD(fpga_scenes);
+static unsigned int fpga_scene_count;
+static DEFINE_MUTEX(fpga_scene_lock);
+
+static struct fpga_scene_entry *fpga_scene_find(const char *name)
+{
+    struct fpga_scene_entry *scene;
+
+    list_for_each_entry(scene, &fpga_scenes, node)
+        if (!strcmp(scene->name, name))
+            return scene;
+    return NULL;
+}
+
+/* 명령을 변환해서 장면으로 저장한다, 같은 레지스터는 마지막 값만 남긴다 */
+static int fpga_scene_set(const struct fpga_scene *arg)
+{
+    struct fpga_cmd_batch batch = { .cmds = arg->cmds, .count = arg->count };
+    struct fpga_scene_entry *scene, *old;
+    struct fpga_cmd_req *req;
+    u8 *device;
+    unsigned int i, k;
+    int n, ret;
+
+    if (arg->count == 0) {
+        mutex_lock(&fpga_scene_lock);
+        old = fpga_scene_find(arg->name);
+        if (old) {
+            list_del(&old->node);
+            fpga_scene_count--;
+        }
+        mutex_unlock(&fpga_scene_lock);
+        kfree(old);
+        return old ? 0 : -ENOENT;
+    }
+
+    req = kmalloc(sizeof(*req), GFP_KERNEL);
+    device = kmalloc(FPGA_CMD_MAX * FPGA_CMD_DATA, GFP_KERNEL);
+    scene = kzalloc(sizeof(*scene), GFP_KERNEL);
+    ret = -ENOMEM;
+    if (!req || !device || !scene)
+        goto out;
+    ret = fpga_cmd_copy(req, &batch);
+    if (ret)
+        goto out;
+
+    mutex_lock(&fpga_cmd_lock);
+    n = fpga_cmd_encode(req, device);
+    mutex_unlock(&fpga_cmd_lock);
+    ret = n;
+    if (n < 0)
+        goto out;
+
+    strscpy(scene->name, arg->name, sizeof(scene->name));
+    for (i = 0; i < n; i++) {
+        for (k = 0; k < scene->n; k++)
+            if (scene->tx[k].addr == req->tx[i].addr)
+                break;
+        if (k == FPGA_SCENE_WRITES) {
+            ret = -E2BIG;
+            goto out;
+        }
+        scene->tx[k] = req->tx[i];
+        scene->device[k] = device[i];
+        if (k == scene->n)
+            scene->n++;
+    }
+
+    // 같은 이름이 있으면 바꾼다 (카운터는 새로 시작)
+    mutex_lock(&fpga_scene_lock);
+    old = fpga_scene_find(arg->name);
+    if (!old && fpga_scene_count == FPGA_SCENE_MAX) {
+        ret = -ENOSPC;
+    } else {
+        if (old)
+            list_replace(&old->node, &scene->node);
+        else
+            list_add_tail(&scene->node, &fpga_scenes);
+        fpga_scene_count += !old;
+        scene = old;
+        ret = 0;
+    }
+    mutex_unlock(&fpga_scene_lock);
+
+out:
+    kfree(scene);
+    kfree(device);
+    kfree(req);
+    return ret;
+}
+
+/* 장면과 다른 레지스터만 한 배치로 보내고, 보낸 쓰기 수를 돌려준다 */
+static int fpga_scene_activate(const struct fpga_scene *arg)
+{
+    struct fpga_bus_write tx[FPGA_SCENE_WRITES];
+    unsigned long devices = 0, claimed = 0;
+    struct fpga_scene_entry *scene;
+    unsigned int i, n = 0, d;
+    u64 start;
+    u8 value;
+    int ret;
+
+    // 합치기 창에 남은 쓰기가 있으면 버스 값이 곧 바뀌므로 먼저 보낸다
+    iom_fpga_itf_flush();
+
+    mutex_lock(&fpga_scene_lock);
+    scene = fpga_scene_find(arg->name);
+    if (!scene) {
+        mutex_unlock(&fpga_scene_lock);
+        return -ENOENT;
+    }
+    // 장면이 다루는 디바이스는 보낼 것이 없어도 모두 잡을 수 있어야 한다
+    for (i = 0; i < scene->n; i++)
+        claimed |= BIT(scene->device[i]);
+    ret = fpga_cmd_claim_batch(claimed, current->tgid);
+    if (ret) {
+        mutex_unlock(&fpga_scene_lock);
+        return ret;
+    }
+    for (i = 0; i < scene->n; i++) {
+        if (itf_shadow_get(scene->tx[i].addr, &value) && value == scene->tx[i].value)
+            continue;
+        tx[n++] = scene->tx[i];
+        devices |= BIT(scene->device[i]);
+    }
+    scene->activations++;
+    scene->sent += n;
+    scene->skipped += scene->n - n;
+    mutex_unlock(&fpga_scene_lock);
+
+    if (!n) {
+        fpga_cmd_unclaim_batch(claimed);
+        return 0;
+    }
+
+    start = trace_fpga_dev_write_enabled() ? ktime_get_ns() : 0;
+    iom_fpga_itf_write_batch(tx, n);
+    fpga_cmd_unclaim_batch(claimed);
+
+    mutex_lock(&fpga_cmd_lock);
+    for_each_set_bit(d, &devices, FPGA_CMD_DEVICES) {
+        fpga_dev_stats_inc(fpga_cmd_devices[d].stats, FPGA_DEV_WRITES);
+        trace_fpga_dev_write(fpga_cmd_names[d], arg->cookie, 0, start);
+    }
+    mutex_unlock(&fpga_cmd_lock);
+    return n;
+}
+
+static long fpga_scene_ioctl(unsigned int cmd, unsigned long arg)
+{
+    struct fpga_scene scene;
+
+    if (copy_from_user(&scene, (void __user *)arg, sizeof(scene)))
+        return -EFAULT;
+    if (scene.flags || !scene.name[0] || strnlen(scene.name, sizeof(scene.name)) == sizeof(scene.name))
+        return -EINVAL;
+
+    if (cmd == FPGA_IOC_SCENE_SET)
+        return fpga_scene_set(&scene);
+    return fpga_scene_activate(&scene);
+}
+
+static void fpga_scene_reset(void)
+{
+    struct fpga_scene_entry *scene;
+
+    mutex_lock(&fpga_scene_lock);
+    list_for_each_entry(scene, &fpga_scenes, node) {
+        scene->activations = 0;
+        scene->sent = 0;
+        scene->skipped = 0;
+    }
+    mutex_unlock(&fpga_scene_lock);
+}
+
+/* debugfs: 장면 목록 */
+static int scenes_show(struct seq_file *m, void *v)
+{
+    struct fpga_scene_entry *scene;
+
+    seq_printf(m, "%-16s %8s %12s %12s %12s\n", "scene", "regs", "activations", "sent", "skipped");
+    mutex_lock(&fpga_scene_lock);
+    list_for_each_entry(scene, &fpga_scenes, node)
+        seq_printf(m, "%-16s %8u %12llu %12llu %12llu\n", scene->name, scene->n,
+                   scene->activations, scene->sent, scene->skipped);
+    mutex_unlock(&fpga_scene_lock);
+    return 0;
+}
+DEFINE_SHOW_ATTRIBUTE(scenes);
+
+static void fpga_scene_free_all(void)
+{
+    struct fpga_scene_entry *scene, *next;
+
+    list_for_each_entry_safe(scene, next, &fpga_scenes, node) {
+        list_del(&scene->node);
+        kfree(scene);
+    }
+    fpga_scene_count = 0;
+}
+
+// 벤치마크 결과에 어느 백엔드에서 잰 것인지 남기기 위해 쓴다
+bool iom_fpga_itf_sim(void)
+{
+    return sim;
+}
+EXPORT_SYMBOL(iom_fpga_itf_sim);
+
+// 디바이스 드라이버가 write 마다 남기는 fpga:fpga_dev_write (fpga_trace.h)
+EXPORT_TRACEPOINT_SYMBOL(fpga_dev_write);
+
+/* ---------------------------------------------------------------------- */
+/* /dev/fpga_status: 상태 페이지를 읽기 전용으로 mmap                      */
+
+static int fpga_status_mmap(struct file *file, struct vm_area_struct *vma)
+{
+    if (vma->vm_pgoff || vma->vm_end - vma->vm_start != PAGE_SIZE)
+        return -EINVAL;
+    if (vma->vm_flags & VM_WRITE)
+        return -EPERM;
+
+    // mprotect 로 쓰기 권한을 되살리지 못하게 한다
+    vm_flags_clear(vma, VM_MAYWRITE);
+    // 페이지 참조를 잡으므로 모듈을 내린 뒤에도 남은 매핑은 안전하다
+    return vm_insert_page(vma, vma->vm_start, virt_to_page(itf_status));
+}
+
+static const struct file_operations fpga_status_fops = {
+    .owner = THIS_MODULE,
+    .mmap  = fpga_status_mmap,
+};
+
+static struct miscdevice fpga_status_dev = {
+    .minor = MISC_DYNAMIC_MINOR,
+    .name  = "fpga_status",
+    .fops  = &fpga_status_fops,
+    .mode  = 0444,
+};
+
+static int fpga_status_init(void)
+{
+    BUILD_BUG_ON(sizeof(struct fpga_status) > PAGE_SIZE);
+    BUILD_BUG_ON(FPGA_STATUS_REGIONS != ITF_REGION_OTHER);
+
+    itf_status = (struct fpga_status *)get_zeroed_page(GFP_KERNEL);
+    if (!itf_status)
+        return -ENOMEM;
+    itf_status->magic = FPGA_STATUS_MAGIC;
+    itf_status->version = FPGA_STATUS_VERSION;
+    itf_status->size = sizeof(struct fpga_status);
+    return 0;
+}
+
+/* ---------------------------------------------------------------------- */
+/* 통계: 버스 영역별 카운터와 디바이스 드라이버별 카운터                  */
+
+#define FPGA_MAX_DEVICES 16
+
+static const char *const dev_stat_names[FPGA_DEV_STAT_COUNT] = {
+    "opens", "busy", "writes", "reads", "short_writes", "faults",
+};
+
+static struct fpga_dev_stats *dev_stats[FPGA_MAX_DEVICES];
+static DEFINE_MUTEX(dev_stats_lock);
+
+static struct kobject *fpga_kobj, *bus_kobj, *devices_kobj, *comp_kobj;
+static struct kobject *region_kobjs[ITF_REGION_COUNT];
+static struct kobject *classes_kobj, *class_kobjs[ITF_CLASS_COUNT];
+static struct dentry *fpga_debugfs;
+
+// 모든 CPU 의 카운터를 합친다 (max 는 CPU 들 중 최대)
+static void itf_region_sum(int r, struct itf_region_counters *sum)
+{
+    const struct itf_cpu_stats *s;
+    struct itf_region_counters c;
+    unsigned int seq;
+    int cpu;
+
+    memset(sum, 0, sizeof(*sum));
+    for_each_possible_cpu(cpu) {
+        s = per_cpu_ptr(&itf_stats, cpu);
+        do {
+            seq = u64_stats_fetch_begin(&s->syncp);
+            c = s->region[r];
+        } while (u64_stats_fetch_retry(&s->syncp, seq));
+
+        sum->writes += c.writes;
+        sum->reads += c.reads;
+        sum->toggles += c.toggles;
+        sum->busy_ns += c.busy_ns;
+        sum->max_ns = max(sum->max_ns, c.max_ns);
+        sum->throttled_ns += c.throttled_ns;
+        sum->deferred += c.deferred;
+        sum->coalesced += c.coalesced;
+    }
+}
+
+static void itf_class_sum(int class, struct itf_class_counters *sum)
+{
+    const struct itf_cpu_stats *s;
+    struct itf_class_counters c;
+    unsigned int seq;
+    int cpu;
+
+    memset(sum, 0, sizeof(*sum));
+    for_each_possible_cpu(cpu) {
+        s = per_cpu_ptr(&itf_stats, cpu);
+        do {
+            seq = u64_stats_fetch_begin(&s->syncp);
+            c = s->class[class];
+        } while (u64_stats_fetch_retry(&s->syncp, seq));
+
+        sum->grants += c.grants;
+        sum->wait_ns += c.wait_ns;
+        sum->max_wait_ns = max(sum->max_wait_ns, c.max_wait_ns);
+        sum->preempted += c.preempted;
+    }
+}
+
+static void itf_batch_sum(struct itf_batch_counters *sum)
+{
+    const struct itf_cpu_stats *s;
+    struct itf_batch_counters c;
+    unsigned int seq;
+    int cpu;
+
+    memset(sum, 0, sizeof(*sum));
+    for_each_possible_cpu(cpu) {
+        s = per_cpu_ptr(&itf_stats, cpu);
+        do {
+            seq = u64_stats_fetch_begin(&s->syncp);
+            c = s->batch;
+        } while (u64_stats_fetch_retry(&s->syncp, seq));
+
+        sum->batches += c.batches;
+        sum->writes += c.writes;
+        sum->toggles += c.toggles;
+        sum->saved += c.saved;
+        sum->flushes += c.flushes;
+    }
+}
+
+static unsigned long dev_stat_sum(const struct fpga_dev_stats *stats, int stat)
+{
+    unsigned long sum = 0;
+    int cpu;
+
+    for_each_possible_cpu(cpu)
+        sum += per_cpu_ptr(stats->counters, cpu)->v[stat];
+    return sum;
+}
+
+/*
+ * 다른 CPU 가 갱신하는 중에 지우면 그 트랜잭션 하나는 남을 수 있다.
+ * 통계용이므로 hot path 에 잠금을 넣지 않는다 (syncp 는 그 CPU 만 건드린다).
+ */
+static void fpga_stats_reset(void)
+{
+    struct itf_cpu_stats *s;
+    int cpu, i;
+
+    for_each_possible_cpu(cpu) {
+        s = per_cpu_ptr(&itf_stats, cpu);
+        memset(s->region, 0, sizeof(s->region));
+        memset(&s->batch, 0, sizeof(s->batch));
+        memset(s->class, 0, sizeof(s->class));
+    }
+
+    mutex_lock(&dev_stats_lock);
+    for (i = 0; i < FPGA_MAX_DEVICES; i++) {
+        if (!dev_stats[i])
+            continue;
+        for_each_possible_cpu(cpu)
+            memset(per_cpu_ptr(dev_stats[i]->counters, cpu), 0, sizeof(struct fpga_dev_counters));
+    }
+    mutex_unlock(&dev_stats_lock);
+
+    fpga_scene_reset();
+    itf_comp_reset();
+}
+
+/* sysfs: /sys/kernel/fpga/bus/<region>/<counter> */
+enum {
+    REGION_WRITES, REGION_READS, REGION_BYTES, REGION_TOGGLES, REGION_BUSY_NS, REGION_MAX_NS,
+    REGION_THROTTLED_NS, REGION_DEFERRED, REGION_COALESCED, REGION_CLASS, REGION_BUDGET_BPS,
+    REGION_COALESCE, REGION_ATTR_COUNT
+};
+
+static ssize_t region_attr_show(struct kobject *kobj, struct kobj_attribute *attr, char *buf);
+static ssize_t region_attr_store(struct kobject *kobj, struct kobj_attribute *attr, const char *buf, size_t len);
+
+static struct kobj_attribute region_attrs[REGION_ATTR_COUNT] = {
+    __ATTR(writes, 0444, region_attr_show, NULL),
+    __ATTR(reads, 0444, region_attr_show, NULL),
+    __ATTR(bytes, 0444, region_attr_show, NULL),
+    __ATTR(toggles, 0444, region_attr_show, NULL),
+    __ATTR(busy_ns, 0444, region_attr_show, NULL),
+    __ATTR(max_ns, 0444, region_attr_show, NULL),
+    __ATTR(throttled_ns, 0444, region_attr_show, NULL),
+    __ATTR(deferred, 0444, region_attr_show, NULL),
+    __ATTR(coalesced, 0444, region_attr_show, NULL),
+    __ATTR(class, 0644, region_attr_show, region_attr_store),
+    __ATTR(budget_bps, 0644, region_attr_show, region_attr_store),
+    __ATTR(coalesce, 0644, region_attr_show, region_attr_store),
+};
+
+static struct attribute *region_attr_list[REGION_ATTR_COUNT + 1] = {
+    &region_attrs[REGION_WRITES].attr,
+    &region_attrs[REGION_READS].attr,
+    &region_attrs[REGION_BYTES].attr,
+    &region_attrs[REGION_TOGGLES].attr,
+    &region_attrs[REGION_BUSY_NS].attr,
+    &region_attrs[REGION_MAX_NS].attr,
+    &region_attrs[REGION_THROTTLED_NS].attr,
+    &region_attrs[REGION_DEFERRED].attr,
+    &region_attrs[REGION_COALESCED].attr,
+    &region_attrs[REGION_CLASS].attr,
+    &region_attrs[REGION_BUDGET_BPS].attr,
+    &region_attrs[REGION_COALESCE].attr,
+    NULL,
+};
+
+static const struct attribute_group region_attr_group = {
+    .attrs = region_attr_list,
+};
+
+static int region_of_kobj(struct kobject *kobj)
+{
+    int r;
+
+    for (r = 0; r < ITF_REGION_COUNT; r++)
+        if (region_kobjs[r] == kobj)
+            return r;
+    return -ENODEV;
+}
+
+static ssize_t region_attr_show(struct kobject *kobj, struct kobj_attribute *attr, char *buf)
+{
+    struct itf_region_counters sum;
+    u64 value;
+    int r = region_of_kobj(kobj);
+
+    if (r < 0)
+        return r;
+
+    itf_region_sum(r, &sum);
+    switch (attr - region_attrs) {
+    case REGION_WRITES: value = sum.writes; break;
+    case REGION_READS: value = sum.reads; break;
+    case REGION_BYTES: value = sum.writes + sum.reads; break;
+    case REGION_TOGGLES: value = sum.toggles; break;
+    case REGION_BUSY_NS: value = sum.busy_ns; break;
+    case REGION_THROTTLED_NS: value = sum.throttled_ns; break;
+    case REGION_DEFERRED: value = sum.deferred; break;
+    case REGION_COALESCED: value = sum.coalesced; break;
+    case REGION_COALESCE:
+        if (READ_ONCE(itf_coalesce_us[r]) < 0)
+            return sysfs_emit(buf, "off\n");
+        value = READ_ONCE(itf_coalesce_us[r]);
+        break;
+    case REGION_CLASS: return sysfs_emit(buf, "%s\n", itf_class_names[READ_ONCE(itf_region_class[r])]);
+    case REGION_BUDGET_BPS: value = READ_ONCE(itf_budgets[r].bps); break;
+    default: value = sum.max_ns; break;
+    }
+    return sysfs_emit(buf, "%llu\n", value);
+}
+
+/* "off" 또는 창 길이 (us, 최대 1 초) */
+static int itf_coalesce_set(int r, const char *buf)
+{
+    bool any = false;
+    u32 us;
+    int i, ret;
+
+    if (sysfs_streq(buf, "off")) {
+        WRITE_ONCE(itf_coalesce_us[r], -1);
+    } else {
+        ret = kstrtou32(buf, 0, &us);
+        if (ret)
+            return ret;
+        if (us > USEC_PER_SEC)
+            return -EINVAL;
+        WRITE_ONCE(itf_coalesce_us[r], us);
+    }
+
+    for (i = 0; i < ITF_REGION_COUNT; i++)
+        any |= READ_ONCE(itf_coalesce_us[i]) >= 0;
+    WRITE_ONCE(itf_coalescing, any);
+    // 끈 영역의 값이 대기표에 남아 있으면 바로 쓰는 값보다 늦게 나갈 수 있다
+    itf_coalesce_flush();
+    return 0;
+}
+
+static ssize_t region_attr_store(struct kobject *kobj, struct kobj_attribute *attr, const char *buf, size_t len)
+{
+    struct itf_budget *b;
+    u32 bps;
+    int r = region_of_kobj(kobj), class, ret;
+
+    if (r < 0)
+        return r;
+
+    if (attr - region_attrs == REGION_CLASS) {
+        class = sysfs_match_string(itf_class_names, buf);
+        if (class < 0)
+            return class;
+        WRITE_ONCE(itf_region_class[r], class);
+        return len;
+    }
+    if (attr - region_attrs == REGION_COALESCE) {
+        ret = itf_coalesce_set(r, buf);
+        return ret ? ret : len;
+    }
+
+    // 0 은 무제한, 바꾸면 버킷은 가득 찬 상태에서 시작한다
+    ret = kstrtou32(buf, 0, &bps);
+    if (ret)
+        return ret;
+    b = &itf_budgets[r];
+    spin_lock(&itf_budget_lock);
+    b->credit = (u64)max_t(u32, bps / 10, ITF_BATCH_MAX) * NSEC_PER_SEC;
+    b->last_ns = ktime_get_ns();
+    WRITE_ONCE(b->bps, bps);
+    spin_unlock(&itf_budget_lock);
+    return len;
+}
+
+/* sysfs: /sys/kernel/fpga/bus/classes/<class>/<counter> */
+enum { CLASS_GRANTS, CLASS_WAIT_NS, CLASS_MAX_WAIT_NS, CLASS_PREEMPTED, CLASS_ATTR_COUNT };
+
+static ssize_t class_attr_show(struct kobject *kobj, struct kobj_attribute *attr, char *buf);
+
+static struct kobj_attribute class_attrs[CLASS_ATTR_COUNT] = {
+    __ATTR(grants, 0444, class_attr_show, NULL),
+    __ATTR(wait_ns, 0444, class_attr_show, NULL),
+    __ATTR(max_wait_ns, 0444, class_attr_show, NULL),
+    __ATTR(preempted, 0444, class_attr_show, NULL),
+};
+
+static struct attribute *class_attr_list[CLASS_ATTR_COUNT + 1] = {
+    &class_attrs[CLASS_GRANTS].attr,
+    &class_attrs[CLASS_WAIT_NS].attr,
+    &class_attrs[CLASS_MAX_WAIT_NS].attr,
+    &class_attrs[CLASS_PREEMPTED].attr,
+    NULL,
+};
+
+static const struct attribute_group class_attr_group = {
+    .attrs = class_attr_list,
+};
+
+static ssize_t class_attr_show(struct kobject *kobj, struct kobj_attribute *attr, char *buf)
+{
+    struct itf_class_counters sum;
+    u64 value;
+    int c;
+
+    for (c = 0; c < ITF_CLASS_COUNT; c++)
+        if (class_kobjs[c] == kobj)
+            break;
+    if (c == ITF_CLASS_COUNT)
+        return -ENODEV;
+
+    itf_class_sum(c, &sum);
+    switch (attr - class_attrs) {
+    case CLASS_GRANTS: value = sum.grants; break;
+    case CLASS_WAIT_NS: value = sum.wait_ns; break;
+    case CLASS_MAX_WAIT_NS: value = sum.max_wait_ns; break;
+    default: value = sum.preempted; break;
+    }
+    return sysfs_emit(buf, "%llu\n", value);
+}
+
+/* sysfs: /sys/kernel/fpga/bus/{batches,batch_writes,batch_toggles,toggles_saved,flushes,flush} */
+enum { BATCH_BATCHES, BATCH_WRITES, BATCH_TOGGLES, BATCH_SAVED, BATCH_FLUSHES, BATCH_FLUSH, BATCH_ATTR_COUNT };
+
+static ssize_t batch_attr_show(struct kobject *kobj, struct kobj_attribute *attr, char *buf);
+static ssize_t flush_store(struct kobject *kobj, struct kobj_attribute *attr, const char *buf, size_t len);
+
+static struct kobj_attribute batch_attrs[BATCH_ATTR_COUNT] = {
+    __ATTR(batches, 0444, batch_attr_show, NULL),
+    __ATTR(batch_writes, 0444, batch_attr_show, NULL),
+    __ATTR(batch_toggles, 0444, batch_attr_show, NULL),
+    __ATTR(toggles_saved, 0444, batch_attr_show, NULL),
+    __ATTR(flushes, 0444, batch_attr_show, NULL),
+    __ATTR(flush, 0200, NULL, flush_store),
+};
+
+static struct attribute *batch_attr_list[BATCH_ATTR_COUNT + 1] = {
+    &batch_attrs[BATCH_BATCHES].attr,
+    &batch_attrs[BATCH_WRITES].attr,
+    &batch_attrs[BATCH_TOGGLES].attr,
+    &batch_attrs[BATCH_SAVED].attr,
+    &batch_attrs[BATCH_FLUSHES].attr,
+    &batch_attrs[BATCH_FLUSH].attr,
+    NULL,
+};
+
+static const struct attribute_group batch_attr_group = {
+    .attrs = batch_attr_list,
+};
+
+static ssize_t batch_attr_show(struct kobject *kobj, struct kobj_attribute *attr, char *buf)
+{
+    struct itf_batch_counters sum;
+    u64 value;
+
+    itf_batch_sum(&sum);
+    switch (attr - batch_attrs) {
+    case BATCH_BATCHES: value = sum.batches; break;
+    case BATCH_WRITES: value = sum.writes; break;
+    case BATCH_TOGGLES: value = sum.toggles; break;
+    case BATCH_SAVED: value = sum.saved; break;
+    default: value = sum.flushes; break;
+    }
+    return sysfs_emit(buf, "%llu\n", value);
+}
+
+static ssize_t flush_store(struct kobject *kobj, struct kobj_attribute *attr, const char *buf, size_t len)
+{
+    itf_coalesce_flush();
+    return len;
+}
+
+/* sysfs: /sys/kernel/fpga/compositor/<counter>, hz */
+enum {
+    COMP_TICKS, COMP_COMMITS, COMP_BYTES, COMP_MAX_BYTES, COMP_ELIDED, COMP_COMMIT_NS,
+    COMP_MAX_COMMIT_NS, COMP_OVERRUNS, COMP_HZ, COMP_ATTR_COUNT
+};
+
+static ssize_t comp_attr_show(struct kobject *kobj, struct kobj_attribute *attr, char *buf);
+static ssize_t comp_hz_store(struct kobject *kobj, struct kobj_attribute *attr, const char *buf, size_t len);
+
+static struct kobj_attribute comp_attrs[COMP_ATTR_COUNT] = {
+    __ATTR(ticks, 0444, comp_attr_show, NULL),
+    __ATTR(commits, 0444, comp_attr_show, NULL),
+    __ATTR(bytes, 0444, comp_attr_show, NULL),
+    __ATTR(max_bytes, 0444, comp_attr_show, NULL),
+    __ATTR(elided, 0444, comp_attr_show, NULL),
+    __ATTR(commit_ns, 0444, comp_attr_show, NULL),
+    __ATTR(max_commit_ns, 0444, comp_attr_show, NULL),
+    __ATTR(overruns, 0444, comp_attr_show, NULL),
+    __ATTR(hz, 0644, comp_attr_show, comp_hz_store),
+};
+
+static struct attribute *comp_attr_list[COMP_ATTR_COUNT + 1] = {
+    &comp_attrs[COMP_TICKS].attr,
+    &comp_attrs[COMP_COMMITS].attr,
+    &comp_attrs[COMP_BYTES].attr,
+    &comp_attrs[COMP_MAX_BYTES].attr,
+    &comp_attrs[COMP_ELIDED].attr,
+    &comp_attrs[COMP_COMMIT_NS].attr,
+    &comp_attrs[COMP_MAX_COMMIT_NS].attr,
+    &comp_attrs[COMP_OVERRUNS].attr,
+    &comp_attrs[COMP_HZ].attr,
+    NULL,
+};
+
+static const struct attribute_group comp_attr_group = {
+    .attrs = comp_attr_list,
+};
+
+static void itf_comp_sum(struct itf_comp_counters *sum)
+{
+    mutex_lock(&comp_commit_lock);
+    *sum = comp_stats;
+    mutex_unlock(&comp_commit_lock);
+}
+
+static ssize_t comp_attr_show(struct kobject *kobj, struct kobj_attribute *attr, char *buf)
+{
+    struct itf_comp_counters sum;
+    u64 value;
+
+    itf_comp_sum(&sum);
+    switch (attr - comp_attrs) {
+    case COMP_TICKS: value = sum.ticks; break;
+    case COMP_COMMITS: value = sum.commits; break;
+    case COMP_BYTES: value = sum.bytes; break;
+    case COMP_MAX_BYTES: value = sum.max_bytes; break;
+    case COMP_ELIDED: value = sum.elided; break;
+    case COMP_COMMIT_NS: value = sum.commit_ns; break;
+    case COMP_MAX_COMMIT_NS: value = sum.max_commit_ns; break;
+    case COMP_OVERRUNS: value = sum.overruns; break;
+    default: value = READ_ONCE(itf_comp_hz); break;
+    }
+    return sysfs_emit(buf, "%llu\n", value);
+}
+
+static ssize_t comp_hz_store(struct kobject *kobj, struct kobj_attribute *attr, const char *buf, size_t len)
+{
+    u32 hz;
+    int ret;
+
+    ret = kstrtou32(buf, 0, &hz);
+    if (ret)
+        return ret;
+    ret = itf_comp_set_hz(hz);
+    return ret ? ret : len;
+}
+
+/* sysfs: /sys/kernel/fpga/devices/<name>/<counter> */
+static ssize_t dev_attr_show(struct kobject *kobj, struct kobj_attribute *attr, char *buf);
+
+static struct kobj_attribute dev_attrs[FPGA_DEV_STAT_COUNT] = {
+    __ATTR(opens, 0444, dev_attr_show, NULL),
+    __ATTR(busy, 0444, dev_attr_show, NULL),
+    __ATTR(writes, 0444, dev_attr_show, NULL),
+    __ATTR(reads, 0444, dev_attr_show, NULL),
+    __ATTR(short_writes, 0444, dev_attr_show, NULL),
+    __ATTR(faults, 0444, dev_attr_show, NULL),
+};
+
+static struct attribute *dev_attr_list[FPGA_DEV_STAT_COUNT + 1] = {
+    &dev_attrs[FPGA_DEV_OPENS].attr,
+    &dev_attrs[FPGA_DEV_BUSY].attr,
+    &dev_attrs[FPGA_DEV_WRITES].attr,
+    &dev_attrs[FPGA_DEV_READS].attr,
+    &dev_attrs[FPGA_DEV_SHORT_WRITES].attr,
+    &dev_attrs[FPGA_DEV_FAULTS].attr,
+    NULL,
+};
+
+static const struct attribute_group dev_attr_group = {
+    .attrs = dev_attr_list,
+};
+
+static ssize_t dev_attr_show(struct kobject *kobj, struct kobj_attribute *attr, char *buf)
+{
+    ssize_t ret = -ENODEV;
+    int i;
+
+    mutex_lock(&dev_stats_lock);
+    for (i = 0; i < FPGA_MAX_DEVICES; i++) {
+        if (dev_stats[i] && dev_stats[i]->kobj == kobj) {
+            ret = sysfs_emit(buf, "%lu\n", dev_stat_sum(dev_stats[i], attr - dev_attrs));
+            break;
+        }
+    }
+    mutex_unlock(&dev_stats_lock);
+    return ret;
+}
+
+static ssize_t reset_store(struct kobject *kobj, struct kobj_attribute *attr, const char *buf, size_t len)
+{
+    fpga_stats_reset();
+    return len;
+}
+
+static struct kobj_attribute reset_attr = __ATTR(reset, 0200, NULL, reset_store);
+
+/* debugfs: /sys/kernel/debug/fpga/{bus,devices,reset,flush} */
+static int bus_show(struct seq_file *m, void *v)
+{
+    struct itf_region_counters sum;
+    struct itf_batch_counters batch;
+    struct itf_class_counters class;
+    struct itf_comp_counters comp;
+    int r, c;
+
+    seq_printf(m, "backend %s\n", sim ? "sim" : "gpio");
+    seq_printf(m, "%-12s %-8s %12s %12s %12s %12s %14s %10s %10s %10s %14s %8s %12s %12s\n",
+               "region", "class", "writes", "reads", "bytes", "toggles", "busy_ns", "avg_ns", "max_ns",
+               "budget_bps", "throttled_ns", "coal_us", "deferred", "coalesced");
+    for (r = 0; r < ITF_REGION_COUNT; r++) {
+        itf_region_sum(r, &sum);
+        seq_printf(m, "%-12s %-8s %12llu %12llu %12llu %12llu %14llu %10llu %10llu %10u %14llu %8d %12llu %12llu\n",
+                   itf_regions[r].name, itf_class_names[READ_ONCE(itf_region_class[r])],
+                   sum.writes, sum.reads, sum.writes + sum.reads, sum.toggles, sum.busy_ns,
+                   sum.writes + sum.reads ? div64_u64(sum.busy_ns, sum.writes + sum.reads) : 0,
+                   sum.max_ns, READ_ONCE(itf_budgets[r].bps), sum.throttled_ns,
+                   READ_ONCE(itf_coalesce_us[r]), sum.deferred, sum.coalesced);
+    }
+
+    seq_printf(m, "\n%-12s %12s %14s %12s %12s %12s\n",
+               "class", "grants", "wait_ns", "avg_wait_ns", "max_wait_ns", "preempted");
+    for (c = 0; c < ITF_CLASS_COUNT; c++) {
+        itf_class_sum(c, &class);
+        seq_printf(m, "%-12s %12llu %14llu %12llu %12llu %12llu\n", itf_class_names[c],
+                   class.grants, class.wait_ns,
+                   class.grants ? div64_u64(class.wait_ns, class.grants) : 0,
+                   class.max_wait_ns, class.preempted);
+    }
+    seq_putc(m, '\n');
+
+    // 저장률은 제출 순서대로 보냈을 때의 토글 수 대비 (0.1% 단위)
+    itf_batch_sum(&batch);
+    seq_printf(m, "batches %llu writes %llu toggles %llu saved %llu (%llu.%llu%%) reorder %s flushes %llu\n",
+               batch.batches, batch.writes, batch.toggles, batch.saved,
+               batch.toggles + batch.saved ? div64_u64(batch.saved * 1000, batch.toggles + batch.saved) / 10 : 0,
+               batch.toggles + batch.saved ? div64_u64(batch.saved * 1000, batch.toggles + batch.saved) % 10 : 0,
+               reorder ? "on" : "off", batch.flushes);
+
+    // 평균은 보낼 것이 있던 커밋 하나당
+    itf_comp_sum(&comp);
+    seq_printf(m, "compositor %u Hz ticks %llu commits %llu bytes %llu (avg %llu max %llu) elided %llu "
+               "commit_ns avg %llu max %llu overruns %llu\n",
+               READ_ONCE(itf_comp_hz), comp.ticks, comp.commits, comp.bytes,
+               comp.commits ? div64_u64(comp.bytes, comp.commits) : 0, comp.max_bytes, comp.elided,
+               comp.commits ? div64_u64(comp.commit_ns, comp.commits) : 0, comp.max_commit_ns,
+               comp.overruns);
+    return 0;
+}
+DEFINE_SHOW_ATTRIBUTE(bus);
+
+static int devices_show(struct seq_file *m, void *v)
+{
+    int i, stat;
+
+    seq_printf(m, "%-12s", "device");
+    for (stat = 0; stat < FPGA_DEV_STAT_COUNT; stat++)
+        seq_printf(m, " %12s", dev_stat_names[stat]);
+    seq_putc(m, '\n');
+
+    mutex_lock(&dev_stats_lock);
+    for (i = 0; i < FPGA_MAX_DEVICES; i++) {
+        if (!dev_stats[i])
+            continue;
+        seq_printf(m, "%-12s", dev_stats[i]->name);
+        for (stat = 0; stat < FPGA_DEV_STAT_COUNT; stat++)
+            seq_printf(m, " %12lu", dev_stat_sum(dev_stats[i], stat));
+        seq_putc(m, '\n');
+    }
+    mutex_unlock(&dev_stats_lock);
+    return 0;
+}
+DEFINE_SHOW_ATTRIBUTE(devices);
+
+static ssize_t reset_write(struct file *file, const char __user *buf, size_t len, loff_t *off)
+{
+    fpga_stats_reset();
+    return len;
+}
+
+static const struct file_operations reset_fops = {
+    .owner = THIS_MODULE,
+    .open  = simple_open,
+    .write = reset_write,
+};
+
+static ssize_t flush_write(struct file *file, const char __user *buf, size_t len, loff_t *off)
+{
+    itf_coalesce_flush();
+    return len;
+}
+
+static const struct file_operations flush_fops = {
+    .owner = THIS_MODULE,
+    .open  = simple_open,
+    .write = flush_write,
+};
+
+struct fpga_dev_stats *fpga_dev_stats_register(const char *name)
+{
+    struct fpga_dev_stats *stats;
+    int i;
+
+    stats = kzalloc(sizeof(*stats), GFP_KERNEL);
+    if (!stats)
+        return NULL;
+    stats->name = name;
+    stats->counters = alloc_percpu(struct fpga_dev_counters);
+    if (!stats->counters)
+        goto fail;
+
+    // sysfs 가 없어도 debugfs 표에는 나온다
+    if (devices_kobj) {
+        stats->kobj = kobject_create_and_add(name, devices_kobj);
+        if (stats->kobj && sysfs_create_group(stats->kobj, &dev_attr_group)) {
+            kobject_put(stats->kobj);
+            stats->kobj = NULL;
+        }
+    }
+
+    mutex_lock(&dev_stats_lock);
+    for (i = 0; i < FPGA_MAX_DEVICES; i++) {
+        if (!dev_stats[i]) {
+            dev_stats[i] = stats;
+            break;
+        }
+    }
+    mutex_unlock(&dev_stats_lock);
+    if (i < FPGA_MAX_DEVICES)
+        return stats;
+
+    kobject_put(stats->kobj);
+fail:
+    free_percpu(stats->counters);
+    kfree(stats);
+    pr_warn("%s: no statistics for %s\n", __func__, name);
+    return NULL;
+}
+EXPORT_SYMBOL(fpga_dev_stats_register);
+
+void fpga_dev_stats_unregister(struct fpga_dev_stats *stats)
+{
+    int i;
+
+    if (!stats)
+        return;
+
+    mutex_lock(&dev_stats_lock);
+    for (i = 0; i < FPGA_MAX_DEVICES; i++)
+        if (dev_stats[i] == stats)
+            dev_stats[i] = NULL;
+    mutex_unlock(&dev_stats_lock);
+
+    // sysfs 파일을 읽는 중인 쪽이 끝날 때까지 kobject_put 이 기다린다 (잠금 밖에서 호출)
+    kobject_put(stats->kobj);
+    free_percpu(stats->counters);
+    kfree(stats);
+}
+EXPORT_SYMBOL(fpga_dev_stats_unregister);
+
+static void fpga_stats_init(void)
+{
+    unsigned int addr;
+    int r, c, cpu;
+
+    for (addr = 0; addr < FPGA_ADDRESS_SPACE; addr++)
+        itf_region_map[addr] = ITF_REGION_OTHER;
+    for (r = 0; r < ITF_REGION_OTHER; r++)
+        for (addr = itf_regions[r].first; addr <= itf_regions[r].last; addr++)
+            itf_region_map[addr] = r;
+    for (r = 0; r < ITF_REGION_COUNT; r++) {
+        itf_region_class[r] = itf_regions[r].class;
+        itf_coalesce_us[r] = -1;
+    }
+    for_each_possible_cpu(cpu)
+        u64_stats_init(&per_cpu_ptr(&itf_stats, cpu)->syncp);
+
+    // 통계 파일을 만들지 못해도 드라이버는 동작한다
+    fpga_kobj = kobject_create_and_add("fpga", kernel_kobj);
+    if (fpga_kobj) {
+        if (sysfs_create_file(fpga_kobj, &reset_attr.attr))
+            pr_warn("%s: no sysfs reset\n", __func__);
+        bus_kobj = kobject_create_and_add("bus", fpga_kobj);
+        if (bus_kobj && sysfs_create_group(bus_kobj, &batch_attr_group))
+            pr_warn("%s: no sysfs batch counters\n", __func__);
+        devices_kobj = kobject_create_and_add("devices", fpga_kobj);
+        comp_kobj = kobject_create_and_add("compositor", fpga_kobj);
+        if (comp_kobj && sysfs_create_group(comp_kobj, &comp_attr_group))
+            pr_warn("%s: no sysfs compositor\n", __func__);
+    }
+    for (r = 0; bus_kobj && r < ITF_REGION_COUNT; r++) {
+        region_kobjs[r] = kobject_create_and_add(itf_regions[r].name, bus_kobj);
+        if (region_kobjs[r] && sysfs_create_group(region_kobjs[r], &region_attr_group)) {
+            kobject_put(region_kobjs[r]);
+            region_kobjs[r] = NULL;
+        }
+    }
+
+    if (bus_kobj)
+        classes_kobj = kobject_create_and_add("classes", bus_kobj);
+    for (c = 0; classes_kobj && c < ITF_CLASS_COUNT; c++) {
+        class_kobjs[c] = kobject_create_and_add(itf_class_names[c], classes_kobj);
+        if (class_kobjs[c] && sysfs_create_group(class_kobjs[c], &class_attr_group)) {
+            kobject_put(class_kobjs[c]);
+            class_kobjs[c] = NULL;
+        }
+    }
+
+    fpga_debugfs = debugfs_create_dir("fpga", NULL);
+    debugfs_create_file("bus", 0444, fpga_debugfs, NULL, &bus_fops);
+    debugfs_create_file("devices", 0444, fpga_debugfs, NULL, &devices_fops);
+    debugfs_create_file("scenes", 0444, fpga_debugfs, NULL, &scenes_fops);
+    debugfs_create_file("reset", 0200, fpga_debugfs, NULL, &reset_fops);
+    debugfs_create_file("flush", 0200, fpga_debugfs, NULL, &flush_fops);
+}
+
+static void fpga_stats_exit(void)
+{
+    int r, c;
+
+    debugfs_remove_recursive(fpga_debugfs);
+    for (r = 0; r < ITF_REGION_COUNT; r++)
+        kobject_put(region_kobjs[r]);
+    for (c = 0; c < ITF_CLASS_COUNT; c++)
+        kobject_put(class_kobjs[c]);
+    kobject_put(classes_kobj);
+    kobject_put(bus_kobj);
+    kobject_put(devices_kobj);
+    kobject_put(comp_kobj);
+    kobject_put(fpga_kobj);
+}
+
+static void __exit iom_fpga_itf_exit(void)
+{
+    pr_info("exit module: %s\n", __func__);
+    // 디스플레이 드라이버는 이미 내려갔다, 남은 쓰기를 보내고 끝낸다
+    destroy_workqueue(fpga_cmd_wq);
+    fpga_scene_free_all();
+    hrtimer_cancel(&comp_timer);
+    cancel_work_sync(&comp_work);
+    itf_comp_commit(false);
+    hrtimer_cancel(&coalesce_timer);
+    cancel_work_sync(&coalesce_work);
+    itf_coalesce_flush();
+    misc_deregister(&fpga_status_dev);
+    fpga_stats_exit();
+    if (gpio_regs) {
+        iounmap(gpio_regs);
+    }
+    free_page((unsigned long)itf_status);
+}
+
+static int __init iom_fpga_itf_init(void)
+{
+    int i, ret;
+
+    ret = fpga_status_init();
+    if (ret)
+        return ret;
+
+    hrtimer_init(&coalesce_timer, CLOCK_MONOTONIC, HRTIMER_MODE_ABS);
+    coalesce_timer.function = itf_coalesce_timer_fn;
+    INIT_WORK(&coalesce_work, itf_coalesce_work_fn);
+    hrtimer_init(&comp_timer, CLOCK_MONOTONIC, HRTIMER_MODE_REL);
+    comp_timer.function = itf_comp_timer_fn;
+    INIT_WORK(&comp_work, itf_comp_work_fn);
+
+    // io_uring 명령은 제출 순서대로 하나씩 버스에 보낸다
+    fpga_cmd_wq = alloc_ordered_workqueue("fpga_cmd", WQ_HIGHPRI);
+    if (!fpga_cmd_wq) {
+        free_page((unsigned long)itf_status);
+        return -ENOMEM;
+    }
+
+    ret = misc_register(&fpga_status_dev);
+    if (ret) {
+        destroy_workqueue(fpga_cmd_wq);
+        free_page((unsigned long)itf_status);
+        return ret;
+    }
+
+    fpga_stats_init();
+    address_mask = itf_bus_pins(FPGA_ADDRESS_SPACE - 1, 0);
+    data_mask = itf_bus_pins(0, 0xff);
+
+    if (sim) {
+        pr_info("init module: %s (simulated bus)\n", __func__);
+        return 0;
+    }
     pr_info("init module: %s (Direct I/O Mode)\n", __func__);
 
     gpio_regs = ioremap(GPIO_BASE, GPIO_SIZE);
     if (!gpio_regs) {
         pr_err("Failed to map GPIO memory\n");
+        fpga_stats_exit();
+        misc_deregister(&fpga_status_dev);
+        destroy_workqueue(fpga_cmd_wq);
+        free_page((unsigned long)itf_status);
         return -ENOMEM;
     }
 
     // GPIO 10 (A0)는 제어하지 않음. 하드웨어 기본 상태(pull-down)에 의존.
-    
+    // 주소/데이터 핀은 모두 0 으로 시작한다 (bus_pins 의 초기값과 같다)
     for (i = 0; i < ARRAY_SIZE(address_gpios); i++) {
         set_gpio_output(address_gpios[i]);
         set_gpio_value(address_gpios[i], 0);
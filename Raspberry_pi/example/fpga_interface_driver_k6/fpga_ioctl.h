@@ -0,0 +1,133 @@
+/*
+ * FPGA device command interface shared by the kernel drivers and user space
+ *
+ * Every FPGA output device (/dev/fpga_led, fpga_fnd, fpga_dot,
+ * fpga_text_lcd, fpga_buzzer) accepts a batch of device commands, either
+ * with one ioctl(FPGA_IOC_SUBMIT) or as an io_uring IORING_OP_URING_CMD
+ * with cmd_op FPGA_IOC_SUBMIT and struct fpga_cmd_batch in sqe->cmd.
+ * A batch may address any of the devices, not only the one whose file
+ * descriptor carries it; all of its register writes go to the bus as one
+ * iom_fpga_itf_write_batch(). A device that another process has open
+ * cannot be addressed: the batch (or scene activation) fails with -EBUSY
+ * and nothing is written, the same as a second open() of that device. The
+ * data of a command is exactly what a write() to that device takes:
+ *   led      1 byte
+ *   fnd      4 digits (0~9)
+ *   dot      up to 10 row bytes
+ *   text_lcd up to 32 characters
+ *   buzzer   1 byte (0 / 1)
+ * A batch is checked completely before anything is written, so an invalid
+ * command fails the whole batch with nothing on the bus. The ioctl returns
+ * the number of commands, the io_uring completion carries the same value
+ * (or -errno) in cqe->res. io_uring completions are delivered in
+ * submission order.
+ *
+ * Scenes: FPGA_IOC_SCENE_SET stores a named batch of commands in the
+ * kernel (the desired state of some or all devices, checked and encoded
+ * at upload; count 0 deletes the scene). FPGA_IOC_SCENE_ACTIVATE with the
+ * name compares the scene register by register with the last values on
+ * the bus (the status page, fpga_status.h) and sends only the registers
+ * that differ, as one bus batch. It returns the number of register writes
+ * sent, so switching to the scene that is already shown costs one syscall
+ * and no bus traffic. Registers whose value is unknown (never written or
+ * read since the module was loaded) are always sent. Up to FPGA_SCENE_MAX
+ * scenes of up to FPGA_SCENE_WRITES distinct registers each are kept until
+ * the interface driver is unloaded.
+ *
+ * Dot matrix text: /dev/fpga_dot keeps a glyph for every character code
+ * (ASCII built in, digits as in libfpga fpga_font.hpp kDotDigits, other
+ * codes blank) in the driver's dot_font table. FPGA_IOC_DOT_GLYPH replaces
+ * one glyph or restores the built-in one. FPGA_IOC_DOT_MODE selects what a
+ * write() to /dev/fpga_dot means:
+ *   FPGA_DOT_RAW     up to 10 row bytes (the default, reset on every open)
+ *   FPGA_DOT_TEXT    characters, the last one is shown
+ *   FPGA_DOT_SCROLL  up to FPGA_DOT_SCROLL_MAX characters scrolled from
+ *                    right to left one column every step_ms, repeated
+ *                    until the next write() or FPGA_IOC_DOT_MODE
+ * A trailing newline is ignored in both text modes. Text is rendered into
+ * the driver's frame buffer and only the rows that changed are written.
+ *
+ * This header is included by user space (libfpga) as well, so it only
+ * uses the uapi types. All argument structs have the same layout for 32
+ * and 64 bit user space (only fixed-size fields, __u64 for pointers), so
+ * the drivers pass 32-bit ioctls through compat_ptr_ioctl unchanged.
+ */
+#ifndef FPGA_IOCTL_H
+#define FPGA_IOCTL_H
+
+#include <linux/ioctl.h>
+#include <linux/types.h>
+
+enum fpga_cmd_device {
+    FPGA_CMD_LED,
+    FPGA_CMD_FND,
+    FPGA_CMD_DOT,
+    FPGA_CMD_TEXT_LCD,
+    FPGA_CMD_BUZZER,
+    FPGA_CMD_DEVICES,
+};
+
+#define FPGA_CMD_DATA 32  // 가장 긴 명령 (text_lcd 32 칸)
+#define FPGA_CMD_MAX  32  // 배치 하나의 명령 수
+
+struct fpga_cmd {
+    __u64 cookie;            // fpga:fpga_dev_write 추적 쿠키 (pwrite 오프셋과 같은 뜻, 0: 없음)
+    __u8 device;             // enum fpga_cmd_device
+    __u8 len;                // data 에서 쓰는 바이트 수
+    __u8 reserved[6];        // 0 (아니면 -EINVAL)
+    __u8 data[FPGA_CMD_DATA];
+};
+
+/* ioctl 인자이자 io_uring sqe->cmd 의 내용 (64 바이트 SQE 의 16 바이트 칸에 들어간다) */
+struct fpga_cmd_batch {
+    __u64 cmds;              // struct fpga_cmd 배열의 사용자 주소
+    __u32 count;             // 1 ~ FPGA_CMD_MAX
+    __u32 flags;             // 0
+};
+
+#define FPGA_SCENE_NAME   16  // NUL 포함
+#define FPGA_SCENE_MAX    32  // 저장할 수 있는 장면 수
+#define FPGA_SCENE_WRITES 64  // 장면 하나의 레지스터 수 (같은 레지스터는 하나로 친다)
+
+/* FPGA_IOC_SCENE_SET / FPGA_IOC_SCENE_ACTIVATE 의 인자 */
+struct fpga_scene {
+    char name[FPGA_SCENE_NAME];  // NUL 로 끝나는 이름
+    __u64 cmds;              // SET: struct fpga_cmd 배열의 사용자 주소
+    __u32 count;             // SET: 0 ~ FPGA_CMD_MAX (0 이면 지운다)
+    __u32 flags;             // 0
+    __u64 cookie;            // ACTIVATE: fpga:fpga_dev_write 추적 쿠키 (0: 없음)
+};
+
+#define FPGA_DOT_ROWS       10
+#define FPGA_DOT_SCROLL_MAX 64  // FPGA_DOT_SCROLL 문자열의 최대 길이
+
+enum fpga_dot_mode_kind {
+    FPGA_DOT_RAW,
+    FPGA_DOT_TEXT,
+    FPGA_DOT_SCROLL,
+};
+
+#define FPGA_DOT_GLYPH_DEFAULT 0x1  // 내장 글리프로 되돌린다 (rows 는 보지 않는다)
+
+/* FPGA_IOC_DOT_GLYPH 의 인자 */
+struct fpga_dot_glyph {
+    __u8 code;               // 문자 코드 0~255
+    __u8 flags;              // 0 또는 FPGA_DOT_GLYPH_DEFAULT
+    __u8 rows[FPGA_DOT_ROWS];  // write() 와 같은 행 바이트 (bit 6 = 왼쪽 열)
+    __u8 reserved[4];        // 0
+};
+
+/* FPGA_IOC_DOT_MODE 의 인자 */
+struct fpga_dot_mode {
+    __u32 mode;              // enum fpga_dot_mode_kind
+    __u32 step_ms;           // SCROLL: 한 열을 미는 간격 10~10000 (0: 모듈 인자 scroll_ms)
+};
+
+#define FPGA_IOC_MAGIC 'F'
+#define FPGA_IOC_SUBMIT _IOW(FPGA_IOC_MAGIC, 0x01, struct fpga_cmd_batch)
+#define FPGA_IOC_SCENE_SET _IOW(FPGA_IOC_MAGIC, 0x02, struct fpga_scene)
+#define FPGA_IOC_SCENE_ACTIVATE _IOW(FPGA_IOC_MAGIC, 0x03, struct fpga_scene)
+#define FPGA_IOC_DOT_GLYPH _IOW(FPGA_IOC_MAGIC, 0x10, struct fpga_dot_glyph)
+#define FPGA_IOC_DOT_MODE _IOW(FPGA_IOC_MAGIC, 0x11, struct fpga_dot_mode)
+
+#endif /* FPGA_IOCTL_H */
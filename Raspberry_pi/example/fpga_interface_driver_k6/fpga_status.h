@@ -0,0 +1,74 @@
+/*
+ * FPGA status page shared by the interface driver and user space
+ *
+ * fpga_interface_driver keeps one page with the last value on the bus of
+ * every peripheral register, plus an update counter and timestamp per
+ * peripheral. User space maps it read-only from /dev/fpga_status
+ * (mmap, PROT_READ, MAP_SHARED, offset 0, one page) and samples it without
+ * syscalls and without bus traffic.
+ *
+ * The page shows what the bus carried: output registers hold the last
+ * value written, input registers (DIP switch, push switches) the last value
+ * read by whoever polls them. Writes still parked in a coalescing window
+ * or in the compositor's back buffer appear once they reach the bus.
+ * updated_ns == 0 means the peripheral has not been touched since the
+ * module was loaded, so its value is unknown.
+ *
+ * Every update (one transaction or one batch chunk) is wrapped in a
+ * seqcount: seq is odd while the page changes. Readers copy the page and
+ * retry until seq was even and unchanged around the copy:
+ *
+ *     do {
+ *         s = __atomic_load_n(&page->seq, __ATOMIC_ACQUIRE);
+ *         copy = *page;
+ *         __atomic_thread_fence(__ATOMIC_ACQUIRE);
+ *     } while ((s & 1) || s != __atomic_load_n(&page->seq, __ATOMIC_RELAXED));
+ *
+ * Timestamps are CLOCK_MONOTONIC nanoseconds.
+ */
+#ifndef FPGA_STATUS_H
+#define FPGA_STATUS_H
+
+#include <linux/types.h>
+
+#define FPGA_STATUS_MAGIC   0x46504741  // "FPGA"
+#define FPGA_STATUS_VERSION 1
+
+/* fpga_interface_driver.c 의 itf_regions 순서와 같다 ("other" 는 없음) */
+enum fpga_status_device {
+    FPGA_STATUS_DIP_SWITCH,
+    FPGA_STATUS_FND,
+    FPGA_STATUS_STEP_MOTOR,
+    FPGA_STATUS_LED,
+    FPGA_STATUS_PUSH_SWITCH,
+    FPGA_STATUS_BUZZER,
+    FPGA_STATUS_TEXT_LCD,
+    FPGA_STATUS_DOT,
+    FPGA_STATUS_REGIONS,
+};
+
+struct fpga_status_region {
+    __u64 updates;     // 이 장치 레지스터를 건드린 트랜잭션/배치 수
+    __u64 updated_ns;  // 마지막으로 건드린 시각 (0: 아직 없음)
+};
+
+struct fpga_status {
+    __u32 magic;       // FPGA_STATUS_MAGIC
+    __u32 version;     // FPGA_STATUS_VERSION
+    __u32 seq;         // seqcount, 홀수면 갱신 중
+    __u32 size;        // sizeof(struct fpga_status)
+    __u64 updates;     // 전체 갱신 수
+    struct fpga_status_region region[FPGA_STATUS_REGIONS];
+
+    /* 레지스터 섀도, 주소 순서 그대로 */
+    __u8 dip_switch;       // 0x000
+    __u8 fnd[2];           // 0x003 0x004, 바이트마다 두 자리 (상위 니블이 앞 자리)
+    __u8 step_motor[5];    // 0x00C ~ 0x010 (0x00C on, 0x00E 방향, 0x010 속도)
+    __u8 led;              // 0x016
+    __u8 push_switch[9];   // 0x050 ~ 0x058
+    __u8 buzzer;           // 0x070
+    __u8 text_lcd[32];     // 0x090 ~ 0x0AF
+    __u8 dot[10];          // 0x210 ~ 0x219
+};
+
+#endif /* FPGA_STATUS_H */
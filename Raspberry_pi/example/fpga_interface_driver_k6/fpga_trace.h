@@ -0,0 +1,91 @@
+/*
+ * Tracepoints of the FPGA drivers
+ *
+ * fpga:fpga_dev_write fires once per device write() after the last bus
+ * transaction of that write has completed. 'cookie' is the file offset of
+ * the write: plain write() leaves it at 0, while libfpga passes the frame id
+ * of the pipeline through pwrite(), so user space can match each write to
+ * the camera frame that caused it. 'done_ns' is ktime_get_ns()
+ * (CLOCK_MONOTONIC, the same clock as std::chrono::steady_clock) when the
+ * write finished; 'bus_ns' is the time spent on the bus within the write.
+ *
+ *   echo 1 > /sys/kernel/tracing/events/fpga/fpga_dev_write/enable
+ *
+ * fpga:fpga_compose fires once per compositor tick that had something to
+ * commit: 'tick' counts the ticks since the compositor was enabled,
+ * 'bytes' is the number of register writes sent in the burst, 'elided'
+ * the dirty registers dropped because the bus already held their value,
+ * and 'commit_ns' the time from taking the back buffers to the end of
+ * the burst (bus and budget waits included).
+ *
+ * The event is defined (CREATE_TRACE_POINTS) and exported by
+ * fpga_interface_driver; the device drivers only call it.
+ */
+#undef TRACE_SYSTEM
+#define TRACE_SYSTEM fpga
+
+#if !defined(FPGA_TRACE_H) || defined(TRACE_HEADER_MULTI_READ)
+#define FPGA_TRACE_H
+
+#include <linux/ktime.h>
+#include <linux/string.h>
+#include <linux/tracepoint.h>
+
+TRACE_EVENT(fpga_dev_write,
+
+    TP_PROTO(const char *dev, u64 cookie, size_t len, u64 start_ns),
+
+    TP_ARGS(dev, cookie, len, start_ns),
+
+    TP_STRUCT__entry(
+        __array(char, dev, 16)
+        __field(u64, cookie)
+        __field(u32, len)
+        __field(u64, bus_ns)
+        __field(u64, done_ns)
+    ),
+
+    TP_fast_assign(
+        strscpy(__entry->dev, dev, sizeof(__entry->dev));
+        __entry->cookie = cookie;
+        __entry->len = len;
+        __entry->done_ns = ktime_get_ns();
+        __entry->bus_ns = __entry->done_ns - start_ns;
+    ),
+
+    TP_printk("dev=%s cookie=%llu len=%u bus_ns=%llu done_ns=%llu",
+              __entry->dev, __entry->cookie, __entry->len, __entry->bus_ns, __entry->done_ns)
+);
+
+TRACE_EVENT(fpga_compose,
+
+    TP_PROTO(u64 tick, unsigned int bytes, unsigned int elided, u64 commit_ns),
+
+    TP_ARGS(tick, bytes, elided, commit_ns),
+
+    TP_STRUCT__entry(
+        __field(u64, tick)
+        __field(u32, bytes)
+        __field(u32, elided)
+        __field(u64, commit_ns)
+    ),
+
+    TP_fast_assign(
+        __entry->tick = tick;
+        __entry->bytes = bytes;
+        __entry->elided = elided;
+        __entry->commit_ns = commit_ns;
+    ),
+
+    TP_printk("tick=%llu bytes=%u elided=%u commit_ns=%llu",
+              __entry->tick, __entry->bytes, __entry->elided, __entry->commit_ns)
+);
+
+#endif /* FPGA_TRACE_H */
+
+/* 모듈 밖(out-of-tree)에서 빌드하므로 이 디렉토리에서 다시 읽게 한다 (Makefile 의 -I$(src)) */
+#undef TRACE_INCLUDE_PATH
+#define TRACE_INCLUDE_PATH .
+#undef TRACE_INCLUDE_FILE
+#define TRACE_INCLUDE_FILE fpga_trace
+#include <trace/define_trace.h>
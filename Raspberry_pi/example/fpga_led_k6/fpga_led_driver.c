@@ -5,27 +5,63 @@
  * 8 LEDs on the FPGA board. It relies on 'fpga_interface_driver' for
  * the actual low-level hardware access.
  *
+ * Each of the 8 LED bits is also registered as an LED class device
+ * (/sys/class/leds/fpga::led0 ~ fpga::led7, bit 0 ~ bit 7), so kernel
+ * triggers (heartbeat, timer, cpu, disk-activity, ...) can drive status
+ * LEDs without a user-space process:
+ *   echo heartbeat > /sys/class/leds/fpga::led0/trigger
+ * Brightness changes only update a shared shadow byte and mark the bit as
+ * owned by its LED class device, which may happen in atomic context. The
+ * first change arms a tick of tick_ms milliseconds and the tick merges the
+ * owned bits into the interface driver's shadow of 0x016
+ * (iom_fpga_itf_shadow(), no bus read) and writes the byte once, so every
+ * change within a tick, from any number of LEDs and triggers, costs a
+ * single bus write (none if the byte ended up unchanged). Bits no LED class
+ * device has touched keep whatever write(), FPGA_IOC_SUBMIT or a scene put
+ * there. write() to /dev/fpga_led is written at once as before and hands
+ * all 8 bits back to it until an LED class device changes one again.
+ * Unloading the module leaves the LEDs as they are.
+ *
  * Updated for modern kernel conventions and stability.
  */
 #include <linux/module.h>
 #include <linux/kernel.h>
 #include <linux/fs.h>
+#include <linux/leds.h>
+#include <linux/mutex.h>
+#include <linux/workqueue.h>
 #include <linux/uaccess.h> // For copy_from_user/copy_to_user
 
+// 버스 접근/통계 함수 ('fpga_interface_driver.ko' 를 먼저 insmod 해야 합니다)
+#include "../fpga_interface_driver_k6/fpga_interface.h"
+
 #define IOM_LED_MAJOR 260
 #define IOM_LED_NAME "fpga_led"
 
 #define IOM_LED_ADDRESS 0x016 // LED의 물리 주소
+#define IOM_LED_COUNT 8
+
+static unsigned int tick_ms = 10;
+module_param(tick_ms, uint, 0644);
+MODULE_PARM_DESC(tick_ms, "Window in ms that combines LED class brightness changes into one bus write (default 10)");
+
+// /sys/kernel/fpga/devices/led 카운터
+static struct fpga_dev_stats *led_stats;
 
 /*
- * 이 함수들은 'fpga_interface_driver.ko' 모듈에 의해 제공됩니다.
- * 중요: 이 드라이버를 insmod 하기 전에 반드시 fpga_interface_driver.ko를 먼저 로드해야 합니다.
+ * LED 클래스 장치가 함께 쓰는 섀도 바이트. 비트 하나가 LED 하나이고 set_bit/clear_bit
+ * 로만 바꾸므로 어느 문맥에서든 고칠 수 있다. led_owned 는 LED 클래스 장치가 바꾼
+ * 비트들로, 틱은 이 비트들만 버스에 쓴다.
  */
-extern unsigned char iom_fpga_itf_read(unsigned int addr);
-extern ssize_t iom_fpga_itf_write(unsigned int addr, unsigned char value);
+static unsigned long led_shadow;
+static unsigned long led_owned;
+static DEFINE_MUTEX(led_write_lock);      // 섀도를 버스에 쓰는 쪽끼리 순서를 지킨다
+static void iom_led_flush_fn(struct work_struct *work);
+static DECLARE_DELAYED_WORK(led_flush_work, iom_led_flush_fn);
 
-// 여러 프로그램이 동시에 접근하는 것을 막기 위한 전역 변수
-static int ledport_usage = 0;
+static struct led_classdev led_cdevs[IOM_LED_COUNT];
+static char led_names[IOM_LED_COUNT][16];
+static bool led_cdevs_registered;
 
 /* 함수 프로토타입 선언 */
 static int iom_led_open(struct inode *inode, struct file *file);
@@ -40,22 +76,27 @@ static const struct file_operations iom_led_fops = {
     .write   = iom_led_write,
     .read    = iom_led_read,
     .release = iom_led_release,
+    .unlocked_ioctl = fpga_cmd_ioctl,
+    .compat_ioctl = compat_ptr_ioctl,
+    .uring_cmd = fpga_cmd_uring_cmd,
 };
 
 // /dev/fpga_led 장치 파일을 열 때 호출되는 함수
 static int iom_led_open(struct inode *inode, struct file *file)
 {
-    if (ledport_usage != 0)
+    if (fpga_cmd_claim(FPGA_CMD_LED)) {
+        fpga_dev_stats_inc(led_stats, FPGA_DEV_BUSY);
         return -EBUSY;
+    }
 
-    ledport_usage = 1;
+    fpga_dev_stats_inc(led_stats, FPGA_DEV_OPENS);
     return 0;
 }
 
 // /dev/fpga_led 장치 파일을 닫을 때 호출되는 함수
 static int iom_led_release(struct inode *inode, struct file *file)
 {
-    ledport_usage = 0;
+    fpga_cmd_unclaim(FPGA_CMD_LED);
     return 0;
 }
 
@@ -63,12 +104,24 @@ static int iom_led_release(struct inode *inode, struct file *file)
 static ssize_t iom_led_write(struct file *file, const char __user *buf, size_t len, loff_t *off)
 {
     unsigned char value;
+    u64 start;
 
     if (copy_from_user(&value, buf, 1)) {
+        fpga_dev_stats_inc(led_stats, FPGA_DEV_FAULTS);
         return -EFAULT;
     }
 
+    start = trace_fpga_dev_write_enabled() ? ktime_get_ns() : 0;
+    // 8 비트를 모두 쓰므로 LED 클래스 장치가 가진 비트도 돌려받는다 (마지막에 쓴 쪽이 이긴다)
+    mutex_lock(&led_write_lock);
+    WRITE_ONCE(led_shadow, value);
+    WRITE_ONCE(led_owned, 0);
     iom_fpga_itf_write((unsigned int)IOM_LED_ADDRESS, value);
+    mutex_unlock(&led_write_lock);
+    trace_fpga_dev_write("led", *off, 1, start);
+    fpga_dev_stats_inc(led_stats, FPGA_DEV_WRITES);
+    if (len != 1)
+        fpga_dev_stats_inc(led_stats, FPGA_DEV_SHORT_WRITES);
     return 1;
 }
 
@@ -78,14 +131,100 @@ static ssize_t iom_led_read(struct file *file, char __user *buf, size_t len, lof
     unsigned char value;
 
     value = iom_fpga_itf_read((unsigned int)IOM_LED_ADDRESS);
+    fpga_dev_stats_inc(led_stats, FPGA_DEV_READS);
 
     if (copy_to_user(buf, &value, 1)) {
+        fpga_dev_stats_inc(led_stats, FPGA_DEV_FAULTS);
         return -EFAULT;
     }
 
     return 1;
 }
 
+// FPGA_IOC_SUBMIT 명령 하나를 버스 쓰기로 바꾼다 (write() 와 같은 1 바이트)
+static int iom_led_encode(const struct fpga_cmd *cmd, struct fpga_bus_write *tx)
+{
+    if (cmd->len != 1)
+        return -EINVAL;
+    tx[0].addr = IOM_LED_ADDRESS;
+    tx[0].value = cmd->data[0];
+    return 1;
+}
+
+// 틱이 끝나면 LED 클래스 장치가 가진 비트만 바꿔 한 번에 쓴다, 바뀐 것이 없으면 쓰지 않는다
+static void iom_led_flush_fn(struct work_struct *work)
+{
+    u8 owned, current_value, value;
+    u64 start;
+
+    mutex_lock(&led_write_lock);
+    owned = READ_ONCE(led_owned) & 0xff;
+    // 나머지 비트는 write()/SUBMIT/장면이 쓴 값을 그대로 둔다, 섀도를 모를 때만 읽는다
+    if (!iom_fpga_itf_shadow((unsigned int)IOM_LED_ADDRESS, &current_value))
+        current_value = iom_fpga_itf_read((unsigned int)IOM_LED_ADDRESS);
+    value = (current_value & ~owned) | (READ_ONCE(led_shadow) & owned);
+    if (value != current_value) {
+        start = trace_fpga_dev_write_enabled() ? ktime_get_ns() : 0;
+        iom_fpga_itf_write((unsigned int)IOM_LED_ADDRESS, value);
+        trace_fpga_dev_write("led", 0, 1, start);
+        fpga_dev_stats_inc(led_stats, FPGA_DEV_WRITES);
+    }
+    mutex_unlock(&led_write_lock);
+}
+
+// 트리거가 타이머/인터럽트 문맥에서도 부르므로 잠들지 않는다
+static void iom_led_brightness_set(struct led_classdev *cdev, enum led_brightness brightness)
+{
+    int bit = cdev - led_cdevs;
+
+    if (brightness)
+        set_bit(bit, &led_shadow);
+    else
+        clear_bit(bit, &led_shadow);
+    set_bit(bit, &led_owned);
+    // 이미 틱이 걸려 있으면 그 틱의 쓰기에 합쳐진다
+    queue_delayed_work(system_highpri_wq, &led_flush_work, msecs_to_jiffies(READ_ONCE(tick_ms)));
+}
+
+static enum led_brightness iom_led_brightness_get(struct led_classdev *cdev)
+{
+    return test_bit(cdev - led_cdevs, &led_shadow) ? LED_ON : LED_OFF;
+}
+
+static int iom_led_classdev_init(void)
+{
+    int i, ret;
+
+    // 지금 켜져 있는 LED 를 그대로 보여 준다
+    led_shadow = iom_fpga_itf_read((unsigned int)IOM_LED_ADDRESS);
+    for (i = 0; i < IOM_LED_COUNT; i++) {
+        snprintf(led_names[i], sizeof(led_names[i]), "fpga::led%d", i);
+        led_cdevs[i].name = led_names[i];
+        led_cdevs[i].max_brightness = 1;
+        // 해제할 때 LED 를 끄지 않는다
+        led_cdevs[i].flags = LED_RETAIN_BRIGHTNESS;
+        led_cdevs[i].brightness_set = iom_led_brightness_set;
+        led_cdevs[i].brightness_get = iom_led_brightness_get;
+        ret = led_classdev_register(NULL, &led_cdevs[i]);
+        if (ret) {
+            while (--i >= 0)
+                led_classdev_unregister(&led_cdevs[i]);
+            return ret;
+        }
+    }
+    return 0;
+}
+
+static void iom_led_classdev_exit(void)
+{
+    int i;
+
+    // 트리거를 떼면서 걸린 틱까지 버리고 쓰지 않는다, LED 는 지금 상태로 남는다
+    for (i = 0; i < IOM_LED_COUNT; i++)
+        led_classdev_unregister(&led_cdevs[i]);
+    cancel_delayed_work_sync(&led_flush_work);
+}
+
 // 모듈 초기화 함수
 static int __init iom_led_init(void)
 {
@@ -95,12 +234,26 @@ static int __init iom_led_init(void)
         return result;
     }
     pr_info("init module, %s major number: %d\n", IOM_LED_NAME, IOM_LED_MAJOR);
+    led_stats = fpga_dev_stats_register("led");
+    if (fpga_cmd_register(FPGA_CMD_LED, iom_led_encode, led_stats))
+        pr_warn("%s: FPGA_IOC_SUBMIT is not available\n", IOM_LED_NAME);
+
+    // LED 클래스 장치가 없어도 /dev/fpga_led 는 동작한다
+    result = iom_led_classdev_init();
+    if (result)
+        pr_warn("%s: no LED class devices (%d)\n", IOM_LED_NAME, result);
+    else
+        led_cdevs_registered = true;
     return 0;
 }
 
 // 모듈 종료 함수
 static void __exit iom_led_exit(void)
 {
+    if (led_cdevs_registered)
+        iom_led_classdev_exit();
+    fpga_cmd_unregister(FPGA_CMD_LED);
+    fpga_dev_stats_unregister(led_stats);
     unregister_chrdev(IOM_LED_MAJOR, IOM_LED_NAME);
     pr_info("exit module, %s\n", IOM_LED_NAME);
 }
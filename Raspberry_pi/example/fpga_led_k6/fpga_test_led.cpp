@@ -0,0 +1,51 @@
+/* FPGA LED Test Application
+File : fpga_test_led.cpp*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include "fpga.hpp"
+
+int main(int argc, char **argv)
+{
+	int data;
+	uint8_t value;
+
+	if(argc!=2) {
+		printf("please input the parameter! \n");
+		printf("ex)./test_led 7 (0~255)\n");
+		return -1;
+	}
+
+	data = atoi(argv[1]);
+	if((data<0)||(data>0xff))
+	{
+		printf("Invalid range!\n");
+		exit(1);
+	}
+
+	fpga::Led led = fpga::Led::open();
+	if (!led.ok()) {
+		printf("Device open error : %s\n",fpga::kLedDevice);
+		printf("%d \n", led.error());
+		exit(1);
+	}
+
+	if(led.set(data)<0) {
+		printf("Write Error!\n");
+		return -1;
+	}
+
+	sleep(1);
+
+	if(led.get(value)<0) {
+		printf("Read Error!\n");
+		return -1;
+	}
+	printf("Current LED Value : 0x%x\n",value);
+
+	printf("\n");
+
+	return(0);
+}
@@ -0,0 +1,198 @@
+/*
+ * FPGA Push Switch Driver for Linux Kernel 6.x
+ *
+ * The nine push switches (0x050 ~ 0x058, one byte each, non-zero while
+ * pressed) are offered two ways:
+ * - /dev/fpga_push_switch : read() of up to 9 bytes, the interface of the
+ *   original driver (one process at a time).
+ * - an input device "FPGA push switches" (/dev/input/eventN): a polled
+ *   input handler samples all nine buttons with one
+ *   iom_fpga_itf_read_batch() every poll_ms milliseconds and reports
+ *   EV_KEY press/release events. Any number of processes can open it and
+ *   wait for the buttons with poll/epoll next to their other file
+ *   descriptors instead of reading the bus themselves. Sampling only runs
+ *   while the event device is open; the interval can be changed at
+ *   runtime in /sys/class/input/inputN/poll (ms).
+ * The buttons report KEY_1 ~ KEY_9 (the 3x3 keypad layout) by default, the
+ * map can be changed with EVIOCSKEYCODE.
+ *
+ * It relies on 'fpga_interface_driver' for the actual bus access.
+ */
+#include <linux/module.h>
+#include <linux/kernel.h>
+#include <linux/fs.h>
+#include <linux/input.h>
+#include <linux/uaccess.h> // For copy_to_user
+
+// 버스 접근/통계 함수 ('fpga_interface_driver.ko' 를 먼저 insmod 해야 합니다)
+#include "../fpga_interface_driver_k6/fpga_interface.h"
+
+#define IOM_PUSH_SWITCH_MAJOR 265
+#define IOM_PUSH_SWITCH_NAME "fpga_push_switch"
+
+#define IOM_PUSH_SWITCH_ADDRESS 0x050 // 첫 번째 버튼의 물리 주소
+#define MAX_BUTTON 9
+
+static unsigned int poll_ms = 20;
+module_param(poll_ms, uint, 0444);
+MODULE_PARM_DESC(poll_ms, "Input device sampling interval in ms (1~1000, default 20)");
+
+// 여러 프로그램이 동시에 읽는 것을 막기 위한 전역 변수 (입력 장치는 제한 없음)
+static int push_switch_usage = 0;
+
+// /sys/kernel/fpga/devices/push_switch 카운터
+static struct fpga_dev_stats *push_switch_stats;
+
+static struct input_dev *push_switch_input;
+
+// 버튼 -> 키 코드 (EVIOCSKEYCODE 로 바꿀 수 있다)
+static unsigned short push_switch_keymap[MAX_BUTTON] = {
+    KEY_1, KEY_2, KEY_3,
+    KEY_4, KEY_5, KEY_6,
+    KEY_7, KEY_8, KEY_9,
+};
+
+/* 함수 프로토타입 선언 */
+static int iom_push_switch_open(struct inode *inode, struct file *file);
+static int iom_push_switch_release(struct inode *inode, struct file *file);
+static ssize_t iom_push_switch_read(struct file *file, char __user *buf, size_t len, loff_t *off);
+
+/* 파일 오퍼레이션 구조체 */
+static const struct file_operations iom_push_switch_fops = {
+    .owner   = THIS_MODULE,
+    .open    = iom_push_switch_open,
+    .read    = iom_push_switch_read,
+    .release = iom_push_switch_release,
+};
+
+// /dev/fpga_push_switch 장치 파일을 열 때 호출되는 함수
+static int iom_push_switch_open(struct inode *inode, struct file *file)
+{
+    if (push_switch_usage != 0) {
+        fpga_dev_stats_inc(push_switch_stats, FPGA_DEV_BUSY);
+        return -EBUSY;
+    }
+
+    push_switch_usage = 1;
+    fpga_dev_stats_inc(push_switch_stats, FPGA_DEV_OPENS);
+    return 0;
+}
+
+// /dev/fpga_push_switch 장치 파일을 닫을 때 호출되는 함수
+static int iom_push_switch_release(struct inode *inode, struct file *file)
+{
+    push_switch_usage = 0;
+    return 0;
+}
+
+// /dev/fpga_push_switch 장치 파일에서 read()를 할 때 호출되는 함수 (최대 9 바이트)
+static ssize_t iom_push_switch_read(struct file *file, char __user *buf, size_t len, loff_t *off)
+{
+    unsigned char value[MAX_BUTTON];
+    int ret;
+
+    if (len > MAX_BUTTON)
+        len = MAX_BUTTON;
+    if (len == 0)
+        return 0;
+
+    ret = iom_fpga_itf_read_batch(IOM_PUSH_SWITCH_ADDRESS, value, len);
+    if (ret < 0)
+        return ret;
+    fpga_dev_stats_inc(push_switch_stats, FPGA_DEV_READS);
+
+    if (copy_to_user(buf, value, len)) {
+        fpga_dev_stats_inc(push_switch_stats, FPGA_DEV_FAULTS);
+        return -EFAULT;
+    }
+
+    return len;
+}
+
+// 입력 장치를 연 쪽이 있는 동안 poll_ms 마다 불린다 (작업 큐 문맥, 잠들어도 된다)
+static void iom_push_switch_poll(struct input_dev *input)
+{
+    const unsigned short *keymap = input->keycode;
+    unsigned char value[MAX_BUTTON];
+    int i;
+
+    if (iom_fpga_itf_read_batch(IOM_PUSH_SWITCH_ADDRESS, value, MAX_BUTTON) < 0)
+        return;
+
+    // 입력 코어가 같은 상태는 버리므로 바뀐 버튼만 이벤트가 된다
+    for (i = 0; i < MAX_BUTTON; i++)
+        input_report_key(input, keymap[i], value[i] != 0);
+    input_sync(input);
+}
+
+static int iom_push_switch_input_init(void)
+{
+    struct input_dev *input;
+    int i, ret;
+
+    input = input_allocate_device();
+    if (!input)
+        return -ENOMEM;
+
+    input->name = "FPGA push switches";
+    input->phys = "fpga/push_switch";
+    input->id.bustype = BUS_HOST;
+    input->keycode = push_switch_keymap;
+    input->keycodesize = sizeof(push_switch_keymap[0]);
+    input->keycodemax = ARRAY_SIZE(push_switch_keymap);
+    __set_bit(EV_KEY, input->evbit);
+    for (i = 0; i < MAX_BUTTON; i++)
+        __set_bit(push_switch_keymap[i], input->keybit);
+
+    ret = input_setup_polling(input, iom_push_switch_poll);
+    if (ret)
+        goto fail;
+    input_set_poll_interval(input, clamp_t(unsigned int, poll_ms, 1, 1000));
+    input_set_min_poll_interval(input, 1);
+    input_set_max_poll_interval(input, 1000);
+
+    ret = input_register_device(input);
+    if (ret)
+        goto fail;
+    push_switch_input = input;
+    return 0;
+
+fail:
+    input_free_device(input);
+    return ret;
+}
+
+// 모듈 초기화 함수
+static int __init iom_push_switch_init(void)
+{
+    int result = register_chrdev(IOM_PUSH_SWITCH_MAJOR, IOM_PUSH_SWITCH_NAME, &iom_push_switch_fops);
+    if (result < 0) {
+        pr_warn("Can't get major number %d for device %s\n", IOM_PUSH_SWITCH_MAJOR, IOM_PUSH_SWITCH_NAME);
+        return result;
+    }
+    pr_info("init module, %s major number: %d\n", IOM_PUSH_SWITCH_NAME, IOM_PUSH_SWITCH_MAJOR);
+    push_switch_stats = fpga_dev_stats_register("push_switch");
+
+    // 입력 장치가 없어도 read() 는 동작한다
+    result = iom_push_switch_input_init();
+    if (result)
+        pr_warn("%s: no input device (%d)\n", IOM_PUSH_SWITCH_NAME, result);
+    return 0;
+}
+
+// 모듈 종료 함수
+static void __exit iom_push_switch_exit(void)
+{
+    if (push_switch_input)
+        input_unregister_device(push_switch_input);
+    fpga_dev_stats_unregister(push_switch_stats);
+    unregister_chrdev(IOM_PUSH_SWITCH_MAJOR, IOM_PUSH_SWITCH_NAME);
+    pr_info("exit module, %s\n", IOM_PUSH_SWITCH_NAME);
+}
+
+module_init(iom_push_switch_init);
+module_exit(iom_push_switch_exit);
+
+MODULE_LICENSE("GPL");
+MODULE_AUTHOR("Your Name");
+MODULE_DESCRIPTION("FPGA push switch device driver");
@@ -0,0 +1,266 @@
+/* FPGA Push Switch Test Application
+File : fpga_test_push_switch.cpp
+
+Usage: fpga_test_push_switch              read() every 400 ms (the original test)
+       fpga_test_push_switch evdev        wait for key events with epoll
+       fpga_test_push_switch cost [sec]   CPU cost of both ways of sampling
+
+'cost' runs each way for sec seconds (default 10): first a read() of the 9
+buttons every 400 ms, then the input device opened and idle in
+epoll_wait() while the driver samples at its own interval
+(/sys/class/input/inputN/poll). For each it prints the samples taken on
+the bus, the bus time of the push switch region
+(/sys/kernel/fpga/bus/push_switch), the CPU time of this process and the
+busy time of all CPUs from /proc/stat, which also counts the kernel
+worker that samples for the input device (jiffy resolution). */
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <linux/input.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/epoll.h>
+#include <sys/ioctl.h>
+#include <sys/resource.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "fpga.hpp"
+
+static const char *kInputName = "FPGA push switches";
+
+unsigned char quit = 0;
+
+void user_signal1(int sig)
+{
+	quit = 1;
+}
+
+// 이름이 kInputName 인 /dev/input/eventN 을 연다, 없으면 -1
+static int open_input(char *event, size_t size)
+{
+	DIR *dir = opendir("/dev/input");
+	struct dirent *ent;
+	char path[300], name[64];
+	int fd = -1;
+
+	if (!dir)
+		return -1;
+	while (fd < 0 && (ent = readdir(dir))) {
+		if (strncmp(ent->d_name, "event", 5))
+			continue;
+		snprintf(path, sizeof(path), "/dev/input/%s", ent->d_name);
+		fd = open(path, O_RDONLY | O_NONBLOCK | O_CLOEXEC);
+		if (fd < 0)
+			continue;
+		memset(name, 0, sizeof(name));
+		if (ioctl(fd, EVIOCGNAME(sizeof(name) - 1), name) < 0 || strcmp(name, kInputName)) {
+			close(fd);
+			fd = -1;
+			continue;
+		}
+		snprintf(event, size, "%s", ent->d_name);
+	}
+	closedir(dir);
+	return fd;
+}
+
+static unsigned long long read_counter(const char *path)
+{
+	FILE *fp = fopen(path, "r");
+	unsigned long long value = 0;
+
+	if (fp) {
+		if (fscanf(fp, "%llu", &value) != 1)
+			value = 0;
+		fclose(fp);
+	}
+	return value;
+}
+
+// 모든 CPU 의 busy 시간 (ns), 읽지 못하면 0
+static double system_busy_ns()
+{
+	FILE *fp = fopen("/proc/stat", "r");
+	unsigned long long user, nice, sys, idle, iowait, irq, softirq;
+
+	if (!fp)
+		return 0;
+	int n = fscanf(fp, "cpu %llu %llu %llu %llu %llu %llu %llu",
+		       &user, &nice, &sys, &idle, &iowait, &irq, &softirq);
+	fclose(fp);
+	if (n != 7)
+		return 0;
+	return (double)(user + nice + sys + irq + softirq) * 1e9 / sysconf(_SC_CLK_TCK);
+}
+
+static double process_cpu_ns()
+{
+	struct rusage ru;
+
+	getrusage(RUSAGE_SELF, &ru);
+	return (ru.ru_utime.tv_sec + ru.ru_stime.tv_sec) * 1e9 +
+	       (ru.ru_utime.tv_usec + ru.ru_stime.tv_usec) * 1e3;
+}
+
+struct Sample {
+	unsigned long long reads, busy_ns;
+	double proc_ns, sys_ns;
+};
+
+static Sample take_sample()
+{
+	Sample s;
+
+	s.reads = read_counter("/sys/kernel/fpga/bus/push_switch/reads");
+	s.busy_ns = read_counter("/sys/kernel/fpga/bus/push_switch/busy_ns");
+	s.proc_ns = process_cpu_ns();
+	s.sys_ns = system_busy_ns();
+	return s;
+}
+
+static void print_cost(const char *name, const Sample &before, const Sample &after, int sec)
+{
+	// 버튼 9 개를 한 번 읽는 것이 샘플 하나
+	double samples = (after.reads - before.reads) / (double)fpga::kPushSwitchButtons;
+
+	printf("%-8s %8.1f samples/s %10.1f us bus/s %10.1f us proc cpu/s %10.1f us sys cpu/s\n",
+	       name, samples / sec, (after.busy_ns - before.busy_ns) / 1e3 / sec,
+	       (after.proc_ns - before.proc_ns) / 1e3 / sec, (after.sys_ns - before.sys_ns) / 1e3 / sec);
+}
+
+static int run_read(void)
+{
+	fpga::PushSwitchState state;
+	int i;
+
+	fpga::PushSwitch push = fpga::PushSwitch::open();
+	if (!push.ok()) {
+		printf("Device Open Error : %s\n", fpga::kPushSwitchDevice);
+		return -1;
+	}
+
+	printf("Press <ctrl+c> to quit. \n");
+	while (!quit) {
+		usleep(400000);
+		if (push.get(state) < 0)
+			continue;
+
+		for (i = 0; i < (int)state.size(); i++) {
+			printf("[%d] ", state[i]);
+		}
+		printf("\n");
+	}
+	return 0;
+}
+
+static int run_evdev(void)
+{
+	struct epoll_event ev = {}, events[4];
+	struct input_event in[16];
+	char event[32];
+	int fd, ep, n, i;
+	ssize_t len;
+
+	fd = open_input(event, sizeof(event));
+	if (fd < 0) {
+		printf("Input device \"%s\" not found\n", kInputName);
+		return -1;
+	}
+	printf("%s : /dev/input/%s\n", kInputName, event);
+
+	// 카메라나 타이머 fd 도 같은 epoll 에 넣으면 된다
+	ep = epoll_create1(EPOLL_CLOEXEC);
+	ev.events = EPOLLIN;
+	ev.data.fd = fd;
+	epoll_ctl(ep, EPOLL_CTL_ADD, fd, &ev);
+
+	printf("Press <ctrl+c> to quit. \n");
+	while (!quit) {
+		n = epoll_wait(ep, events, 4, -1);
+		if (n <= 0)
+			continue;
+		while ((len = read(fd, in, sizeof(in))) > 0) {
+			for (i = 0; i < (int)(len / sizeof(in[0])); i++) {
+				if (in[i].type == EV_KEY)
+					printf("key %d %s\n", in[i].code, in[i].value ? "pressed" : "released");
+			}
+		}
+	}
+	close(ep);
+	close(fd);
+	return 0;
+}
+
+static int run_cost(int sec)
+{
+	struct epoll_event ev = {}, events[4];
+	struct input_event in[16];
+	fpga::PushSwitchState state;
+	char event[32], path[128];
+	Sample before, after;
+	struct timespec end, now;
+	int fd, ep;
+
+	fpga::PushSwitch push = fpga::PushSwitch::open(fpga::Backend::Device);
+	if (!push.ok()) {
+		printf("Device Open Error : %s\n", fpga::kPushSwitchDevice);
+		return -1;
+	}
+
+	printf("sampling for %d s each\n", sec);
+	before = take_sample();
+	for (int i = 0; i < sec * 10 / 4 && !quit; i++) {
+		usleep(400000);
+		push.get(state);
+	}
+	after = take_sample();
+	print_cost("read", before, after, sec);
+	push = fpga::PushSwitch();
+
+	fd = open_input(event, sizeof(event));
+	if (fd < 0) {
+		printf("Input device \"%s\" not found\n", kInputName);
+		return -1;
+	}
+	snprintf(path, sizeof(path), "/sys/class/input/%s/device/poll", event);
+	printf("input device poll interval %llu ms\n", read_counter(path));
+
+	ep = epoll_create1(EPOLL_CLOEXEC);
+	ev.events = EPOLLIN;
+	ev.data.fd = fd;
+	epoll_ctl(ep, EPOLL_CTL_ADD, fd, &ev);
+
+	before = take_sample();
+	clock_gettime(CLOCK_MONOTONIC, &end);
+	end.tv_sec += sec;
+	for (;;) {
+		clock_gettime(CLOCK_MONOTONIC, &now);
+		int left = (end.tv_sec - now.tv_sec) * 1000 + (end.tv_nsec - now.tv_nsec) / 1000000;
+		if (left <= 0 || quit)
+			break;
+		if (epoll_wait(ep, events, 4, left) > 0) {
+			while (read(fd, in, sizeof(in)) > 0)
+				;
+		}
+	}
+	after = take_sample();
+	print_cost("evdev", before, after, sec);
+
+	close(ep);
+	close(fd);
+	return 0;
+}
+
+int main(int argc, char **argv)
+{
+	(void)signal(SIGINT, user_signal1);
+
+	if (argc > 1 && !strcmp(argv[1], "evdev"))
+		return run_evdev();
+	if (argc > 1 && !strcmp(argv[1], "cost"))
+		return run_cost(argc > 2 && atoi(argv[2]) > 0 ? atoi(argv[2]) : 10);
+	return run_read();
+}
@@ -0,0 +1,36 @@
+/* FPGA Text LCD Test Application
+File : fpga_test_text_lcd.cpp*/
+
+#include <stdio.h>
+#include <string.h>
+
+#include "fpga.hpp"
+
+int main(int argc, char **argv)
+{
+	if(argc!=3 || strlen(argv[1])<1 || strlen(argv[2])<1)
+	{
+		printf("Usage: sudo ./fpga_test_text_lcd abc 123\n");
+		return -1;
+	}
+
+	if(strlen(argv[1])>fpga::kTextLcdLine||strlen(argv[2])>fpga::kTextLcdLine)
+	{
+		printf("16 alphanumeric characters on a line!\n");
+		return -1;
+	}
+
+	fpga::TextLcd lcd = fpga::TextLcd::open();
+	if (!lcd.ok()) {
+		printf("Device open error : %s\n",fpga::kTextLcdDevice);
+		return -1;
+	}
+
+	// 각 줄의 남는 칸은 공백으로 채워서 32바이트를 한 번에 쓴다
+	if(lcd.set_lines(argv[1],argv[2])<0) {
+		printf("Write Error!\n");
+		return -1;
+	}
+
+	return(0);
+}
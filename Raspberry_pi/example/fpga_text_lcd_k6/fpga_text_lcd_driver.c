@@ -11,18 +11,16 @@
 #include <linux/fs.h>
 #include <linux/uaccess.h> // For copy_from_user
 
+// 버스 접근/통계 함수 ('fpga_interface_driver.ko' 를 먼저 insmod 해야 합니다)
+#include "../fpga_interface_driver_k6/fpga_interface.h"
+
 #define IOM_FPGA_TEXT_LCD_MAJOR 263
 #define IOM_FPGA_TEXT_LCD_NAME "fpga_text_lcd"
 
 #define IOM_FPGA_TEXT_LCD_ADDRESS 0x090 // Text LCD의 물리 주소
 
-/*
- * 이 함수는 'fpga_interface_driver.ko' 모듈에 의해 제공됩니다.
- */
-extern ssize_t iom_fpga_itf_write(unsigned int addr, unsigned char value);
-
-// 동시 접근 방지를 위한 전역 변수
-static int fpga_text_lcd_port_usage = 0;
+// /sys/kernel/fpga/devices/text_lcd 카운터
+static struct fpga_dev_stats *text_lcd_stats;
 
 /* 함수 프로토타입 선언 */
 static int iom_fpga_text_lcd_open(struct inode *inode, struct file *file);
@@ -35,21 +33,26 @@ static const struct file_operations iom_fpga_text_lcd_fops = {
     .open    = iom_fpga_text_lcd_open,
     .write   = iom_fpga_text_lcd_write,
     .release = iom_fpga_text_lcd_release,
+    .unlocked_ioctl = fpga_cmd_ioctl,
+    .compat_ioctl = compat_ptr_ioctl,
+    .uring_cmd = fpga_cmd_uring_cmd,
 };
 
 // /dev/fpga_text_lcd 장치 파일을 열 때 호출
 static int iom_fpga_text_lcd_open(struct inode *inode, struct file *file)
 {
-    if (fpga_text_lcd_port_usage != 0)
+    if (fpga_cmd_claim(FPGA_CMD_TEXT_LCD)) {
+        fpga_dev_stats_inc(text_lcd_stats, FPGA_DEV_BUSY);
         return -EBUSY;
-    fpga_text_lcd_port_usage = 1;
+    }
+    fpga_dev_stats_inc(text_lcd_stats, FPGA_DEV_OPENS);
     return 0;
 }
 
 // /dev/fpga_text_lcd 장치 파일을 닫을 때 호출
 static int iom_fpga_text_lcd_release(struct inode *inode, struct file *file)
 {
-    fpga_text_lcd_port_usage = 0;
+    fpga_cmd_unclaim(FPGA_CMD_TEXT_LCD);
     return 0;
 }
 
@@ -58,9 +61,12 @@ static ssize_t iom_fpga_text_lcd_write(struct file *file, const char __user *buf
 {
     int i;
     unsigned char value[33]; // 32 chars + null terminator
+    struct fpga_bus_write tx[32];
+    u64 start;
     size_t length_to_copy = len > (sizeof(value) - 1) ? (sizeof(value) - 1) : len;
 
     if (copy_from_user(value, buf, length_to_copy)) {
+        fpga_dev_stats_inc(text_lcd_stats, FPGA_DEV_FAULTS);
         return -EFAULT;
     }
     value[length_to_copy] = '\0'; // 문자열 끝을 명시
@@ -68,12 +74,31 @@ static ssize_t iom_fpga_text_lcd_write(struct file *file, const char __user *buf
     pr_info("Writing to LCD: %s (size: %zu)\n", value, length_to_copy);
 
     for (i = 0; i < length_to_copy; i++) {
-        iom_fpga_itf_write((unsigned int)IOM_FPGA_TEXT_LCD_ADDRESS + i, value[i]);
+        tx[i].addr = IOM_FPGA_TEXT_LCD_ADDRESS + i;
+        tx[i].value = value[i];
     }
+    start = trace_fpga_dev_write_enabled() ? ktime_get_ns() : 0;
+    iom_fpga_itf_write_batch(tx, length_to_copy);
 
+    trace_fpga_dev_write("text_lcd", *off, length_to_copy, start);
+    fpga_dev_stats_inc(text_lcd_stats, FPGA_DEV_WRITES);
+    if (len != sizeof(value) - 1)
+        fpga_dev_stats_inc(text_lcd_stats, FPGA_DEV_SHORT_WRITES);
     return length_to_copy;
 }
 
+// FPGA_IOC_SUBMIT 명령 하나를 버스 쓰기로 바꾼다 (write() 와 같이 32 칸까지)
+static int iom_fpga_text_lcd_encode(const struct fpga_cmd *cmd, struct fpga_bus_write *tx)
+{
+    int i;
+
+    for (i = 0; i < cmd->len; i++) {
+        tx[i].addr = IOM_FPGA_TEXT_LCD_ADDRESS + i;
+        tx[i].value = cmd->data[i];
+    }
+    return cmd->len;
+}
+
 // 모듈 초기화 함수
 static int __init iom_fpga_text_lcd_init(void)
 {
@@ -83,12 +108,17 @@ static int __init iom_fpga_text_lcd_init(void)
         return result;
     }
     pr_info("init module, %s major number: %d\n", IOM_FPGA_TEXT_LCD_NAME, IOM_FPGA_TEXT_LCD_MAJOR);
+    text_lcd_stats = fpga_dev_stats_register("text_lcd");
+    if (fpga_cmd_register(FPGA_CMD_TEXT_LCD, iom_fpga_text_lcd_encode, text_lcd_stats))
+        pr_warn("%s: FPGA_IOC_SUBMIT is not available\n", IOM_FPGA_TEXT_LCD_NAME);
     return 0;
 }
 
 // 모듈 종료 함수
 static void __exit iom_fpga_text_lcd_exit(void)
 {
+    fpga_cmd_unregister(FPGA_CMD_TEXT_LCD);
+    fpga_dev_stats_unregister(text_lcd_stats);
     unregister_chrdev(IOM_FPGA_TEXT_LCD_MAJOR, IOM_FPGA_TEXT_LCD_NAME);
     pr_info("exit module, %s\n", IOM_FPGA_TEXT_LCD_NAME);
 }
@@ -0,0 +1,89 @@
+/*
+ * Class -> FPGA device actuation for finger_detect
+ */
+#include "actuator.hpp"
+
+namespace finger {
+
+Actuator::Actuator(fpga::Board &board, const std::vector<std::string> &class_names)
+    : board_(board), names_(class_names)
+{
+    table_.parse(fpga::kDefaultActions, names_);
+    upload_scenes();
+}
+
+void Actuator::upload_scenes()
+{
+    scenes_ = false;
+    scene_names_.assign(table_.classes(), std::string());
+    for (int cls = 0; cls < table_.classes(); cls++) {
+        if (!table_.has(cls))
+            continue;
+        // 커널 장면 이름은 FPGA_SCENE_NAME 보다 짧아야 한다
+        std::string name = names_[cls];
+        if (name.empty() || name.size() >= FPGA_SCENE_NAME)
+            name = "class" + std::to_string(cls);
+        if (board_.upload_scene(name, table_.scene(cls)) < 0)
+            return;
+        scene_names_[cls] = name;
+    }
+    scenes_ = board_.uses_kernel_scenes();
+}
+
+int Actuator::load(const std::string &path)
+{
+    fpga::ActionTable table;
+    int ret = table.load(path, names_);
+
+    error_line_ = table.error_line();
+    if (ret < 0)
+        return ret;
+
+    table_ = std::move(table);
+    path_ = path;
+    // 클래스 번호는 모델 순서 그대로이므로 이전 클래스의 리셋 동작은 새 표로 이어진다
+    upload_scenes();
+    return 0;
+}
+
+int Actuator::reload()
+{
+    if (path_.empty())
+        return 0;
+    return load(path_);
+}
+
+int Actuator::apply(int class_id, std::uint64_t cookie)
+{
+    if (!table_.has(class_id))
+        return 0;
+
+    int ret;
+    if (scenes_) {
+        ret = board_.activate_scene(scene_names_[class_id], cookie);
+    } else {
+        const fpga::Batch &batch = table_.transition(prev_class_, class_id);
+        if (!cookie) {
+            ret = board_.submit(batch);
+        } else {
+            fpga::Batch tagged = batch;
+            tagged.cookie = cookie;
+            ret = board_.submit(tagged);
+        }
+    }
+    // 실패하면 이전 클래스를 그대로 두어 재시도가 이전 클래스의 리셋까지 다시 쓴다
+    if (ret < 0)
+        return ret;
+
+    if (table_.switches(prev_class_, class_id))
+        switches_++;
+    prev_class_ = class_id;
+    return ret;
+}
+
+const char *Actuator::active() const
+{
+    return prev_class_ >= 0 ? table_.devices(prev_class_).c_str() : "none";
+}
+
+} // namespace finger
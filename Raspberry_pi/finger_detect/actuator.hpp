@@ -0,0 +1,71 @@
+/*
+ * Class -> FPGA device actuation for finger_detect
+ *
+ * The mapping comes from an action config (libfpga fpga_actions.hpp,
+ * actions.conf); without one the built-in table reproduces the class_map
+ * of yolo_last.py. The config is compiled into one prebuilt libfpga Batch
+ * per (previous class, new class) pair, so a decision costs one table
+ * lookup and at most one Board::submit(). When the drivers keep scenes,
+ * every class is also uploaded as a kernel scene (ActionTable::scene) and
+ * a decision is one Board::activate_scene() ioctl that writes only the
+ * registers that changed. reload() re-reads the config
+ * (SIGHUP) and keeps the old table when the new file has an error.
+ */
+#ifndef FINGER_DETECT_ACTUATOR_HPP
+#define FINGER_DETECT_ACTUATOR_HPP
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "fpga.hpp"
+#include "fpga_actions.hpp"
+
+namespace finger {
+
+class Actuator {
+public:
+    // 기본 표(yolo_last.py 의 class_map)로 시작한다
+    Actuator(fpga::Board &board, const std::vector<std::string> &class_names);
+
+    // 설정 파일을 읽는다, 오류면 -errno 이고 쓰던 표가 그대로 남는다 (error_line())
+    int load(const std::string &path);
+    // 마지막으로 load() 한 파일을 다시 읽는다 (파일이 없었으면 기본 표)
+    int reload();
+
+    /*
+     * Apply the action of one detected class. Classes without an action are
+     * ignored. A non-zero cookie tags the driver writes for latency tracing
+     * (fpga::Batch::cookie). Returns the number of devices written (register
+     * writes when kernel scenes are used), or -errno. After an error the
+     * previous class stays active, so a retry also resets its devices.
+     */
+    int apply(int class_id, std::uint64_t cookie = 0);
+
+    // 지금 구동 중인 디바이스 이름 ("dot", "led+fnd", 아직 없으면 "none")
+    const char *active() const;
+    unsigned long switches() const { return switches_; }
+    int error_line() const { return error_line_; }
+    const std::string &path() const { return path_; }
+    const fpga::ActionTable &table() const { return table_; }
+    // apply() 가 커널 장면으로 전환하는지
+    bool uses_scenes() const { return scenes_; }
+
+private:
+    // 동작이 있는 클래스마다 장면을 올린다, 하나라도 실패하면 전환 표를 쓴다
+    void upload_scenes();
+
+    fpga::Board &board_;
+    const std::vector<std::string> &names_;
+    fpga::ActionTable table_;
+    std::string path_;
+    std::vector<std::string> scene_names_; // [cls]
+    bool scenes_ = false;
+    int prev_class_ = -1;
+    int error_line_ = 0;
+    unsigned long switches_ = 0;
+};
+
+} // namespace finger
+
+#endif // FINGER_DETECT_ACTUATOR_HPP
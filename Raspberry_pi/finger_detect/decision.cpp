@@ -0,0 +1,79 @@
+/*
+ * Temporal smoothing of per-frame detections into stable class decisions
+ */
+#include "decision.hpp"
+
+#include <algorithm>
+
+namespace finger {
+
+const Detection *best_detection(const std::vector<Detection> &dets)
+{
+    const Detection *best = nullptr;
+
+    for (const Detection &d : dets) {
+        if (!best || d.score > best->score)
+            best = &d;
+    }
+    return best;
+}
+
+DecisionSmoother::DecisionSmoother(int num_classes, const SmootherOptions &options)
+    : options_(options),
+      acquire_(num_classes, options.acquire),
+      release_(num_classes, options.release),
+      history_(std::max(options.window, 1), -1),
+      counts_(num_classes + 1, 0)
+{
+}
+
+void DecisionSmoother::set_class_votes(int cls, int acquire, int release)
+{
+    if (cls < 0 || std::size_t(cls) >= acquire_.size())
+        return;
+    acquire_[cls] = acquire;
+    release_[cls] = release;
+}
+
+int DecisionSmoother::update(const Detection *best)
+{
+    const int num_classes = int(acquire_.size());
+    int vote = -1;
+
+    if (best && best->score >= options_.min_conf && best->cls >= 0 && best->cls < num_classes)
+        vote = best->cls;
+
+    // 창에서 가장 오래된 표를 빼고 새 표를 넣는다
+    if (filled_ == history_.size())
+        counts_[history_[next_] + 1]--;
+    else
+        filled_++;
+    history_[next_] = vote;
+    counts_[vote + 1]++;
+    next_ = (next_ + 1) % history_.size();
+    held_++;
+
+    if (active_ >= 0 && votes(active_) < release_[active_])
+        active_ = -1;
+
+    // 활성 클래스가 해제된 뒤에만 다른 클래스가 자리를 차지할 수 있다
+    if (active_ < 0) {
+        int challenger = -1;
+
+        for (int c = 0; c < num_classes; c++) {
+            if (votes(c) >= acquire_[c] && (challenger < 0 || votes(c) > votes(challenger)))
+                challenger = c;
+        }
+        if (challenger >= 0 && (decided_ < 0 || challenger == decided_ || held_ >= options_.min_hold))
+            active_ = challenger;
+    }
+
+    if (active_ >= 0 && active_ != decided_) {
+        decided_ = active_;
+        held_ = 0;
+        changes_++;
+    }
+    return decided_;
+}
+
+} // namespace finger
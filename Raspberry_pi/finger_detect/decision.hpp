@@ -0,0 +1,70 @@
+/*
+ * Temporal smoothing of per-frame detections into stable class decisions
+ *
+ * Every frame casts one vote: the class of its highest-confidence box, or
+ * "none" when there is no box above min_conf. Over a sliding window of M
+ * frames a class becomes active once it collects 'acquire' votes, and the
+ * active class is only released when its votes fall below 'release'
+ * (release < acquire gives hysteresis). A new class can take over only
+ * after the active one has been held for 'min_hold' frames.
+ *
+ * A released class leaves the output unchanged: like yolo_last.py, losing
+ * the hand does not reset the device that is currently shown.
+ */
+#ifndef FINGER_DETECT_DECISION_HPP
+#define FINGER_DETECT_DECISION_HPP
+
+#include <vector>
+
+#include "yolo.hpp"
+
+namespace finger {
+
+struct SmootherOptions {
+    float min_conf = 0.5f;
+    int window = 5;  // M
+    int acquire = 3; // N: M 프레임 중 N 표 이상이면 활성화
+    int release = 2; // 활성 클래스의 표가 이보다 적어지면 해제
+    int min_hold = 0;
+};
+
+// 점수가 가장 높은 검출, 없으면 nullptr (dets 정렬 여부와 무관)
+const Detection *best_detection(const std::vector<Detection> &dets);
+
+class DecisionSmoother {
+public:
+    DecisionSmoother(int num_classes, const SmootherOptions &options);
+
+    // 클래스별 활성화/해제 표 수를 따로 지정한다
+    void set_class_votes(int cls, int acquire, int release);
+
+    /*
+     * Feed the best detection of one frame (nullptr when nothing was
+     * found) and return the decided class, -1 until one is established.
+     */
+    int update(const Detection *best);
+
+    int active() const { return active_; }
+    unsigned long changes() const { return changes_; }
+
+private:
+    int votes(int cls) const { return counts_[cls + 1]; }
+
+    SmootherOptions options_;
+    std::vector<int> acquire_;
+    std::vector<int> release_;
+
+    std::vector<int> history_; // 최근 M 프레임의 표 (-1: 없음)
+    std::vector<int> counts_;  // [0] = 없음, [c + 1] = 클래스 c
+    std::size_t next_ = 0;
+    std::size_t filled_ = 0;
+
+    int active_ = -1;       // 현재 표가 유지되고 있는 클래스
+    int decided_ = -1;      // 마지막으로 내보낸 결정
+    long held_ = 0;         // decided_ 를 유지한 프레임 수
+    unsigned long changes_ = 0;
+};
+
+} // namespace finger
+
+#endif // FINGER_DETECT_DECISION_HPP
@@ -0,0 +1,130 @@
+/* YOLO output decoder microbenchmark
+File : decode_bench.cpp
+
+Usage: decode_bench [iterations] [dump.f32]
+
+Builds a synthetic [1, 9, 8400] output tensor (640x640 input, 5 classes)
+with a cluster of overlapping boxes around one hand, a few stray boxes
+and low background scores, then times
+  - decode()          generic per-anchor decoder from yolo.hpp
+  - Decoder::decode   streaming SIMD scan + class-bucketed NMS
+  - Decoder::top1     best box only
+and checks that the first two agree. With a file name the tensor is
+also written as raw float32 so decode_bench.py can time the Python
+postprocess on the same data. */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include "decoder.hpp"
+#include "yolo.hpp"
+
+using finger::Detection;
+
+static const int kClasses = 5;
+static const int kAnchors = 8400;
+
+template <typename Op>
+static double bench(long iterations, Op op)
+{
+	using clock = std::chrono::steady_clock;
+
+	op();
+	auto start = clock::now();
+	for (long i = 0; i < iterations; i++)
+		op();
+	auto end = clock::now();
+
+	return std::chrono::duration<double, std::micro>(end - start).count() / iterations;
+}
+
+static float frand(float lo, float hi)
+{
+	return lo + (hi - lo) * (rand() / (float)RAND_MAX);
+}
+
+static std::vector<float> make_output()
+{
+	std::vector<float> out((4 + kClasses) * kAnchors);
+	float *rows[4 + kClasses];
+
+	for (int r = 0; r < 4 + kClasses; r++)
+		rows[r] = out.data() + r * kAnchors;
+
+	srand(7);
+	for (int i = 0; i < kAnchors; i++) {
+		rows[0][i] = frand(0, 640);
+		rows[1][i] = frand(80, 560);
+		rows[2][i] = frand(10, 200);
+		rows[3][i] = frand(10, 200);
+		for (int c = 0; c < kClasses; c++)
+			rows[4 + c][i] = frand(0, 0.02f);
+	}
+	// 손 하나 주변에 겹치는 후보 60 개 (대부분 dev3, 일부 dev2)
+	for (int k = 0; k < 60; k++) {
+		int i = rand() % kAnchors;
+		rows[0][i] = 320 + frand(-12, 12);
+		rows[1][i] = 300 + frand(-12, 12);
+		rows[2][i] = 150 + frand(-10, 10);
+		rows[3][i] = 180 + frand(-10, 10);
+		rows[4 + (k % 6 ? 2 : 1)][i] = frand(0.3f, 0.9f);
+	}
+	// 엉뚱한 곳의 약한 후보
+	for (int k = 0; k < 10; k++)
+		rows[4 + rand() % kClasses][rand() % kAnchors] = frand(0.26f, 0.4f);
+	return out;
+}
+
+static bool same(const std::vector<Detection> &a, const std::vector<Detection> &b)
+{
+	if (a.size() != b.size())
+		return false;
+	for (size_t i = 0; i < a.size(); i++)
+		if (a[i].cls != b[i].cls || a[i].score != b[i].score || a[i].x1 != b[i].x1 || a[i].y2 != b[i].y2)
+			return false;
+	return true;
+}
+
+int main(int argc, char **argv)
+{
+	long iterations = argc > 1 ? atol(argv[1]) : 2000;
+
+	if (iterations <= 0) {
+		printf("Usage: %s [iterations] [dump.f32]\n", argv[0]);
+		return -1;
+	}
+
+	std::vector<float> output = make_output();
+	if (argc > 2) {
+		FILE *fp = fopen(argv[2], "wb");
+		if (!fp || fwrite(output.data(), sizeof(float), output.size(), fp) != output.size()) {
+			printf("Write error : %s\n", argv[2]);
+			return -1;
+		}
+		fclose(fp);
+	}
+
+	finger::Letterbox lb = finger::make_letterbox(640, 480, 640, 640);
+	finger::DecodeParams params;
+	finger::Decoder decoder(kClasses, params);
+	std::vector<Detection> generic, fast;
+	Detection best{};
+	bool found = false;
+
+	double us_generic = bench(iterations, [&] {
+		finger::decode(output.data(), 4 + kClasses, kAnchors, kClasses, lb, params, generic);
+	});
+	double us_fast = bench(iterations, [&] { decoder.decode(output.data(), 4 + kClasses, kAnchors, lb, fast); });
+	double us_top1 = bench(iterations, [&] { found = decoder.top1(output.data(), 4 + kClasses, kAnchors, lb, best); });
+
+	printf("output [1, %d, %d] iterations=%ld\n", 4 + kClasses, kAnchors, iterations);
+	printf("%-20s %8.1f us  %zu boxes\n", "decode (generic)", us_generic, generic.size());
+	printf("%-20s %8.1f us  %zu boxes  x%.2f  %s\n", "Decoder::decode", us_fast, fast.size(),
+	       us_generic / us_fast, same(generic, fast) ? "same" : "DIFFERENT");
+	printf("%-20s %8.1f us  cls=%d  x%.2f  %s\n", "Decoder::top1", us_top1, found ? best.cls : -1,
+	       us_generic / us_top1, found && !generic.empty() && best.score == generic[0].score ? "same" : "DIFFERENT");
+
+	return same(generic, fast) ? 0 : 1;
+}
@@ -0,0 +1,81 @@
+"""YOLO 후처리 (Python) 시간 측정, decode_bench 와 같은 출력 텐서를 쓴다
+
+사용법:
+    ./decode_bench 2000 out.f32
+    python3 decode_bench.py out.f32 [iterations]
+
+- ultralytics 가 있으면 yolo_last.py 가 프레임마다 거치는
+  ultralytics.utils.ops.non_max_suppression (torch + torchvision NMS) 을 잰다
+- numpy 만 있으면 같은 처리를 numpy 로 옮긴 것을 잰다
+"""
+import sys
+import time
+
+import numpy as np
+
+CLASSES = 5
+ANCHORS = 8400
+CONF = 0.25
+IOU = 0.7
+
+
+def numpy_postprocess(output):
+    # [1, 4+nc, N] -> [N, 4+nc], 클래스 최대값으로 거른 뒤 클래스별 NMS
+    x = output[0].T
+    scores = x[:, 4:]
+    cls = scores.argmax(1)
+    conf = scores[np.arange(len(cls)), cls]
+    keep = conf > CONF
+    x, cls, conf = x[keep], cls[keep], conf[keep]
+    boxes = np.empty((len(x), 4), dtype=np.float32)
+    boxes[:, 0] = x[:, 0] - x[:, 2] / 2
+    boxes[:, 1] = x[:, 1] - x[:, 3] / 2
+    boxes[:, 2] = x[:, 0] + x[:, 2] / 2
+    boxes[:, 3] = x[:, 1] + x[:, 3] / 2
+    # 클래스마다 좌표를 띄워서 한 번의 NMS 로 처리 (ultralytics 와 같은 방법)
+    shifted = boxes + cls[:, None] * 7680.0
+    order = conf.argsort()[::-1]
+    areas = (shifted[:, 2] - shifted[:, 0]) * (shifted[:, 3] - shifted[:, 1])
+    kept = []
+    while order.size:
+        i = order[0]
+        kept.append(i)
+        rest = order[1:]
+        w = np.clip(np.minimum(shifted[i, 2], shifted[rest, 2]) - np.maximum(shifted[i, 0], shifted[rest, 0]), 0, None)
+        h = np.clip(np.minimum(shifted[i, 3], shifted[rest, 3]) - np.maximum(shifted[i, 1], shifted[rest, 1]), 0, None)
+        inter = w * h
+        order = rest[inter / (areas[i] + areas[rest] - inter) <= IOU]
+    return boxes[kept], conf[kept], cls[kept]
+
+
+def bench(name, iterations, fn):
+    fn()
+    t0 = time.perf_counter()
+    for _ in range(iterations):
+        result = fn()
+    us = (time.perf_counter() - t0) * 1e6 / iterations
+    print(f'{name:36s} {us:10.1f} us  {len(result[0])} boxes')
+
+
+def main():
+    if len(sys.argv) < 2:
+        raise SystemExit('usage: decode_bench.py out.f32 [iterations]')
+    iterations = int(sys.argv[2]) if len(sys.argv) > 2 else 500
+    output = np.fromfile(sys.argv[1], dtype=np.float32).reshape(1, 4 + CLASSES, ANCHORS)
+
+    print(f'output {list(output.shape)} iterations={iterations}')
+    bench('numpy postprocess', iterations, lambda: numpy_postprocess(output))
+
+    try:
+        import torch
+        from ultralytics.utils.ops import non_max_suppression
+    except ImportError:
+        print('ultralytics / torch not installed, skipping non_max_suppression')
+        return
+    prediction = torch.from_numpy(output)
+    bench('ultralytics non_max_suppression', iterations,
+          lambda: non_max_suppression(prediction, CONF, IOU))
+
+
+if __name__ == '__main__':
+    main()
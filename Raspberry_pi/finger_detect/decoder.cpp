@@ -0,0 +1,283 @@
+/*
+ * Streaming YOLO output decoder with class-bucketed NMS
+ */
+#include "decoder.hpp"
+
+#include <algorithm>
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define DECODER_NEON 1
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#define DECODER_SSE2 1
+#endif
+
+namespace finger {
+
+namespace {
+
+/*
+ * For anchors [i, i + 4) of the [4 + nc, anchors] layout: best score and
+ * class over the nc class rows. NC > 0 unrolls the class loop at compile
+ * time (our model has 5 classes); NC == 0 uses the runtime count.
+ */
+template <int NC>
+inline void best_of_4(const float *scores, std::size_t stride, int nc, int i, float *best, int *cls)
+{
+    const int n = NC > 0 ? NC : nc;
+
+#if defined(DECODER_NEON)
+    float32x4_t m = vld1q_f32(scores + i);
+    uint32x4_t k = vdupq_n_u32(0);
+    for (int c = 1; c < n; c++) {
+        float32x4_t s = vld1q_f32(scores + c * stride + i);
+        uint32x4_t gt = vcgtq_f32(s, m);
+        m = vmaxq_f32(m, s);
+        k = vbslq_u32(gt, vdupq_n_u32(c), k);
+    }
+    vst1q_f32(best, m);
+    vst1q_u32(reinterpret_cast<std::uint32_t *>(cls), k);
+#elif defined(DECODER_SSE2)
+    __m128 m = _mm_loadu_ps(scores + i);
+    __m128i k = _mm_setzero_si128();
+    for (int c = 1; c < n; c++) {
+        __m128 s = _mm_loadu_ps(scores + c * stride + i);
+        __m128i gt = _mm_castps_si128(_mm_cmpgt_ps(s, m));
+        m = _mm_max_ps(m, s);
+        k = _mm_or_si128(_mm_and_si128(gt, _mm_set1_epi32(c)), _mm_andnot_si128(gt, k));
+    }
+    _mm_storeu_ps(best, m);
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(cls), k);
+#else
+    for (int j = 0; j < 4; j++) {
+        best[j] = scores[i + j];
+        cls[j] = 0;
+        for (int c = 1; c < n; c++) {
+            float s = scores[c * stride + i + j];
+            if (s > best[j]) {
+                best[j] = s;
+                cls[j] = c;
+            }
+        }
+    }
+#endif
+}
+
+// 네 점수 중 threshold 를 넘는 레인의 비트 마스크
+inline unsigned above(const float *best, float threshold)
+{
+#if defined(DECODER_NEON)
+    uint32x4_t gt = vcgtq_f32(vld1q_f32(best), vdupq_n_f32(threshold));
+    static const uint32_t bits[4] = {1, 2, 4, 8};
+    uint32x4_t b = vandq_u32(gt, vld1q_u32(bits));
+    uint32x2_t s = vadd_u32(vget_low_u32(b), vget_high_u32(b));
+    return vget_lane_u32(vpadd_u32(s, s), 0);
+#elif defined(DECODER_SSE2)
+    return unsigned(_mm_movemask_ps(_mm_cmpgt_ps(_mm_loadu_ps(best), _mm_set1_ps(threshold))));
+#else
+    unsigned mask = 0;
+    for (int j = 0; j < 4; j++)
+        mask |= unsigned(best[j] > threshold) << j;
+    return mask;
+#endif
+}
+
+template <int NC, typename Push>
+void scan_rows(const float *output, int anchors, int nc, float threshold, Push &push)
+{
+    const float *scores = output + 4 * std::size_t(anchors);
+    const int n = NC > 0 ? NC : nc;
+    float best[4];
+    int cls[4];
+    int i = 0;
+
+    for (; i + 4 <= anchors; i += 4) {
+        best_of_4<NC>(scores, anchors, nc, i, best, cls);
+        // 대부분의 앵커는 여기서 걸러져 아무것도 쓰지 않는다
+        unsigned mask = above(best, threshold);
+        while (mask) {
+            int j = __builtin_ctz(mask);
+            mask &= mask - 1;
+            push(std::uint32_t(i + j), best[j], cls[j]);
+        }
+    }
+    for (; i < anchors; i++) {
+        float s = scores[i];
+        int c = 0;
+        for (int k = 1; k < n; k++) {
+            if (scores[std::size_t(k) * anchors + i] > s) {
+                s = scores[std::size_t(k) * anchors + i];
+                c = k;
+            }
+        }
+        if (s > threshold)
+            push(std::uint32_t(i), s, c);
+    }
+}
+
+inline float area(const Detection &d)
+{
+    return (d.x2 - d.x1) * (d.y2 - d.y1);
+}
+
+} // namespace
+
+Decoder::Decoder(int num_classes, const DecodeParams &params)
+    : num_classes_(std::min(num_classes, kMaxClasses)), params_(params)
+{
+}
+
+bool Decoder::layout(int rows, int cols, bool &transposed, int &anchors) const
+{
+    const int attrs = 4 + num_classes_;
+
+    transposed = rows == attrs;
+    anchors = transposed ? cols : rows;
+    return (transposed ? rows : cols) == attrs;
+}
+
+template <typename Push>
+void Decoder::scan(const float *output, int anchors, bool transposed, Push &push)
+{
+    if (!transposed) {
+        // [anchors, 4 + nc] 는 앵커 하나가 연속이라 그대로 읽어도 캐시에 맞다
+        const int attrs = 4 + num_classes_;
+        for (int i = 0; i < anchors; i++) {
+            const float *p = output + std::size_t(i) * attrs + 4;
+            int c = int(std::max_element(p, p + num_classes_) - p);
+            if (p[c] > params_.conf_threshold)
+                push(std::uint32_t(i), p[c], c);
+        }
+    } else if (num_classes_ == 5) {
+        scan_rows<5>(output, anchors, num_classes_, params_.conf_threshold, push);
+    } else {
+        scan_rows<0>(output, anchors, num_classes_, params_.conf_threshold, push);
+    }
+}
+
+Detection Decoder::box(const float *output, int anchors, bool transposed, const Candidate &c,
+                       const Letterbox &lb) const
+{
+    const std::size_t attr_stride = transposed ? anchors : 1;
+    const float *p = output + (transposed ? c.anchor : std::size_t(c.anchor) * (4 + num_classes_));
+    const float cx = p[0], cy = p[attr_stride], w = p[2 * attr_stride], h = p[3 * attr_stride];
+    Detection d;
+
+    d.x1 = std::clamp((cx - w * 0.5f - lb.pad_left) / lb.scale, 0.0f, float(lb.image_w));
+    d.y1 = std::clamp((cy - h * 0.5f - lb.pad_top) / lb.scale, 0.0f, float(lb.image_h));
+    d.x2 = std::clamp((cx + w * 0.5f - lb.pad_left) / lb.scale, 0.0f, float(lb.image_w));
+    d.y2 = std::clamp((cy + h * 0.5f - lb.pad_top) / lb.scale, 0.0f, float(lb.image_h));
+    d.score = c.score;
+    d.cls = c.cls;
+    return d;
+}
+
+void Decoder::decode(const float *output, int rows, int cols, const Letterbox &lb, std::vector<Detection> &out)
+{
+    bool transposed;
+    int anchors;
+
+    out.clear();
+    if (!layout(rows, cols, transposed, anchors))
+        return;
+
+    std::size_t n = 0;
+    bool heap = false;
+    // 점수가 가장 낮은 후보가 맨 앞에 오는 최소 힙
+    auto lower = [](const Candidate &a, const Candidate &b) { return a.score > b.score; };
+    auto push = [&](std::uint32_t anchor, float score, int cls) {
+        if (n < kMaxCandidates) {
+            candidates_[n++] = {anchor, score, cls};
+            return;
+        }
+        // 가득 차면 앵커 순서가 아니라 점수로 버린다: 가장 낮은 후보와 바꾼다
+        overflow_++;
+        if (!heap) {
+            std::make_heap(candidates_.begin(), candidates_.end(), lower);
+            heap = true;
+        }
+        if (score <= candidates_[0].score)
+            return;
+        std::pop_heap(candidates_.begin(), candidates_.end(), lower);
+        candidates_[kMaxCandidates - 1] = {anchor, score, cls};
+        std::push_heap(candidates_.begin(), candidates_.end(), lower);
+    };
+    scan(output, anchors, transposed, push);
+    if (n == 0)
+        return;
+
+    // 클래스 순, 같은 클래스 안에서는 점수 내림차순으로 정렬해 클래스별 구간을 만든다
+    for (std::size_t i = 0; i < n; i++) {
+        boxes_[i] = box(output, anchors, transposed, candidates_[i], lb);
+        areas_[i] = area(boxes_[i]);
+        order_[i] = std::uint16_t(i);
+    }
+    const bool agnostic = params_.agnostic;
+    std::sort(order_.begin(), order_.begin() + n, [&](std::uint16_t a, std::uint16_t b) {
+        if (!agnostic && boxes_[a].cls != boxes_[b].cls)
+            return boxes_[a].cls < boxes_[b].cls;
+        return boxes_[a].score > boxes_[b].score;
+    });
+
+    // 구간마다 NMS: 다른 클래스의 박스와는 비교하지 않는다
+    std::size_t kept = 0;
+    for (std::size_t begin = 0; begin < n;) {
+        std::size_t end = begin + 1;
+        while (end < n && (agnostic || boxes_[order_[end]].cls == boxes_[order_[begin]].cls))
+            end++;
+
+        const std::size_t bucket = kept;
+        for (std::size_t i = begin; i < end; i++) {
+            const Detection &d = boxes_[order_[i]];
+            const float a = areas_[order_[i]];
+            bool suppressed = false;
+
+            for (std::size_t k = bucket; k < kept; k++) {
+                const Detection &o = boxes_[kept_[k]];
+                float w = std::min(d.x2, o.x2) - std::max(d.x1, o.x1);
+                float h = std::min(d.y2, o.y2) - std::max(d.y1, o.y1);
+                if (w <= 0.0f || h <= 0.0f)
+                    continue;
+                float inter = w * h;
+                if (inter > params_.iou_threshold * (a + areas_[kept_[k]] - inter)) {
+                    suppressed = true;
+                    break;
+                }
+            }
+            if (!suppressed)
+                kept_[kept++] = order_[i];
+        }
+        begin = end;
+    }
+
+    for (std::size_t k = 0; k < kept; k++)
+        out.push_back(boxes_[kept_[k]]);
+    std::sort(out.begin(), out.end(), [](const Detection &a, const Detection &b) { return a.score > b.score; });
+    if (out.size() > params_.max_det)
+        out.resize(params_.max_det);
+}
+
+bool Decoder::top1(const float *output, int rows, int cols, const Letterbox &lb, Detection &best)
+{
+    bool transposed;
+    int anchors;
+
+    if (!layout(rows, cols, transposed, anchors))
+        return false;
+
+    // 후보를 쌓지 않고 가장 높은 점수 하나만 들고 간다
+    Candidate top{0, 0.0f, -1};
+    auto push = [&](std::uint32_t anchor, float score, int cls) {
+        if (top.cls < 0 || score > top.score)
+            top = {anchor, score, cls};
+    };
+    scan(output, anchors, transposed, push);
+    if (top.cls < 0)
+        return false;
+
+    best = box(output, anchors, transposed, top, lb);
+    return true;
+}
+
+} // namespace finger
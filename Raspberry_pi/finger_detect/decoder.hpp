@@ -0,0 +1,73 @@
+/*
+ * Streaming YOLO output decoder with class-bucketed NMS
+ *
+ * decode() in yolo.hpp reads one anchor at a time; with the YOLOv8 export
+ * layout [4 + nc, anchors] that touches 4 + nc cache lines per anchor.
+ * Decoder instead walks each class row from start to end, keeping the
+ * running best score and class of every anchor in SIMD registers, and
+ * compares against the confidence threshold before anything is stored.
+ * Only anchors that pass are copied into a fixed-capacity arena, so a
+ * frame never allocates once the output vector has grown. When more than
+ * kMaxCandidates pass, the arena becomes a min-heap on score and keeps the
+ * highest-scoring ones, so late anchors are not lost to early weak ones.
+ *
+ * NMS is specialised for a handful of classes: candidates are bucketed by
+ * class and only compared within their bucket (or across all of them when
+ * 'agnostic'). top1() is the fast path for the controller, which only
+ * uses the best box: the highest-scoring box always survives NMS, so it
+ * is a single arg-max pass without sorting or NMS.
+ */
+#ifndef FINGER_DETECT_DECODER_HPP
+#define FINGER_DETECT_DECODER_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "yolo.hpp"
+
+namespace finger {
+
+class Decoder {
+public:
+    static constexpr std::size_t kMaxCandidates = 1024; // 임계값을 넘은 앵커 보관 한도
+    static constexpr int kMaxClasses = 16;
+
+    Decoder(int num_classes, const DecodeParams &params);
+
+    // yolo.hpp decode() 와 같은 결과 (점수 내림차순, NMS 적용)
+    void decode(const float *output, int rows, int cols, const Letterbox &lb, std::vector<Detection> &out);
+
+    // 최고 점수 박스 하나, 임계값을 넘는 박스가 없으면 false
+    bool top1(const float *output, int rows, int cols, const Letterbox &lb, Detection &best);
+
+    const DecodeParams &params() const { return params_; }
+    // 보관 한도를 넘어 버려진 (점수가 가장 낮았던) 후보 수 (누적)
+    unsigned long overflow() const { return overflow_; }
+
+private:
+    struct Candidate {
+        std::uint32_t anchor;
+        float score;
+        int cls;
+    };
+
+    bool layout(int rows, int cols, bool &transposed, int &anchors) const;
+    template <typename Push>
+    void scan(const float *output, int anchors, bool transposed, Push &push);
+    Detection box(const float *output, int anchors, bool transposed, const Candidate &c, const Letterbox &lb) const;
+
+    int num_classes_;
+    DecodeParams params_;
+    std::array<Candidate, kMaxCandidates> candidates_;
+    std::array<Detection, kMaxCandidates> boxes_;
+    std::array<float, kMaxCandidates> areas_;
+    std::array<std::uint16_t, kMaxCandidates> order_;
+    std::array<std::uint16_t, kMaxCandidates> kept_;
+    unsigned long overflow_ = 0;
+};
+
+} // namespace finger
+
+#endif // FINGER_DETECT_DECODER_HPP
@@ -0,0 +1,147 @@
+/*
+ * YOLO detector running best_fixed.onnx through OpenCV DNN on the CPU
+ */
+#include "detector.hpp"
+
+#include <algorithm>
+#include <unistd.h>
+
+namespace finger {
+
+std::string int8_model_path(const DetectorOptions &options)
+{
+    if (!options.int8_model.empty())
+        return options.int8_model;
+
+    std::string path = options.model;
+    std::string::size_type dot = path.rfind('.');
+    if (dot != std::string::npos && path.find('/', dot) == std::string::npos)
+        path.erase(dot);
+    return path + ".int8.onnx";
+}
+
+Detector::Detector(const DetectorOptions &options)
+    : options_(options), decoder_(options.num_classes, options.decode)
+{
+    // 정밀도는 시작할 때 한 번만 고른다
+    std::string int8_path = int8_model_path(options_);
+    int8_ = options_.precision == Precision::Int8 ||
+            (options_.precision == Precision::Auto && access(int8_path.c_str(), R_OK) == 0);
+    model_path_ = int8_ ? int8_path : options_.model;
+
+    net_ = cv::dnn::readNetFromONNX(model_path_);
+    net_.setPreferableBackend(cv::dnn::DNN_BACKEND_OPENCV);
+    net_.setPreferableTarget(cv::dnn::DNN_TARGET_CPU);
+    output_names_ = net_.getUnconnectedOutLayersNames();
+}
+
+// crop 한 변을 step 의 배수로 올리고 같은 중심으로 프레임 안에 다시 놓는다
+static Roi quantize_roi(const Roi &roi, int image_w, int image_h, int step)
+{
+    Roi q = roi;
+    int side = std::max(roi.w, roi.h);
+
+    side = (side + step - 1) / step * step;
+    q.w = std::min(side, image_w);
+    q.h = std::min(side, image_h);
+    q.x = std::clamp(roi.x + roi.w / 2 - q.w / 2, 0, image_w - q.w);
+    q.y = std::clamp(roi.y + roi.h / 2 - q.h / 2, 0, image_h - q.h);
+    return q;
+}
+
+void Detector::detect(const cv::Mat &bgr, std::vector<Detection> &out)
+{
+    Roi roi;
+    roi.w = bgr.cols;
+    roi.h = bgr.rows;
+    detect(bgr, roi, out);
+}
+
+void Detector::detect(const cv::Mat &bgr, const Roi &roi, std::vector<Detection> &out)
+{
+    CV_Assert(bgr.type() == CV_8UC3);
+
+    ImageView image;
+    image.data = bgr.data;
+    image.width = bgr.cols;
+    image.height = bgr.rows;
+    image.stride = bgr.step[0];
+    image.format = PixelFormat::Bgr;
+    detect(image, roi, out);
+}
+
+void Detector::detect(const ImageView &frame, const Roi &planned, std::vector<Detection> &out)
+{
+    const int roi_input = options_.roi_input > 0 ? options_.roi_input : options_.input_w;
+    const Roi roi = planned.full ? planned
+                                 : quantize_roi(planned, frame.width, frame.height, std::max(roi_input / 2, 16));
+
+    // crop 은 복사 없이 원본 프레임의 stride 로 읽는다 (YUYV 는 색차 쌍 때문에 짝수 열에서 시작)
+    ImageView image = frame;
+    int crop_x = 0, crop_y = 0;
+    if (!roi.full) {
+        crop_x = frame.format == PixelFormat::Yuyv ? roi.x & ~1 : roi.x;
+        crop_y = roi.y;
+        image.data = frame.data + std::size_t(crop_y) * frame.stride + std::size_t(crop_x) * bytes_per_pixel(frame.format);
+        image.width = roi.w;
+        image.height = roi.h;
+    }
+    const int in_w = roi.full ? options_.input_w : roi_input;
+    const int in_h = roi.full ? options_.input_h : roi_input;
+
+    // ultralytics 와 같은 전처리 (비율 유지 리사이즈, 회색(114) 여백, BGR->RGB, /255) 를
+    // 미리 잡아 둔 입력 텐서에 한 번에 쓴다
+    Preprocessor *pre = nullptr;
+    if (roi.full) {
+        if (!full_pre_ || !full_pre_->matches(image.width, image.height, image.format, in_w, in_h))
+            full_pre_ = std::make_unique<Preprocessor>(image.width, image.height, image.format, in_w, in_h);
+        pre = full_pre_.get();
+    } else {
+        // crop 크기는 몇 개의 구간뿐이므로 구간마다 한 번만 만든다
+        for (const std::unique_ptr<Preprocessor> &p : roi_pre_)
+            if (p->matches(image.width, image.height, image.format, in_w, in_h))
+                pre = p.get();
+        if (!pre) {
+            roi_pre_.push_back(std::make_unique<Preprocessor>(image.width, image.height, image.format, in_w, in_h));
+            pre = roi_pre_.back().get();
+        }
+    }
+    const Letterbox &lb = pre->letterbox();
+
+    // 전체 프레임과 crop 의 입력 크기가 다르므로 텐서를 따로 두어 번갈아도 다시 잡지 않는다
+    cv::Mat &blob = roi.full ? full_blob_ : roi_blob_;
+    Clock::time_point t0 = Clock::now();
+    const int shape[] = {1, 3, in_h, in_w};
+    blob.create(4, shape, CV_32F);
+    pre->run(image.data, image.stride, blob.ptr<float>());
+
+    Clock::time_point t1 = Clock::now();
+    net_.setInput(blob);
+    net_.forward(outputs_, output_names_);
+    Clock::time_point t2 = Clock::now();
+
+    const cv::Mat &output = outputs_[0];
+    CV_Assert(output.dims == 3 && output.type() == CV_32F);
+    if (options_.top1) {
+        Detection best;
+        out.clear();
+        if (decoder_.top1(output.ptr<float>(), output.size[1], output.size[2], lb, best))
+            out.push_back(best);
+    } else {
+        decoder_.decode(output.ptr<float>(), output.size[1], output.size[2], lb, out);
+    }
+
+    if (!roi.full) {
+        for (Detection &d : out) {
+            d.x1 += crop_x;
+            d.x2 += crop_x;
+            d.y1 += crop_y;
+            d.y2 += crop_y;
+        }
+    }
+    timing_.preprocess = ms_between(t0, t1);
+    timing_.infer = ms_between(t1, t2);
+    timing_.decode = ms_between(t2, Clock::now());
+}
+
+} // namespace finger
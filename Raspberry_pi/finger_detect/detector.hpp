@@ -0,0 +1,98 @@
+/*
+ * YOLO detector running best_fixed.onnx through OpenCV DNN on the CPU
+ *
+ * Crops planned by the hand tracker run at the smaller roi_input size.
+ * The crop side is rounded up to a multiple of roi_input / 2 (kept inside
+ * the frame), so only a few crop sizes occur and their preprocessors are
+ * built once instead of on every frame the tracked box changes size.
+ * OpenCV DNN reshapes the network when the input blob size changes, which
+ * needs a model exported with dynamic=True (or roi_input == input size).
+ *
+ * The INT8 model is the QDQ file written by quantize_int8.py; its input and
+ * output stay float, so preprocessing and decoding are shared with FP32.
+ */
+#ifndef FINGER_DETECT_DETECTOR_HPP
+#define FINGER_DETECT_DETECTOR_HPP
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <opencv2/core.hpp>
+#include <opencv2/dnn.hpp>
+
+#include "decoder.hpp"
+#include "preprocess.hpp"
+#include "stats.hpp"
+#include "tracker.hpp"
+#include "yolo.hpp"
+
+namespace finger {
+
+enum class Precision {
+    Fp32,
+    Int8,
+    Auto, // INT8 모델 파일이 있으면 INT8, 없으면 FP32
+};
+
+struct DetectorOptions {
+    std::string model = "best_fixed.onnx";
+    std::string int8_model;  // 비어 있으면 <model>.int8.onnx
+    Precision precision = Precision::Fp32;
+    int input_w = 640;
+    int input_h = 640;
+    int num_classes = 5;
+    int roi_input = 320; // 추적 crop 의 네트워크 입력 크기 (0: input_w)
+    bool top1 = false;   // 최고 점수 박스 하나만 디코딩 (NMS 생략)
+    DecodeParams decode;
+};
+
+// 마지막 detect() 의 단계별 시간 (ms)
+struct DetectTiming {
+    double preprocess = 0.0; // letterbox + 정규화 (입력 텐서 채우기)
+    double infer = 0.0;      // net.forward()
+    double decode = 0.0;     // 디코딩 + NMS
+};
+
+// INT8 모델 경로 (int8_model 또는 model 의 확장자를 .int8.onnx 로 바꾼 것)
+std::string int8_model_path(const DetectorOptions &options);
+
+class Detector {
+public:
+    // 모델을 읽지 못하면 cv::Exception 을 던진다
+    explicit Detector(const DetectorOptions &options);
+
+    // BGR 프레임 하나에 대해 letterbox -> 추론 -> 디코딩 -> NMS
+    void detect(const cv::Mat &bgr, std::vector<Detection> &out);
+
+    // roi 만 잘라 추론한다, 결과는 전체 프레임 좌표
+    void detect(const cv::Mat &bgr, const Roi &roi, std::vector<Detection> &out);
+
+    // 캡처 버퍼를 그대로 읽는다 (BGR 또는 YUYV)
+    void detect(const ImageView &image, const Roi &roi, std::vector<Detection> &out);
+
+    const DetectorOptions &options() const { return options_; }
+    const std::string &model_path() const { return model_path_; }
+    bool int8() const { return int8_; }
+    const DetectTiming &last_timing() const { return timing_; }
+
+private:
+    DetectorOptions options_;
+    std::string model_path_;
+    bool int8_ = false;
+    DetectTiming timing_;
+    cv::dnn::Net net_;
+    std::vector<cv::String> output_names_;
+
+    // 프레임마다 재사용하는 버퍼
+    Decoder decoder_;
+    std::unique_ptr<Preprocessor> full_pre_; // 전체 프레임용
+    std::vector<std::unique_ptr<Preprocessor>> roi_pre_; // 추적 crop 용, 크기 구간마다 하나
+    cv::Mat full_blob_;
+    cv::Mat roi_blob_;
+    std::vector<cv::Mat> outputs_;
+};
+
+} // namespace finger
+
+#endif // FINGER_DETECT_DETECTOR_HPP
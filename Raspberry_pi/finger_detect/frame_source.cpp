@@ -0,0 +1,131 @@
+/*
+ * Frame sources for finger_detect
+ */
+#include "frame_source.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <filesystem>
+#include <vector>
+
+#include <cerrno>
+
+#include <opencv2/imgcodecs.hpp>
+#include <opencv2/imgproc.hpp>
+#include <opencv2/videoio.hpp>
+
+namespace finger {
+
+namespace {
+
+bool is_image(const std::filesystem::path &path)
+{
+    std::string ext = path.extension().string();
+
+    std::transform(ext.begin(), ext.end(), ext.begin(), [](unsigned char c) { return std::tolower(c); });
+    return ext == ".jpg" || ext == ".jpeg" || ext == ".png" || ext == ".bmp";
+}
+
+bool is_camera_index(const std::string &spec)
+{
+    return !spec.empty() && std::all_of(spec.begin(), spec.end(), [](unsigned char c) { return std::isdigit(c); });
+}
+
+class CaptureSource : public FrameSource {
+public:
+    bool open(const std::string &spec)
+    {
+        if (is_camera_index(spec))
+            return cap_.open(std::stoi(spec));
+        return cap_.open(spec);
+    }
+
+    bool read(cv::Mat &frame) override { return cap_.read(frame) && !frame.empty(); }
+
+private:
+    cv::VideoCapture cap_;
+};
+
+class ImageDirSource : public FrameSource {
+public:
+    explicit ImageDirSource(std::vector<std::string> &&files) : files_(std::move(files)) {}
+
+    bool read(cv::Mat &frame) override
+    {
+        // 읽을 수 없는 파일은 건너뛴다
+        while (next_ < files_.size()) {
+            frame = cv::imread(files_[next_++], cv::IMREAD_COLOR);
+            if (!frame.empty())
+                return true;
+        }
+        return false;
+    }
+
+private:
+    std::vector<std::string> files_;
+    std::size_t next_ = 0;
+};
+
+class RawFrameSource : public FrameSource {
+public:
+    explicit RawFrameSource(std::unique_ptr<RawSource> raw) : raw_(std::move(raw)) {}
+
+    // 파이프라인 밖에서 쓸 때를 위한 복사/변환 경로
+    bool read(cv::Mat &frame) override
+    {
+        RawFrame f;
+        int ret;
+
+        while ((ret = raw_->acquire(f, 1000)) == -EAGAIN)
+            ;
+        if (ret < 0)
+            return false;
+
+        const ImageView &v = f.image;
+        if (v.format == PixelFormat::Yuyv)
+            cv::cvtColor(cv::Mat(v.height, v.width, CV_8UC2, const_cast<std::uint8_t *>(v.data), v.stride),
+                         frame, cv::COLOR_YUV2BGR_YUYV);
+        else
+            cv::Mat(v.height, v.width, CV_8UC3, const_cast<std::uint8_t *>(v.data), v.stride).copyTo(frame);
+        raw_->release(f);
+        return true;
+    }
+
+    RawSource *raw() override { return raw_.get(); }
+
+private:
+    std::unique_ptr<RawSource> raw_;
+};
+
+} // namespace
+
+std::unique_ptr<FrameSource> FrameSource::open(const std::string &spec, const RawOptions &raw)
+{
+    std::error_code ec;
+    int err;
+
+    if (auto source = RawSource::open(spec, raw, err))
+        return std::make_unique<RawFrameSource>(std::move(source));
+    if (err < 0)
+        return nullptr;
+
+    if (std::filesystem::is_directory(spec, ec)) {
+        std::vector<std::string> files;
+
+        for (const auto &entry : std::filesystem::directory_iterator(spec, ec)) {
+            if (entry.is_regular_file() && is_image(entry.path()))
+                files.push_back(entry.path().string());
+        }
+        if (files.empty())
+            return nullptr;
+        std::sort(files.begin(), files.end());
+        return std::make_unique<ImageDirSource>(std::move(files));
+    }
+
+    auto capture = std::make_unique<CaptureSource>();
+    if (!capture->open(spec))
+        return nullptr;
+    return capture;
+}
+
+} // namespace finger
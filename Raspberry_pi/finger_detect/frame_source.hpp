@@ -0,0 +1,42 @@
+/*
+ * Frame sources for finger_detect
+ *
+ * The source spec follows ultralytics' 'source=' argument:
+ * - "0", "1", ...  : camera index
+ * - a directory    : every image file in it, in name order
+ * - "v4l2:/dev/videoN" : V4L2 streaming capture without copies (v4l2_capture.hpp)
+ * - "raw:FILE"     : replay of raw YUYV/BGR frames through the same path
+ * - anything else  : a video file (or stream URL) opened by cv::VideoCapture
+ *
+ * The last two expose their RawSource through raw(); the pipeline then
+ * preprocesses the capture buffers in place instead of calling read().
+ */
+#ifndef FINGER_DETECT_FRAME_SOURCE_HPP
+#define FINGER_DETECT_FRAME_SOURCE_HPP
+
+#include <memory>
+#include <string>
+
+#include <opencv2/core.hpp>
+
+#include "v4l2_capture.hpp"
+
+namespace finger {
+
+class FrameSource {
+public:
+    virtual ~FrameSource() = default;
+
+    // 다음 프레임을 읽는다. 끝에 도달했거나 실패하면 false
+    virtual bool read(cv::Mat &frame) = 0;
+
+    // 복사 없이 버퍼를 빌려 주는 원시 프레임 소스, 없으면 nullptr
+    virtual RawSource *raw() { return nullptr; }
+
+    // 열지 못하면 nullptr (raw 는 v4l2:/raw: 소스에만 쓰인다)
+    static std::unique_ptr<FrameSource> open(const std::string &spec, const RawOptions &raw = RawOptions());
+};
+
+} // namespace finger
+
+#endif // FINGER_DETECT_FRAME_SOURCE_HPP
@@ -0,0 +1,82 @@
+/*
+ * End-to-end latency tracing: camera frame -> FPGA register write
+ */
+#include "frame_trace.hpp"
+
+#include <cerrno>
+#include <cstdio>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace finger {
+
+namespace {
+
+// tracefs 가 마운트되는 위치 (새 커널 / debugfs 아래 예전 위치)
+constexpr const char *kTraceMarkers[] = {
+    "/sys/kernel/tracing/trace_marker",
+    "/sys/kernel/debug/tracing/trace_marker",
+};
+
+long long ns(Clock::time_point t)
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(t.time_since_epoch()).count();
+}
+
+long long us(double ms)
+{
+    return (long long)(ms * 1000.0 + 0.5);
+}
+
+} // namespace
+
+FrameTrace::~FrameTrace()
+{
+    if (fd_ >= 0)
+        close(fd_);
+}
+
+int FrameTrace::open(const std::string &path)
+{
+    if (fd_ >= 0)
+        close(fd_);
+    fd_ = -1;
+
+    if (!path.empty()) {
+        fd_ = ::open(path.c_str(), O_WRONLY | O_CLOEXEC);
+        return fd_ < 0 ? -errno : 0;
+    }
+
+    int err = -ENOENT;
+    for (const char *marker : kTraceMarkers) {
+        fd_ = ::open(marker, O_WRONLY | O_CLOEXEC);
+        if (fd_ >= 0)
+            return 0;
+        // 권한 문제(EACCES)가 더 알려 줄 게 많으므로 ENOENT 로 덮지 않는다
+        if (errno != ENOENT)
+            err = -errno;
+    }
+    return err;
+}
+
+void FrameTrace::mark(const FrameMark &frame)
+{
+    if (fd_ < 0)
+        return;
+
+    char line[256];
+    int len = snprintf(line, sizeof(line),
+                       "finger_frame: cookie=%lu cap=%lld deq=%lld pre_us=%lld inf_us=%lld dec_us=%lld "
+                       "decided=%lld submit=%lld submitted=%lld\n",
+                       frame.cookie, ns(frame.captured), ns(frame.dequeued), us(frame.preprocess_ms),
+                       us(frame.infer_ms), us(frame.decode_ms), ns(frame.decided), ns(frame.submit),
+                       ns(frame.submitted));
+    if (len <= 0 || std::size_t(len) >= sizeof(line) || write(fd_, line, len) != len) {
+        errors_++;
+        return;
+    }
+    marks_++;
+}
+
+} // namespace finger
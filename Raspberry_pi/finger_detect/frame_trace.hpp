@@ -0,0 +1,70 @@
+/*
+ * End-to-end latency tracing: camera frame -> FPGA register write
+ *
+ * Every frame carries its id from capture to the actuation stage. When a
+ * decision is actuated, the id goes down to the drivers as the libfpga
+ * trace cookie (pwrite() offset), and the kernel fires fpga:fpga_dev_write
+ * with that cookie once the bus writes of the device are done. FrameTrace
+ * writes the user space half of the same frame into the ftrace buffer
+ * through trace_marker:
+ *
+ *     finger_frame: cookie=17 cap=... deq=... pre_us=... inf_us=... dec_us=...
+ *                   decided=... submit=... submitted=...
+ *
+ * All absolute times are CLOCK_MONOTONIC nanoseconds (steady_clock, V4L2
+ * buffer timestamps and ktime_get_ns() share that clock), so
+ * latency_join.py can join the two halves by cookie without caring about
+ * the ftrace clock. Only actuated frames are marked; the others never
+ * reach a driver.
+ *
+ * Errors follow libfpga: 0 or a negative errno.
+ */
+#ifndef FINGER_DETECT_FRAME_TRACE_HPP
+#define FINGER_DETECT_FRAME_TRACE_HPP
+
+#include <string>
+
+#include "stats.hpp"
+
+namespace finger {
+
+// 프레임 하나가 액추에이션까지 거친 시각들
+struct FrameMark {
+    unsigned long cookie = 0;    // 프레임 id (0 은 쿠키 없음이라 쓰지 않는다)
+    Clock::time_point captured;  // 센서/캡처 시각
+    Clock::time_point dequeued;  // 추론 스테이지가 링에서 꺼낸 시각
+    double preprocess_ms = 0.0;  // 움직임 게이트가 추론을 건너뛴 프레임은 0
+    double infer_ms = 0.0;
+    double decode_ms = 0.0;
+    Clock::time_point decided;   // 평활화 결정이 나온 시각
+    Clock::time_point submit;    // Board::submit() 호출 직전
+    Clock::time_point submitted; // Board::submit() 이 돌아온 시각
+};
+
+class FrameTrace {
+public:
+    FrameTrace() = default;
+    ~FrameTrace();
+    FrameTrace(const FrameTrace &) = delete;
+    FrameTrace &operator=(const FrameTrace &) = delete;
+
+    // path 가 비어 있으면 tracefs 의 trace_marker 를 찾는다 (root 권한 필요)
+    int open(const std::string &path = std::string());
+
+    bool enabled() const { return fd_ >= 0; }
+
+    // 한 줄을 write 한 번으로 남긴다, 실패해도 파이프라인은 계속 간다
+    void mark(const FrameMark &frame);
+
+    unsigned long marks() const { return marks_; }
+    unsigned long errors() const { return errors_; }
+
+private:
+    int fd_ = -1;
+    unsigned long marks_ = 0;
+    unsigned long errors_ = 0;
+};
+
+} // namespace finger
+
+#endif // FINGER_DETECT_FRAME_TRACE_HPP
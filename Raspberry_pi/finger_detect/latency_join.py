@@ -0,0 +1,143 @@
+"""finger_detect --trace 결과의 프레임별 지연을 드라이버 tracepoint 와 합쳐 단계별 히스토그램으로 출력
+
+사용법:
+    python3 latency_join.py trace.txt [--json latency.json] [--no-hist]
+
+trace.txt 는 /sys/kernel/tracing/trace 를 그대로 저장한 것이다 (trace_latency.sh 참고).
+두 종류의 줄을 쿠키(프레임 id)로 합친다.
+- tracing_mark_write: finger_frame: cookie=.. cap=.. deq=.. ...   (finger_detect, 사용자 공간)
+- fpga_dev_write: dev=.. cookie=.. len=.. bus_ns=.. done_ns=..      (k6 드라이버, write 완료 시각)
+
+단계 (ms):
+  queue     캡처 -> 추론 스테이지가 프레임을 꺼냄
+  preprocess, infer, decode   Detector 단계 (움직임 게이트가 건너뛴 프레임은 빠진다)
+  decide    꺼낸 뒤 결정까지 나머지 (게이트, 추적, 평활화)
+  handoff   결정 -> 액추에이션 스테이지가 submit 시작 (결정 링 대기)
+  submit    Board::submit() 호출 시간 (사용자 공간에서 본 write 들)
+  driver    submit 시작 -> 그 프레임의 마지막 드라이버 write 완료 (커널)
+  bus       그 프레임 write 들의 버스 시간 합 (커널)
+  total     캡처 -> 마지막 레지스터 write 완료 (커널 이벤트가 없으면 submit 이 돌아온 시각까지)
+
+모든 시각은 CLOCK_MONOTONIC ns 이므로 ftrace 의 trace_clock 설정과 무관하다.
+"""
+import argparse
+import json
+import re
+import sys
+
+STAGES = ['queue', 'preprocess', 'infer', 'decode', 'decide', 'handoff', 'submit', 'driver', 'bus', 'total']
+FIELD = re.compile(r'(\w+)=(\S+)')
+
+
+def parse(path):
+    frames = {}  # cookie -> finger_frame 필드
+    writes = {}  # cookie -> [fpga_dev_write 필드]
+    untagged = 0
+    with open(path) as f:
+        for line in f:
+            if 'finger_frame:' in line:
+                fields = dict(FIELD.findall(line.split('finger_frame:', 1)[1]))
+                frames[int(fields['cookie'])] = {k: int(v) for k, v in fields.items()}
+            elif 'fpga_dev_write:' in line:
+                fields = dict(FIELD.findall(line.split('fpga_dev_write:', 1)[1]))
+                cookie = int(fields['cookie'])
+                if cookie == 0:
+                    untagged += 1  # 다른 프로그램이 쓴 것 (쿠키 없는 write)
+                    continue
+                writes.setdefault(cookie, []).append(fields)
+    return frames, writes, untagged
+
+
+def join(frames, writes):
+    samples = {name: [] for name in STAGES}
+    for cookie, fr in frames.items():
+        pipeline_us = fr['pre_us'] + fr['inf_us'] + fr['dec_us']
+        samples['queue'].append((fr['deq'] - fr['cap']) / 1e6)
+        if pipeline_us:
+            samples['preprocess'].append(fr['pre_us'] / 1e3)
+            samples['infer'].append(fr['inf_us'] / 1e3)
+            samples['decode'].append(fr['dec_us'] / 1e3)
+        samples['decide'].append((fr['decided'] - fr['deq']) / 1e6 - pipeline_us / 1e3)
+        samples['handoff'].append((fr['submit'] - fr['decided']) / 1e6)
+        samples['submit'].append((fr['submitted'] - fr['submit']) / 1e6)
+
+        done = fr['submitted']
+        dev = writes.get(cookie)
+        if dev:
+            done = max(int(w['done_ns']) for w in dev)
+            samples['driver'].append((done - fr['submit']) / 1e6)
+            samples['bus'].append(sum(int(w['bus_ns']) for w in dev) / 1e6)
+        samples['total'].append((done - fr['cap']) / 1e6)
+    return samples
+
+
+def percentile(sorted_ms, p):
+    return sorted_ms[int(p / 100 * (len(sorted_ms) - 1) + 0.5)]
+
+
+def summary(ms):
+    s = sorted(ms)
+    return {'n': len(s), 'mean': sum(s) / len(s), 'p50': percentile(s, 50),
+            'p99': percentile(s, 99), 'max': s[-1]}
+
+
+def print_hist(ms, width=40):
+    # 2 배 구간 히스토그램 (us 단위)
+    buckets = {}
+    for v in ms:
+        us = max(v * 1000, 0)
+        b = 0
+        while (1 << (b + 1)) <= us:
+            b += 1
+        buckets[b] = buckets.get(b, 0) + 1
+    top = max(buckets.values())
+    for b in range(min(buckets), max(buckets) + 1):
+        n = buckets.get(b, 0)
+        lo, hi = (0 if b == 0 else 1 << b), 1 << (b + 1)
+        print(f'    [{fmt_us(lo):>6s}, {fmt_us(hi):>6s}) {n:7d} |{"@" * (n * width // top):<{width}s}|')
+
+
+def fmt_us(us):
+    if us >= 1000000:
+        return f'{us // 1000000}s'
+    if us >= 1000:
+        return f'{us // 1000}ms'
+    return f'{us}us'
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('trace')
+    parser.add_argument('--json', help='write per-stage n/mean/p50/p99/max (ms) to this file')
+    parser.add_argument('--no-hist', action='store_true')
+    args = parser.parse_args()
+
+    frames, writes, untagged = parse(args.trace)
+    if not frames:
+        print('no finger_frame markers (run finger_detect with --trace)')
+        sys.exit(1)
+
+    joined = sum(1 for cookie in frames if cookie in writes)
+    orphans = sum(1 for cookie in writes if cookie not in frames)
+    print(f'frames={len(frames)} joined={joined} kernel_only={orphans} untagged_writes={untagged}')
+    if not joined:
+        print('(no fpga:fpga_dev_write events matched: sim backend or tracepoint disabled)')
+
+    samples = join(frames, writes)
+    report = {}
+    for name in STAGES:
+        if not samples[name]:
+            continue
+        st = report[name] = summary(samples[name])
+        print(f'{name:10s} n={st["n"]:<6d} mean={st["mean"]:8.3f} p50={st["p50"]:8.3f} '
+              f'p99={st["p99"]:8.3f} max={st["max"]:8.3f} ms')
+        if not args.no_hist:
+            print_hist(samples[name])
+
+    if args.json:
+        with open(args.json, 'w') as f:
+            json.dump({'frames': len(frames), 'joined': joined, 'stages_ms': report}, f, indent=2)
+
+
+if __name__ == '__main__':
+    main()
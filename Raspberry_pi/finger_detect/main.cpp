@@ -0,0 +1,386 @@
+/* Finger number detection -> FPGA control (native pipeline)
+File : main.cpp
+
+Native replacement for yolo_last.py: reads frames from a camera, a video
+file or an image directory, runs best_fixed.onnx on the CPU through OpenCV
+DNN and drives the FPGA devices through libfpga. The class -> device
+mapping is read from an action config (actions.conf, see
+libfpga/fpga_actions.hpp); kill -HUP reloads it without restarting.
+Capture, inference and actuation run as a three-stage pipeline
+(pipeline.hpp); there is no fixed sleep between frames.
+
+Usage: finger_detect [options]
+  --model PATH      ONNX model (default best_fixed.onnx)
+  --source SPEC     camera index, video file or image directory (default 0),
+                    v4l2:/dev/videoN for zero-copy V4L2 capture or
+                    raw:FILE to replay raw frames through the same path
+  --capture-size WxH  v4l2/raw frame size (default 640x480)
+  --pixel-format F  v4l2/raw pixel format: yuyv | bgr (default yuyv)
+  --buffers N       V4L2 queue depth (default and minimum 7)
+  --dmabuf          import DMA-BUF heap buffers instead of mmap'ing driver buffers
+  --replay-fps F    pace raw replay like a camera at F fps, dropping frames
+                    the pipeline misses (default 0: as fast as consumed)
+  --loop            restart raw replay at the end of the file
+  --precision P     fp32 | int8 | auto: INT8 model from quantize_int8.py,
+                    auto uses it when the file exists (default fp32)
+  --int8-model PATH INT8 model (default <model>.int8.onnx)
+  --names LIST      comma separated class names in model order
+                    (default dev1,dev2,dev3,dev4,off)
+  --actions FILE    class -> device action config (default actions.conf
+                    when it exists, else the class_map of yolo_last.py);
+                    SIGHUP reloads it
+  --size N          network input size (default 640)
+  --conf F          confidence threshold (default 0.25)
+  --iou F           NMS IoU threshold (default 0.7)
+  --backend B       dev | sim (default: FPGA_BACKEND or dev)
+  --max-frames N    stop after N frames
+  --min-conf F      minimum box confidence that counts as a vote (default 0.5)
+  --vote N/M        activate a class with N votes in the last M frames (default 3/5)
+  --release R       release the active class below R votes (default 2, 1 <= R <= N)
+  --hold F          keep a decision for at least F frames (default 0)
+  --class-vote NAME=N:R
+                    per-class activate/release votes, may be repeated
+  --motion T        skip inference while the mean luma change of a small
+                    thumbnail stays below T (default 4, 0 = always infer)
+  --idle-interval K on a static scene still infer every K-th frame (default 15)
+  --boost F         after motion infer every frame for F frames (default 10)
+  --track K         track the hand and run the detector on a crop around it,
+                    with a full-frame detection every K frames (default off)
+  --roi-size N      network input size for tracked crops (default 320, needs
+                    a model exported with dynamic input shape)
+  --no-drop         infer every frame in order instead of only the newest
+                    (for offline replay of a video file)
+  --labels FILE     ground-truth class per frame for --json accuracy
+                    (lines "FIRST[-LAST] CLASS", see replay_report.hpp)
+  --json FILE       write FPS, per-stage latency, accuracy, device switches
+                    and bus traffic as JSON (compare runs with replay_gate.py)
+  --trace           tag driver writes with the frame id and log the frame
+                    timestamps to ftrace trace_marker (root; see
+                    trace_latency.sh and latency_join.py)
+  --show            draw detections in a window
+  --verbose         print every decision */
+
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <getopt.h>
+#include <sstream>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+#include "actuator.hpp"
+#include "decision.hpp"
+#include "detector.hpp"
+#include "fpga.hpp"
+#include "frame_source.hpp"
+#include "frame_trace.hpp"
+#include "pipeline.hpp"
+#include "replay_report.hpp"
+
+static finger::Pipeline *running_pipeline;
+
+static void user_signal1(int sig)
+{
+	(void)sig;
+	if (running_pipeline)
+		running_pipeline->request_stop();
+}
+
+static void hangup(int sig)
+{
+	(void)sig;
+	if (running_pipeline)
+		running_pipeline->request_reload();
+}
+
+static std::vector<std::string> split_names(const std::string &list)
+{
+	std::vector<std::string> names;
+	std::stringstream ss(list);
+	std::string name;
+
+	while (std::getline(ss, name, ','))
+		names.push_back(name);
+	return names;
+}
+
+// 해제 기준이 활성 기준보다 크면 매 프레임 켜졌다 꺼지고, 0 이면 해제되지 않는다
+static bool valid_votes(int acquire, int release, int window)
+{
+	return acquire >= 1 && acquire <= window && release >= 1 && release <= acquire;
+}
+
+static void usage(const char *prog)
+{
+	printf("<Usage> %s [--model PATH] [--source SPEC] [--names LIST] [--actions FILE] [--size N]\n", prog);
+	printf("        [--precision fp32|int8|auto] [--int8-model PATH]\n");
+	printf("        [--conf F] [--iou F] [--backend dev|sim] [--max-frames N] [--no-drop]\n");
+	printf("        [--min-conf F] [--vote N/M] [--release R] [--hold F] [--class-vote NAME=N:R]\n");
+	printf("        [--motion T] [--idle-interval K] [--boost F] [--track K] [--roi-size N]\n");
+	printf("        [--capture-size WxH] [--pixel-format yuyv|bgr] [--buffers N] [--dmabuf]\n");
+	printf("        [--replay-fps F] [--loop] [--labels FILE] [--json FILE] [--trace] [--show] [--verbose]\n");
+	printf("ex) %s --source 0 --show\n", prog);
+	printf("ex) %s --source v4l2:/dev/video0 --buffers 8\n", prog);
+	printf("ex) %s --source recorded.mp4 --backend sim\n", prog);
+	printf("ex) %s --source recorded.mp4 --backend sim --no-drop --track 10\n", prog);
+	printf("ex) %s --source recorded.mp4 --backend sim --no-drop --labels recorded.txt --json replay.json\n", prog);
+	printf("ex) sudo ./trace_latency.sh --source v4l2:/dev/video0 --max-frames 600\n");
+}
+
+int main(int argc, char **argv)
+{
+	finger::DetectorOptions options;
+	finger::PipelineOptions pipeline_options;
+	finger::SmootherOptions smoother_options;
+	finger::RawOptions raw_options;
+	std::vector<std::string> class_votes;
+	std::string source = "0";
+	std::string names_list = "dev1,dev2,dev3,dev4,off";
+	std::string labels_path, json_path;
+	std::string actions_path;
+	bool trace = false;
+	fpga::Backend backend = fpga::default_backend();
+
+	static const struct option long_options[] = {
+		{"model", required_argument, nullptr, 'm'},
+		{"source", required_argument, nullptr, 's'},
+		{"precision", required_argument, nullptr, 'P'},
+		{"int8-model", required_argument, nullptr, 'q'},
+		{"capture-size", required_argument, nullptr, 'x'},
+		{"pixel-format", required_argument, nullptr, 'p'},
+		{"buffers", required_argument, nullptr, 'u'},
+		{"dmabuf", no_argument, nullptr, 'D'},
+		{"replay-fps", required_argument, nullptr, 'y'},
+		{"loop", no_argument, nullptr, 'L'},
+		{"names", required_argument, nullptr, 'n'},
+		{"actions", required_argument, nullptr, 'A'},
+		{"size", required_argument, nullptr, 'z'},
+		{"conf", required_argument, nullptr, 'c'},
+		{"iou", required_argument, nullptr, 'i'},
+		{"backend", required_argument, nullptr, 'b'},
+		{"max-frames", required_argument, nullptr, 'f'},
+		{"min-conf", required_argument, nullptr, 'C'},
+		{"vote", required_argument, nullptr, 'V'},
+		{"release", required_argument, nullptr, 'r'},
+		{"hold", required_argument, nullptr, 'H'},
+		{"class-vote", required_argument, nullptr, 'K'},
+		{"motion", required_argument, nullptr, 'M'},
+		{"idle-interval", required_argument, nullptr, 'I'},
+		{"boost", required_argument, nullptr, 'B'},
+		{"track", required_argument, nullptr, 'T'},
+		{"roi-size", required_argument, nullptr, 'R'},
+		{"no-drop", no_argument, nullptr, 'N'},
+		{"labels", required_argument, nullptr, 'l'},
+		{"json", required_argument, nullptr, 'j'},
+		{"trace", no_argument, nullptr, 't'},
+		{"show", no_argument, nullptr, 'S'},
+		{"verbose", no_argument, nullptr, 'v'},
+		{"help", no_argument, nullptr, 'h'},
+		{nullptr, 0, nullptr, 0},
+	};
+
+	int opt;
+	while ((opt = getopt_long(argc, argv, "m:P:q:s:x:p:u:Dy:Ln:A:z:c:i:b:f:C:V:r:H:K:M:I:B:T:R:Nl:j:tSvh", long_options, nullptr)) != -1) {
+		switch (opt) {
+		case 'm': options.model = optarg; break;
+		case 'P':
+			if (strcmp(optarg, "fp32") == 0)
+				options.precision = finger::Precision::Fp32;
+			else if (strcmp(optarg, "int8") == 0)
+				options.precision = finger::Precision::Int8;
+			else if (strcmp(optarg, "auto") == 0)
+				options.precision = finger::Precision::Auto;
+			else {
+				usage(argv[0]);
+				return -1;
+			}
+			break;
+		case 'q': options.int8_model = optarg; break;
+		case 's': source = optarg; break;
+		case 'x':
+			if (sscanf(optarg, "%dx%d", &raw_options.width, &raw_options.height) != 2) {
+				usage(argv[0]);
+				return -1;
+			}
+			break;
+		case 'p':
+			raw_options.format = strcmp(optarg, "bgr") == 0 ? finger::PixelFormat::Bgr : finger::PixelFormat::Yuyv;
+			break;
+		case 'u': raw_options.buffers = atoi(optarg); break;
+		case 'D': raw_options.io = finger::RawOptions::Io::Dmabuf; break;
+		case 'y': raw_options.fps = atof(optarg); break;
+		case 'L': raw_options.loop = true; break;
+		case 'n': names_list = optarg; break;
+		case 'A': actions_path = optarg; break;
+		case 'z': options.input_w = options.input_h = atoi(optarg); break;
+		case 'c': options.decode.conf_threshold = atof(optarg); break;
+		case 'i': options.decode.iou_threshold = atof(optarg); break;
+		case 'b': backend = strcmp(optarg, "sim") == 0 ? fpga::Backend::Sim : fpga::Backend::Device; break;
+		case 'f': pipeline_options.max_frames = atol(optarg); break;
+		case 'C': smoother_options.min_conf = atof(optarg); break;
+		case 'V':
+			if (sscanf(optarg, "%d/%d", &smoother_options.acquire, &smoother_options.window) != 2) {
+				usage(argv[0]);
+				return -1;
+			}
+			break;
+		case 'r': smoother_options.release = atoi(optarg); break;
+		case 'H': smoother_options.min_hold = atoi(optarg); break;
+		case 'K': class_votes.push_back(optarg); break;
+		case 'M': pipeline_options.gate.threshold = atof(optarg); break;
+		case 'I': pipeline_options.gate.idle_interval = atoi(optarg); break;
+		case 'B': pipeline_options.gate.boost_frames = atoi(optarg); break;
+		case 'T': pipeline_options.tracker.redetect_interval = atoi(optarg); break;
+		case 'R': options.roi_input = atoi(optarg); break;
+		case 'N': pipeline_options.drop_stale = false; break;
+		case 'l': labels_path = optarg; break;
+		case 'j': json_path = optarg; break;
+		case 't': trace = true; break;
+		case 'S': pipeline_options.show = true; break;
+		case 'v': pipeline_options.verbose = true; break;
+		default:
+			usage(argv[0]);
+			return opt == 'h' ? 0 : -1;
+		}
+	}
+
+	std::vector<std::string> names = split_names(names_list);
+	// 1 <= release <= acquire <= window 이어야 이력 현상(hysteresis)이 유지된다
+	if (names.empty() || options.input_w <= 0 || smoother_options.window <= 0 ||
+	    !valid_votes(smoother_options.acquire, smoother_options.release, smoother_options.window)) {
+		usage(argv[0]);
+		return -1;
+	}
+	options.num_classes = names.size();
+	// 제어에는 최고 점수 박스 하나면 충분하다, 화면에 그릴 때만 전부 디코딩한다
+	options.top1 = !pipeline_options.show;
+	pipeline_options.record_decisions = !json_path.empty();
+
+	finger::GroundTruth truth;
+	if (!labels_path.empty()) {
+		int ret = truth.load(labels_path, names);
+		if (ret < 0) {
+			printf("Labels error : %s line %d (%d)\n", labels_path.c_str(), truth.error_line(), ret);
+			return -1;
+		}
+	}
+
+	fpga::Board board(backend);
+	if (!board.ok()) {
+		printf("Device open error : opened mask 0x%x\n", board.opened());
+		return -1;
+	}
+	finger::Actuator actuator(board, names);
+	// 지정하지 않았으면 actions.conf 가 있을 때만 읽는다
+	if (!actions_path.empty() || access("actions.conf", R_OK) == 0) {
+		std::string path = actions_path.empty() ? "actions.conf" : actions_path;
+		int ret = actuator.load(path);
+		if (ret < 0) {
+			printf("Actions error : %s line %d (%d)\n", path.c_str(), actuator.error_line(), ret);
+			return -1;
+		}
+	}
+	for (const std::string &name : actuator.table().unknown_classes())
+		printf("Actions warning : class '%s' is not in --names, ignored\n", name.c_str());
+	printf("actions %s\n", actuator.path().empty() ? "(built-in)" : actuator.path().c_str());
+
+	finger::DecisionSmoother smoother(names.size(), smoother_options);
+	for (const std::string &vote : class_votes) {
+		char name[64];
+		int acquire, release;
+		int cls = -1;
+
+		if (sscanf(vote.c_str(), "%63[^=]=%d:%d", name, &acquire, &release) == 3) {
+			for (std::size_t i = 0; i < names.size(); i++)
+				if (names[i] == name)
+					cls = i;
+		}
+		if (cls < 0 || !valid_votes(acquire, release, smoother_options.window)) {
+			printf("Invalid --class-vote : %s (1 <= R <= N <= %d)\n", vote.c_str(), smoother_options.window);
+			return -1;
+		}
+		smoother.set_class_votes(cls, acquire, release);
+	}
+
+	auto frames = finger::FrameSource::open(source, raw_options);
+	if (!frames) {
+		printf("Source open error : %s\n", source.c_str());
+		return -1;
+	}
+
+	std::unique_ptr<finger::Detector> detector;
+	try {
+		detector = std::make_unique<finger::Detector>(options);
+	} catch (const cv::Exception &e) {
+		printf("Model load error : %s\n%s\n", options.precision == finger::Precision::Fp32
+		       ? options.model.c_str() : finger::int8_model_path(options).c_str(), e.what());
+		return -1;
+	}
+	printf("model %s (%s)\n", detector->model_path().c_str(), detector->int8() ? "int8" : "fp32");
+
+	finger::FrameTrace frame_trace;
+	if (trace) {
+		int ret = frame_trace.open();
+		if (ret < 0) {
+			printf("trace_marker open error : %s (%d)\n", strerror(-ret), ret);
+			return -1;
+		}
+		pipeline_options.trace = &frame_trace;
+	}
+
+	finger::Pipeline pipeline(*frames, *detector, smoother, actuator, names, pipeline_options);
+	running_pipeline = &pipeline;
+	(void)signal(SIGINT, user_signal1);
+	(void)signal(SIGHUP, hangup);
+
+	// 파이프라인이 만든 버스 트랜잭션만 센다 (Board 초기화 제외)
+	std::uint64_t bus_writes = fpga::sim_bus().writes();
+	std::uint64_t bus_reads = fpga::sim_bus().reads();
+
+	pipeline.run();
+
+	running_pipeline = nullptr;
+	pipeline.print_report(stdout);
+	printf("device_switches=%lu skipped_writes=%llu\n",
+	       actuator.switches(), (unsigned long long)board.skipped());
+
+	if (!json_path.empty()) {
+		finger::ReplayScore score(truth, names.size());
+		finger::ReplayRun run;
+
+		for (const finger::Decision &d : pipeline.decisions())
+			score.add(d.frame_id, d.cls, d.raw_cls);
+
+		run.source = source;
+		run.model = detector->model_path();
+		run.precision = detector->int8() ? "int8" : "fp32";
+		run.backend = backend == fpga::Backend::Sim ? "sim" : "dev";
+		run.names = &names;
+		run.frames = pipeline.captured();
+		run.inferred = pipeline.inferred();
+		run.wall_s = std::chrono::duration<double>(pipeline.wall()).count();
+		for (int i = 0; i < int(finger::Stage::Count); i++)
+			run.stages.emplace_back(finger::stage_name(finger::Stage(i)),
+			                        &pipeline.stage_latency(finger::Stage(i)));
+		run.decide_latency = &pipeline.decide_latency();
+		run.actuate_latency = &pipeline.actuate_latency();
+		run.decision_changes = smoother.changes();
+		run.actuations = pipeline.actuations();
+		run.device_switches = actuator.switches();
+		// 실제 디바이스에서는 버스를 셀 수 없으므로 sim 에서만 의미가 있다
+		run.bus_writes = fpga::sim_bus().writes() - bus_writes;
+		run.bus_reads = fpga::sim_bus().reads() - bus_reads;
+		run.skipped_writes = board.skipped();
+		run.score = truth.empty() ? nullptr : &score;
+
+		int ret = finger::write_replay_json(json_path, run);
+		if (ret < 0) {
+			printf("JSON write error : %s (%d)\n", json_path.c_str(), ret);
+			return -1;
+		}
+	}
+
+	return 0;
+}
@@ -0,0 +1,111 @@
+/*
+ * Scene-change gate in front of the detector
+ */
+#include "motion_gate.hpp"
+
+#include <algorithm>
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define MOTION_GATE_NEON 1
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#define MOTION_GATE_SSE2 1
+#endif
+
+namespace finger {
+
+std::uint64_t sum_abs_diff(const std::uint8_t *a, const std::uint8_t *b, std::size_t n)
+{
+    std::uint64_t sum = 0;
+    std::size_t i = 0;
+
+#if defined(MOTION_GATE_NEON)
+    // 16 바이트씩 |a-b| 를 16비트 누산기에 더한다 (한 레인당 255 * 2 씩, 128 번마다 비운다)
+    while (i + 16 <= n) {
+        uint16x8_t acc = vdupq_n_u16(0);
+        std::size_t end = std::min(n - (n - i) % 16, i + 16 * 128);
+
+        for (; i < end; i += 16)
+            acc = vpadalq_u8(acc, vabdq_u8(vld1q_u8(a + i), vld1q_u8(b + i)));
+        uint64x2_t wide = vpaddlq_u32(vpaddlq_u16(acc));
+        sum += vgetq_lane_u64(wide, 0) + vgetq_lane_u64(wide, 1);
+    }
+#elif defined(MOTION_GATE_SSE2)
+    // psadbw 가 16 바이트의 |a-b| 를 64비트 레인 두 개로 바로 합쳐 준다
+    __m128i acc = _mm_setzero_si128();
+
+    for (; i + 16 <= n; i += 16) {
+        __m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i *>(a + i));
+        __m128i vb = _mm_loadu_si128(reinterpret_cast<const __m128i *>(b + i));
+        acc = _mm_add_epi64(acc, _mm_sad_epu8(va, vb));
+    }
+    sum = std::uint64_t(_mm_cvtsi128_si64(acc)) + std::uint64_t(_mm_cvtsi128_si64(_mm_unpackhi_epi64(acc, acc)));
+#endif
+
+    for (; i < n; i++)
+        sum += a[i] > b[i] ? a[i] - b[i] : b[i] - a[i];
+    return sum;
+}
+
+void luma_thumbnail(const ImageView &image, std::uint8_t *thumb, int thumb_w, int thumb_h)
+{
+    // 축소 비율만큼 건너뛰며 한 픽셀씩만 읽는다 (640x480 -> 80x60 이면 64 픽셀 중 1 개)
+    for (int ty = 0; ty < thumb_h; ty++) {
+        const std::uint8_t *row = image.data + std::size_t(ty * image.height / thumb_h) * image.stride;
+
+        if (image.format == PixelFormat::Yuyv) {
+            for (int tx = 0; tx < thumb_w; tx++)
+                *thumb++ = row[std::size_t(tx * image.width / thumb_w) * 2];
+            continue;
+        }
+        for (int tx = 0; tx < thumb_w; tx++) {
+            const std::uint8_t *p = row + std::size_t(tx * image.width / thumb_w) * 3;
+            *thumb++ = std::uint8_t((p[0] + 2 * p[1] + p[2]) >> 2);
+        }
+    }
+}
+
+MotionGate::MotionGate(const MotionGateOptions &options)
+    : options_(options),
+      reference_(std::size_t(options.thumb_w) * options.thumb_h),
+      current_(reference_.size())
+{
+}
+
+bool MotionGate::should_infer(const ImageView &image)
+{
+    if (!enabled())
+        return true;
+
+    luma_thumbnail(image, current_.data(), options_.thumb_w, options_.thumb_h);
+
+    if (has_reference_) {
+        std::uint64_t sad = sum_abs_diff(current_.data(), reference_.data(), current_.size());
+        last_score_ = float(sad) / float(current_.size());
+    } else {
+        last_score_ = 0.0f;
+    }
+
+    bool motion = !has_reference_ || last_score_ >= options_.threshold;
+    if (motion) {
+        boost_left_ = options_.boost_frames;
+        motion_frames_++;
+    }
+
+    since_infer_++;
+    if (!motion && boost_left_ <= 0 && since_infer_ < options_.idle_interval) {
+        skipped_++;
+        return false;
+    }
+
+    if (boost_left_ > 0 && !motion)
+        boost_left_--;
+    since_infer_ = 0;
+    // 추론한 프레임이 다음 비교의 기준이 된다 (느린 변화도 누적되어 잡힌다)
+    reference_.swap(current_);
+    has_reference_ = true;
+    return true;
+}
+
+} // namespace finger
@@ -0,0 +1,64 @@
+/*
+ * Scene-change gate in front of the detector
+ *
+ * Each frame is reduced to a small luma thumbnail and compared with the
+ * thumbnail of the last frame the detector actually ran on (mean absolute
+ * difference, SIMD sum-of-absolute-differences). Static frames reuse the
+ * previous decision; the detector still runs every 'idle_interval' frames
+ * so a slow change is eventually picked up. After motion the detector runs
+ * on every frame for 'boost_frames' frames, which raises the inference
+ * rate exactly while a hand is moving.
+ */
+#ifndef FINGER_DETECT_MOTION_GATE_HPP
+#define FINGER_DETECT_MOTION_GATE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "preprocess.hpp"
+
+namespace finger {
+
+struct MotionGateOptions {
+    float threshold = 4.0f;  // 썸네일 픽셀당 평균 밝기 차이, 0 이면 게이트를 끈다
+    int idle_interval = 15;  // 정지 장면에서도 이 프레임 수마다 한 번은 추론
+    int boost_frames = 10;   // 움직임 이후 매 프레임 추론하는 기간
+    int thumb_w = 80;
+    int thumb_h = 60;
+};
+
+// a, b 의 절대 차이 합 (NEON / SSE2 / 스칼라)
+std::uint64_t sum_abs_diff(const std::uint8_t *a, const std::uint8_t *b, std::size_t n);
+
+// 이미지를 작은 밝기 썸네일로 샘플링한다 (BGR: (B + 2G + R) / 4, YUYV: Y)
+void luma_thumbnail(const ImageView &image, std::uint8_t *thumb, int thumb_w, int thumb_h);
+
+class MotionGate {
+public:
+    explicit MotionGate(const MotionGateOptions &options);
+
+    bool enabled() const { return options_.threshold > 0.0f; }
+
+    // 이번 프레임에 검출기를 돌려야 하면 true
+    bool should_infer(const ImageView &image);
+
+    float last_score() const { return last_score_; }
+    unsigned long skipped() const { return skipped_; }
+    unsigned long motion_frames() const { return motion_frames_; }
+
+private:
+    MotionGateOptions options_;
+    std::vector<std::uint8_t> reference_; // 마지막으로 추론한 프레임의 썸네일
+    std::vector<std::uint8_t> current_;
+    bool has_reference_ = false;
+    int since_infer_ = 0;
+    int boost_left_ = 0;
+    float last_score_ = 0.0f;
+    unsigned long skipped_ = 0;
+    unsigned long motion_frames_ = 0;
+};
+
+} // namespace finger
+
+#endif // FINGER_DETECT_MOTION_GATE_HPP
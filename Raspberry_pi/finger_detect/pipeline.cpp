@@ -0,0 +1,341 @@
+/*
+ * Three-stage capture / inference / actuation pipeline
+ */
+#include "pipeline.hpp"
+
+#include <thread>
+
+#include <opencv2/highgui.hpp>
+#include <opencv2/imgproc.hpp>
+
+namespace finger {
+
+using namespace std::chrono_literals;
+
+const char *stage_name(Stage stage)
+{
+    switch (stage) {
+    case Stage::Capture: return "capture";
+    case Stage::Preprocess: return "preprocess";
+    case Stage::Infer: return "infer";
+    case Stage::Decode: return "decode";
+    case Stage::Decide: return "decide";
+    case Stage::Actuate: return "actuate";
+    default: return "?";
+    }
+}
+
+Pipeline::Pipeline(FrameSource &source, Detector &detector, DecisionSmoother &smoother, Actuator &actuator,
+                   const std::vector<std::string> &names, const PipelineOptions &options)
+    : source_(source), detector_(detector), smoother_(smoother), actuator_(actuator),
+      names_(names), options_(options), raw_(source.raw()), gate_(options.gate), tracker_(options.tracker)
+{
+    if (options_.record_decisions)
+        log_.reserve(options_.max_frames > 0 ? std::size_t(options_.max_frames) : 1 << 16);
+}
+
+ImageView Pipeline::view(const FrameSlot &slot) const
+{
+    if (raw_)
+        return slot.raw.image;
+
+    ImageView v;
+    v.data = slot.image.data;
+    v.width = slot.image.cols;
+    v.height = slot.image.rows;
+    v.stride = slot.image.step[0];
+    v.format = PixelFormat::Bgr;
+    return v;
+}
+
+void Pipeline::release(FrameSlot &slot)
+{
+    if (raw_ && slot.raw.image.data) {
+        raw_->release(slot.raw);
+        slot.raw.image.data = nullptr;
+    }
+}
+
+void Pipeline::run()
+{
+    Clock::time_point start = Clock::now();
+
+    std::thread capture([this] { capture_loop(); });
+    std::thread infer([this] { infer_loop(); });
+    actuate_loop();
+
+    capture.join();
+    infer.join();
+    wall_ = Clock::now() - start;
+}
+
+void Pipeline::capture_loop()
+{
+    cv::Mat scratch;
+
+    while (!stop_.load(std::memory_order_relaxed) &&
+           (options_.max_frames < 0 || long(captured_) < options_.max_frames)) {
+        FrameSlot *slot = frames_.write_slot();
+
+        if (!slot && !options_.drop_stale) {
+            frame_free_.wait([this] { return frames_.size() < frames_.capacity() || stop_.load(); }, 100ms);
+            continue;
+        }
+
+        // 링이 가득 차도 카메라는 계속 읽어야 드라이버 큐에 오래된 프레임이 쌓이지 않는다
+        Clock::time_point t0 = Clock::now();
+        RawFrame spare;
+        bool ok;
+        if (raw_) {
+            // 캡처 버퍼를 빌려서 링에 넣는다, 추론 스테이지가 다 읽으면 돌려준다
+            RawFrame &frame = slot ? slot->raw : spare;
+            int ret;
+            while ((ret = raw_->acquire(frame, 100)) == -EAGAIN && !stop_.load(std::memory_order_relaxed))
+                ;
+            ok = ret == 0;
+        } else {
+            ok = source_.read(slot ? slot->image : scratch);
+        }
+        Clock::time_point t1 = Clock::now();
+        if (!ok)
+            break;
+
+        capture_timer_.add(t0, t1);
+        stage_ms_[int(Stage::Capture)].add(ms_between(t0, t1));
+        captured_++;
+        if (!slot) {
+            if (raw_)
+                raw_->release(spare);
+            capture_dropped_++;
+            continue;
+        }
+        slot->id = captured_;
+        // 드라이버가 준 센서 시각이 있으면 그것부터 지연을 잰다
+        slot->captured = raw_ ? slot->raw.timestamp : t1;
+        frames_.push();
+        frame_ready_.ring();
+    }
+
+    capture_done_.store(true, std::memory_order_release);
+    frame_ready_.ring();
+}
+
+static void draw(cv::Mat &frame, const std::vector<Detection> &dets, const std::vector<std::string> &names)
+{
+    for (const Detection &d : dets) {
+        cv::rectangle(frame, cv::Point(d.x1, d.y1), cv::Point(d.x2, d.y2), cv::Scalar(0, 255, 0), 2);
+        std::string label = (std::size_t(d.cls) < names.size() ? names[d.cls] : std::to_string(d.cls))
+                            + " " + std::to_string(d.score).substr(0, 4);
+        cv::putText(frame, label, cv::Point(d.x1, std::max(0.0f, d.y1 - 4)),
+                    cv::FONT_HERSHEY_SIMPLEX, 0.6, cv::Scalar(0, 255, 0), 2);
+    }
+}
+
+void Pipeline::infer_loop()
+{
+    for (;;) {
+        FrameSlot *slot = frames_.read_slot();
+
+        if (!slot) {
+            if (capture_done_.load(std::memory_order_acquire) && frames_.empty())
+                break;
+            frame_ready_.wait([this] { return !frames_.empty() || capture_done_.load(); }, 100ms);
+            continue;
+        }
+
+        // 밀린 프레임은 버리고 가장 최근 프레임만 추론한다
+        if (options_.drop_stale) {
+            stale_dropped_ += frames_.drop_stale([this](FrameSlot &stale) { release(stale); });
+            slot = frames_.read_slot();
+        }
+
+        // 정지 장면이면 검출기를 건너뛰고 직전 검출로 다시 투표한다
+        Clock::time_point t0 = Clock::now();
+        ImageView image = view(*slot);
+        bool infer = gate_.should_infer(image);
+        if (infer) {
+            Roi roi = tracker_.plan(image.width, image.height);
+            Clock::time_point d0 = Clock::now();
+            detector_.detect(image, roi, dets_);
+            (roi.full ? full_detect_ms_ : roi_detect_ms_).add(ms_between(d0, Clock::now()));
+            const DetectTiming &timing = detector_.last_timing();
+            stage_ms_[int(Stage::Preprocess)].add(timing.preprocess);
+            stage_ms_[int(Stage::Infer)].add(timing.infer);
+            stage_ms_[int(Stage::Decode)].add(timing.decode);
+            tracker_.update(dets_);
+        }
+        Clock::time_point t1 = Clock::now();
+
+        // 첫 번째가 아니라 점수가 가장 높은 박스로 투표한다
+        const Detection *best;
+        if (infer) {
+            infer_timer_.add(t0, t1);
+            best = best_detection(dets_);
+            has_last_best_ = best != nullptr;
+            if (best)
+                last_best_ = *best;
+        } else {
+            gate_timer_.add(t0, t1);
+            best = has_last_best_ ? &last_best_ : nullptr;
+        }
+        Decision decision;
+        decision.frame_id = slot->id;
+        decision.raw_cls = best ? best->cls : -1;
+        decision.score = best ? best->score : 0.0f;
+        decision.cls = smoother_.update(best);
+        decision.captured = slot->captured;
+        decision.dequeued = t0;
+        if (infer)
+            decision.timing = detector_.last_timing();
+        decision.decided = Clock::now();
+        stage_ms_[int(Stage::Decide)].add(ms_between(t1, decision.decided));
+        decide_latency_.add(ms_between(decision.captured, decision.decided));
+
+        if (options_.show) {
+            cv::Mat shown = slot->image;
+            if (raw_ && image.format == PixelFormat::Yuyv)
+                cv::cvtColor(cv::Mat(image.height, image.width, CV_8UC2, const_cast<std::uint8_t *>(image.data),
+                                     image.stride), shown, cv::COLOR_YUV2BGR_YUYV);
+            else if (raw_)
+                cv::Mat(image.height, image.width, CV_8UC3, const_cast<std::uint8_t *>(image.data),
+                        image.stride).copyTo(shown);
+            draw(shown, dets_, names_);
+            cv::imshow("finger_detect", shown);
+            if (cv::waitKey(1) == 27)
+                request_stop();
+        }
+
+        release(*slot);
+
+        frames_.pop();
+        frame_free_.ring();
+
+        // 오프라인 재생에서는 결정도 버리지 않고 액추에이션 스테이지를 기다린다
+        Decision *out = decisions_.write_slot();
+        while (!out && !options_.drop_stale && !stop_.load(std::memory_order_relaxed)) {
+            decision_free_.wait([this] { return decisions_.size() < decisions_.capacity() || stop_.load(); }, 100ms);
+            out = decisions_.write_slot();
+        }
+        if (!out) {
+            decision_dropped_++;
+            continue;
+        }
+        *out = decision;
+        decisions_.push();
+        decision_ready_.ring();
+    }
+
+    infer_done_.store(true, std::memory_order_release);
+    decision_ready_.ring();
+}
+
+void Pipeline::actuate_loop()
+{
+    int applied = -1;
+
+    for (;;) {
+        // 표는 이 스레드만 쓰므로 재적재도 여기서 한다, 바뀐 동작은 다음 결정에 다시 적용
+        if (reload_.exchange(false, std::memory_order_relaxed)) {
+            int ret = actuator_.reload();
+            if (ret < 0)
+                printf("Actions reload error : %s line %d (%d), keeping the old table\n",
+                       actuator_.path().c_str(), actuator_.error_line(), ret);
+            else
+                printf("Actions reloaded : %s\n", actuator_.path().empty() ? "(built-in)" : actuator_.path().c_str());
+            applied = -1;
+        }
+
+        Decision *decision = decisions_.read_slot();
+
+        if (!decision) {
+            if (infer_done_.load(std::memory_order_acquire) && decisions_.empty())
+                break;
+            decision_ready_.wait([this] { return !decisions_.empty() || infer_done_.load(); }, 100ms);
+            continue;
+        }
+
+        // 결정이 바뀔 때만 디바이스를 건드린다
+        if (decision->cls >= 0 && decision->cls != applied) {
+            // 추적 중이면 프레임 id 를 쿠키로 드라이버까지 넘긴다
+            FrameTrace *trace = options_.trace;
+            Clock::time_point t0 = Clock::now();
+            int ret = actuator_.apply(decision->cls, trace ? decision->frame_id : 0);
+            Clock::time_point t1 = Clock::now();
+            actuate_timer_.add(t0, t1);
+            stage_ms_[int(Stage::Actuate)].add(ms_between(t0, t1));
+            actuate_latency_.add(ms_between(decision->captured, t1));
+            // 실패하면 -1 로 남겨 같은 결정이 다음에 다시 적용되게 한다
+            applied = ret >= 0 ? decision->cls : -1;
+            actuations_++;
+
+            if (trace) {
+                FrameMark mark;
+                mark.cookie = decision->frame_id;
+                mark.captured = decision->captured;
+                mark.dequeued = decision->dequeued;
+                mark.preprocess_ms = decision->timing.preprocess;
+                mark.infer_ms = decision->timing.infer;
+                mark.decode_ms = decision->timing.decode;
+                mark.decided = decision->decided;
+                mark.submit = t0;
+                mark.submitted = t1;
+                trace->mark(mark);
+            }
+
+            if (ret < 0)
+                printf("Write Error! (%d)\n", ret);
+            if (options_.verbose)
+                printf("frame %lu : %s -> %s\n", decision->frame_id,
+                       std::size_t(decision->cls) < names_.size() ? names_[decision->cls].c_str() : "?",
+                       actuator_.active());
+        }
+        if (options_.record_decisions)
+            log_.push_back(*decision);
+        decisions_.pop();
+        decision_free_.ring();
+    }
+}
+
+void Pipeline::print_report(FILE *out) const
+{
+    double wall_s = std::chrono::duration<double>(wall_).count();
+
+    fprintf(out, "frames captured=%lu inferred=%lu capture_dropped=%lu stale_dropped=%lu decision_dropped=%lu\n",
+            captured_, infer_timer_.items, capture_dropped_, stale_dropped_, decision_dropped_);
+    if (gate_.enabled())
+        fprintf(out, "motion gate skipped=%lu motion=%lu skip_cost_ms=%.3f\n",
+                gate_.skipped(), gate_.motion_frames(),
+                gate_timer_.items ? std::chrono::duration<double, std::milli>(gate_timer_.busy).count() / gate_timer_.items
+                                  : 0.0);
+    if (raw_)
+        fprintf(out, "raw capture dropped=%lu (latest frame)\n", raw_->dropped());
+    fprintf(out, "fps capture=%.2f infer=%.2f\n",
+            wall_s > 0 ? captured_ / wall_s : 0.0, wall_s > 0 ? infer_timer_.items / wall_s : 0.0);
+    fprintf(out, "latency capture->decision ms p50=%.2f p99=%.2f max=%.2f (n=%zu)\n",
+            decide_latency_.percentile(50), decide_latency_.percentile(99), decide_latency_.max(),
+            decide_latency_.count());
+    fprintf(out, "latency capture->actuation ms p50=%.2f p99=%.2f max=%.2f (n=%zu)\n",
+            actuate_latency_.percentile(50), actuate_latency_.percentile(99), actuate_latency_.max(),
+            actuate_latency_.count());
+    if (tracker_.enabled()) {
+        double full_ms = full_detect_ms_.mean();
+        double roi_ms = roi_detect_ms_.mean();
+        fprintf(out, "detect full ms p50=%.2f mean=%.2f (n=%zu) roi ms p50=%.2f mean=%.2f (n=%zu) lost=%lu\n",
+                full_detect_ms_.percentile(50), full_ms, full_detect_ms_.count(),
+                roi_detect_ms_.percentile(50), roi_ms, roi_detect_ms_.count(), tracker_.lost());
+        // 모든 프레임을 전체 검출했을 때와 비교한 프레임당 평균 절감
+        std::size_t n = full_detect_ms_.count() + roi_detect_ms_.count();
+        if (n && full_ms > 0)
+            fprintf(out, "detect saving per frame ms=%.2f (%.1f%%)\n",
+                    roi_detect_ms_.count() * (full_ms - roi_ms) / n,
+                    100.0 * roi_detect_ms_.count() * (full_ms - roi_ms) / (n * full_ms));
+    }
+    fprintf(out, "decisions changes=%lu actuations=%lu\n", smoother_.changes(), actuations_);
+    if (options_.trace)
+        fprintf(out, "trace marks=%lu errors=%lu\n", options_.trace->marks(), options_.trace->errors());
+    fprintf(out, "utilization capture=%.1f%% infer=%.1f%% actuate=%.1f%%\n",
+            100.0 * capture_timer_.utilization(wall_), 100.0 * infer_timer_.utilization(wall_),
+            100.0 * actuate_timer_.utilization(wall_));
+}
+
+} // namespace finger
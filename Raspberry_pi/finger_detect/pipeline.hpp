@@ -0,0 +1,169 @@
+/*
+ * Three-stage capture / inference / actuation pipeline
+ *
+ * capture  --[SpscRing<FrameSlot>]-->  inference + smoothing  --[SpscRing<Decision>]-->  actuation
+ *
+ * Each stage runs on its own thread so camera I/O, YOLO inference and bus
+ * writes overlap. Frame slots are reused in place (a camera keeps writing
+ * into the same cv::Mat buffers). With drop_stale the inference stage
+ * always jumps to the newest queued frame so latency stays bounded; when
+ * the frame ring is full the capture stage drops the new frame instead of
+ * blocking the camera. The actuation stage only touches the devices when
+ * the smoothed class decision changes.
+ *
+ * A MotionGate in front of the detector skips inference on static frames;
+ * the smoother then gets the last frame's detection again, so its vote
+ * window keeps counting frames while the detector idles. With a HandTracker
+ * enabled the detector runs on a crop around the predicted hand and only
+ * looks at the full frame every K frames or after the track is lost.
+ *
+ * With a raw source (V4L2 or raw file replay) the frame ring carries
+ * borrowed capture buffers instead of cv::Mat copies; the inference stage
+ * preprocesses them in place and hands them back, including the stale
+ * frames it skips.
+ *
+ * Every stage also records per-frame latencies (stage_latency()), and with
+ * record_decisions the actuation stage keeps every decision it consumed,
+ * so an offline replay can be scored against ground truth afterwards.
+ *
+ * With a FrameTrace the frame id also travels to the drivers as the trace
+ * cookie of each actuation, and the user space timestamps of that frame
+ * are written to trace_marker (frame_trace.hpp) for latency_join.py.
+ */
+#ifndef FINGER_DETECT_PIPELINE_HPP
+#define FINGER_DETECT_PIPELINE_HPP
+
+#include <atomic>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include <opencv2/core.hpp>
+
+#include "actuator.hpp"
+#include "decision.hpp"
+#include "detector.hpp"
+#include "frame_source.hpp"
+#include "frame_trace.hpp"
+#include "motion_gate.hpp"
+#include "spsc_ring.hpp"
+#include "stats.hpp"
+#include "tracker.hpp"
+
+namespace finger {
+
+struct PipelineOptions {
+    // false 이면 모든 프레임을 순서대로 처리한다 (동영상 오프라인 재생용)
+    bool drop_stale = true;
+    bool show = false;
+    bool verbose = false;
+    long max_frames = -1;
+    bool record_decisions = false; // decisions() 에 모든 결정을 남긴다 (오프라인 평가용)
+    FrameTrace *trace = nullptr;   // 액추에이션한 프레임을 trace_marker 에 남긴다
+    MotionGateOptions gate;
+    TrackerOptions tracker;
+};
+
+struct FrameSlot {
+    cv::Mat image; // read() 로 받은 프레임 (raw 소스가 아닐 때)
+    RawFrame raw;  // 빌려 온 캡처 버퍼 (raw 소스일 때)
+    unsigned long id = 0;
+    Clock::time_point captured;
+};
+
+struct Decision {
+    unsigned long frame_id = 0;
+    int cls = -1;     // 평활화된 결정 (-1: 아직 없음)
+    int raw_cls = -1; // 이 프레임의 최고 점수 검출 (-1: 검출 없음)
+    float score = 0.0f;
+    Clock::time_point captured;
+    Clock::time_point dequeued; // 추론 스테이지가 프레임을 꺼낸 시각
+    Clock::time_point decided;
+    DetectTiming timing;        // 추론을 건너뛴 프레임은 0
+};
+
+// 프레임 하나가 거치는 단계, stage_latency() 의 인덱스
+enum class Stage {
+    Capture,    // 카메라/동영상 디코딩 또는 캡처 버퍼 받기
+    Preprocess, // 입력 텐서 채우기
+    Infer,      // net.forward()
+    Decode,     // YOLO 디코딩 + NMS
+    Decide,     // 평활화
+    Actuate,    // 디바이스 쓰기 (결정이 바뀐 프레임만)
+    Count,
+};
+
+const char *stage_name(Stage stage);
+
+class Pipeline {
+public:
+    Pipeline(FrameSource &source, Detector &detector, DecisionSmoother &smoother, Actuator &actuator,
+             const std::vector<std::string> &names, const PipelineOptions &options);
+
+    // 세 스테이지를 시작하고 입력이 끝나거나 request_stop() 될 때까지 기다린다
+    void run();
+
+    // 시그널 핸들러에서 호출해도 안전하다 (lock-free atomic store)
+    void request_stop() { stop_.store(true, std::memory_order_relaxed); }
+    // 액추에이션 스테이지가 다음 결정 전에 동작 설정을 다시 읽는다 (SIGHUP)
+    void request_reload() { reload_.store(true, std::memory_order_relaxed); }
+
+    void print_report(FILE *out) const;
+
+    // run() 이 끝난 뒤에만 읽는다
+    const LatencyStats &stage_latency(Stage stage) const { return stage_ms_[int(stage)]; }
+    const LatencyStats &decide_latency() const { return decide_latency_; }
+    const LatencyStats &actuate_latency() const { return actuate_latency_; }
+    const std::vector<Decision> &decisions() const { return log_; }
+    unsigned long captured() const { return captured_; }
+    unsigned long inferred() const { return infer_timer_.items; }
+    unsigned long actuations() const { return actuations_; }
+    Clock::duration wall() const { return wall_; }
+
+private:
+    void capture_loop();
+    void infer_loop();
+    void actuate_loop();
+    ImageView view(const FrameSlot &slot) const;
+    void release(FrameSlot &slot);
+
+    FrameSource &source_;
+    Detector &detector_;
+    DecisionSmoother &smoother_;
+    Actuator &actuator_;
+    const std::vector<std::string> &names_;
+    PipelineOptions options_;
+    RawSource *raw_;
+
+    SpscRing<FrameSlot, 4> frames_;
+    SpscRing<Decision, 16> decisions_;
+    Doorbell frame_ready_;
+    Doorbell frame_free_;
+    Doorbell decision_ready_;
+    Doorbell decision_free_;
+
+    std::atomic<bool> stop_{false};
+    std::atomic<bool> reload_{false};
+    std::atomic<bool> capture_done_{false};
+    std::atomic<bool> infer_done_{false};
+
+    // 각 스테이지 스레드만 자기 통계를 쓰고, run() 이 끝난 뒤에만 읽는다
+    std::vector<Detection> dets_;
+    MotionGate gate_;
+    HandTracker tracker_;
+    Detection last_best_{};
+    bool has_last_best_ = false;
+    StageTimer capture_timer_, infer_timer_, gate_timer_, actuate_timer_;
+    LatencyStats decide_latency_, actuate_latency_;
+    LatencyStats full_detect_ms_, roi_detect_ms_;
+    LatencyStats stage_ms_[int(Stage::Count)];
+    std::vector<Decision> log_;
+    unsigned long captured_ = 0, capture_dropped_ = 0;
+    unsigned long stale_dropped_ = 0, decision_dropped_ = 0;
+    unsigned long actuations_ = 0;
+    Clock::duration wall_{};
+};
+
+} // namespace finger
+
+#endif // FINGER_DETECT_PIPELINE_HPP
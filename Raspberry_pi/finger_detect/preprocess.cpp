@@ -0,0 +1,544 @@
+/*
+ * Fused YOLO input preprocessing
+ */
+#include "preprocess.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define PREPROCESS_NEON 1
+#elif defined(__AVX2__)
+#include <immintrin.h>
+#define PREPROCESS_AVX2 1
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#define PREPROCESS_SSE2 1
+#endif
+
+namespace finger {
+
+namespace {
+
+constexpr std::uint8_t kPadValue = 114;
+
+// 원본 길이 src 를 dst 로 줄일 때 cv::resize(INTER_LINEAR) 와 같은 탭 위치
+void linear_taps(int src, int dst, std::vector<int> &i0, std::vector<int> &i1, std::vector<std::uint8_t> &w)
+{
+    const double scale = double(src) / dst;
+
+    i0.resize(dst);
+    i1.resize(dst);
+    w.resize(dst);
+    for (int d = 0; d < dst; d++) {
+        double f = (d + 0.5) * scale - 0.5;
+        int s = int(std::floor(f));
+        int frac = int(std::lround((f - s) * 256.0));
+
+        if (frac >= 256) {
+            s++;
+            frac = 0;
+        }
+        if (s < 0) {
+            s = 0;
+            frac = 0;
+        }
+        if (s >= src - 1) {
+            s = src - 1;
+            frac = 0;
+        }
+        i0[d] = s;
+        i1[d] = std::min(s + 1, src - 1);
+        w[d] = std::uint8_t(frac);
+    }
+}
+
+inline std::uint8_t lerp(int a, int b, int w)
+{
+    return std::uint8_t((a * (256 - w) + b * w + 128) >> 8);
+}
+
+inline std::uint8_t clamp_u8(int v)
+{
+    return std::uint8_t(v < 0 ? 0 : v > 255 ? 255 : v);
+}
+
+// out = (a * (256 - w) + b * w + 128) >> 8, w 는 1..255
+void blend_rows(const std::uint8_t *a, const std::uint8_t *b, int w, std::uint8_t *out, std::size_t n, bool simd)
+{
+    std::size_t i = 0;
+
+    if (simd) {
+#if defined(PREPROCESS_NEON)
+        const uint8x8_t wa = vdup_n_u8(std::uint8_t(256 - w));
+        const uint8x8_t wb = vdup_n_u8(std::uint8_t(w));
+        for (; i + 16 <= n; i += 16) {
+            uint8x16_t va = vld1q_u8(a + i);
+            uint8x16_t vb = vld1q_u8(b + i);
+            uint16x8_t lo = vmlal_u8(vmull_u8(vget_low_u8(va), wa), vget_low_u8(vb), wb);
+            uint16x8_t hi = vmlal_u8(vmull_u8(vget_high_u8(va), wa), vget_high_u8(vb), wb);
+            vst1q_u8(out + i, vcombine_u8(vrshrn_n_u16(lo, 8), vrshrn_n_u16(hi, 8)));
+        }
+#elif defined(PREPROCESS_AVX2)
+        const __m256i wa = _mm256_set1_epi16(short(256 - w));
+        const __m256i wb = _mm256_set1_epi16(short(w));
+        const __m256i round = _mm256_set1_epi16(128);
+        const __m256i zero = _mm256_setzero_si256();
+        for (; i + 32 <= n; i += 32) {
+            __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(a + i));
+            __m256i vb = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(b + i));
+            __m256i lo = _mm256_add_epi16(_mm256_mullo_epi16(_mm256_unpacklo_epi8(va, zero), wa),
+                                          _mm256_mullo_epi16(_mm256_unpacklo_epi8(vb, zero), wb));
+            __m256i hi = _mm256_add_epi16(_mm256_mullo_epi16(_mm256_unpackhi_epi8(va, zero), wa),
+                                          _mm256_mullo_epi16(_mm256_unpackhi_epi8(vb, zero), wb));
+            lo = _mm256_srli_epi16(_mm256_add_epi16(lo, round), 8);
+            hi = _mm256_srli_epi16(_mm256_add_epi16(hi, round), 8);
+            // unpack/pack 은 128비트 레인 안에서 짝이 맞으므로 순서가 그대로 돌아온다
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + i), _mm256_packus_epi16(lo, hi));
+        }
+#elif defined(PREPROCESS_SSE2)
+        const __m128i wa = _mm_set1_epi16(short(256 - w));
+        const __m128i wb = _mm_set1_epi16(short(w));
+        const __m128i round = _mm_set1_epi16(128);
+        const __m128i zero = _mm_setzero_si128();
+        for (; i + 16 <= n; i += 16) {
+            __m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i *>(a + i));
+            __m128i vb = _mm_loadu_si128(reinterpret_cast<const __m128i *>(b + i));
+            __m128i lo = _mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(va, zero), wa),
+                                       _mm_mullo_epi16(_mm_unpacklo_epi8(vb, zero), wb));
+            __m128i hi = _mm_add_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(va, zero), wa),
+                                       _mm_mullo_epi16(_mm_unpackhi_epi8(vb, zero), wb));
+            lo = _mm_srli_epi16(_mm_add_epi16(lo, round), 8);
+            hi = _mm_srli_epi16(_mm_add_epi16(hi, round), 8);
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(out + i), _mm_packus_epi16(lo, hi));
+        }
+#endif
+    }
+    for (; i < n; i++)
+        out[i] = lerp(a[i], b[i], w);
+}
+
+// 바이트 평면 한 행을 float 로 넓히며 scale 을 곱한다
+void widen(const std::uint8_t *in, float *out, std::size_t n, float scale, bool simd)
+{
+    std::size_t i = 0;
+
+    if (simd) {
+#if defined(PREPROCESS_NEON)
+        const float32x4_t k = vdupq_n_f32(scale);
+        for (; i + 16 <= n; i += 16) {
+            uint8x16_t v = vld1q_u8(in + i);
+            uint16x8_t lo = vmovl_u8(vget_low_u8(v));
+            uint16x8_t hi = vmovl_u8(vget_high_u8(v));
+            vst1q_f32(out + i, vmulq_f32(vcvtq_f32_u32(vmovl_u16(vget_low_u16(lo))), k));
+            vst1q_f32(out + i + 4, vmulq_f32(vcvtq_f32_u32(vmovl_u16(vget_high_u16(lo))), k));
+            vst1q_f32(out + i + 8, vmulq_f32(vcvtq_f32_u32(vmovl_u16(vget_low_u16(hi))), k));
+            vst1q_f32(out + i + 12, vmulq_f32(vcvtq_f32_u32(vmovl_u16(vget_high_u16(hi))), k));
+        }
+#elif defined(PREPROCESS_AVX2)
+        const __m256 k = _mm256_set1_ps(scale);
+        for (; i + 8 <= n; i += 8) {
+            __m128i v = _mm_loadl_epi64(reinterpret_cast<const __m128i *>(in + i));
+            _mm256_storeu_ps(out + i, _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(v)), k));
+        }
+#elif defined(PREPROCESS_SSE2)
+        const __m128 k = _mm_set1_ps(scale);
+        const __m128i zero = _mm_setzero_si128();
+        for (; i + 16 <= n; i += 16) {
+            __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + i));
+            __m128i lo = _mm_unpacklo_epi8(v, zero);
+            __m128i hi = _mm_unpackhi_epi8(v, zero);
+            _mm_storeu_ps(out + i, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(lo, zero)), k));
+            _mm_storeu_ps(out + i + 4, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(lo, zero)), k));
+            _mm_storeu_ps(out + i + 8, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(hi, zero)), k));
+            _mm_storeu_ps(out + i + 12, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(hi, zero)), k));
+        }
+#endif
+    }
+    for (; i < n; i++)
+        out[i] = in[i] * scale;
+}
+
+// 바이트 평면 한 행을 int8 로 옮긴다 (v - 128 == v ^ 0x80)
+void widen(const std::uint8_t *in, std::int8_t *out, std::size_t n, float, bool simd)
+{
+    std::size_t i = 0;
+
+    if (simd) {
+#if defined(PREPROCESS_NEON)
+        const uint8x16_t bias = vdupq_n_u8(0x80);
+        for (; i + 16 <= n; i += 16)
+            vst1q_s8(out + i, vreinterpretq_s8_u8(veorq_u8(vld1q_u8(in + i), bias)));
+#elif defined(PREPROCESS_AVX2) || defined(PREPROCESS_SSE2)
+        const __m128i bias = _mm_set1_epi8(char(0x80));
+        for (; i + 16 <= n; i += 16) {
+            __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + i));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(out + i), _mm_xor_si128(v, bias));
+        }
+#endif
+    }
+    for (; i < n; i++)
+        out[i] = std::int8_t(in[i] ^ 0x80);
+}
+
+/*
+ * BT.601 limited range -> RGB (y = Y - 16, u = U - 128, v = V - 128). SIMD 경로는
+ * 298 = 256 + 42, 409 = 512 - 103, 208 = 256 - 48, 516 = 512 + 4 로 나눠 >> 8 할
+ * 나머지 항만 int16 으로 계산한다. 256 의 배수 항은 시프트 밖으로 빠지므로 스칼라와 같다.
+ */
+inline void yuv_to_rgb(int y, int u, int v, std::uint8_t &r, std::uint8_t &g, std::uint8_t &b)
+{
+    const int c = 298 * y + 128;
+
+    r = clamp_u8((c + 409 * v) >> 8);
+    g = clamp_u8((c - 100 * u - 208 * v) >> 8);
+    b = clamp_u8((c + 516 * u) >> 8);
+}
+
+#if defined(PREPROCESS_NEON)
+inline void yuv_to_rgb16(int16x8_t y, int16x8_t u, int16x8_t v, int16x8_t &r, int16x8_t &g, int16x8_t &b)
+{
+    const int16x8_t c = vmlaq_n_s16(vdupq_n_s16(128), y, 42);
+
+    r = vaddq_s16(vaddq_s16(y, vaddq_s16(v, v)), vshrq_n_s16(vmlsq_n_s16(c, v, 103), 8));
+    g = vaddq_s16(vsubq_s16(y, v), vshrq_n_s16(vmlaq_n_s16(vmlsq_n_s16(c, u, 100), v, 48), 8));
+    b = vaddq_s16(vaddq_s16(y, vaddq_s16(u, u)), vshrq_n_s16(vmlaq_n_s16(c, u, 4), 8));
+}
+#elif defined(PREPROCESS_AVX2)
+inline void yuv_to_rgb16(__m256i y, __m256i u, __m256i v, __m256i &r, __m256i &g, __m256i &b)
+{
+    const __m256i c = _mm256_add_epi16(_mm256_mullo_epi16(y, _mm256_set1_epi16(42)), _mm256_set1_epi16(128));
+    const __m256i rv = _mm256_sub_epi16(c, _mm256_mullo_epi16(v, _mm256_set1_epi16(103)));
+    const __m256i gu = _mm256_sub_epi16(c, _mm256_mullo_epi16(u, _mm256_set1_epi16(100)));
+    const __m256i guv = _mm256_add_epi16(gu, _mm256_mullo_epi16(v, _mm256_set1_epi16(48)));
+    const __m256i bu = _mm256_add_epi16(c, _mm256_slli_epi16(u, 2));
+
+    r = _mm256_add_epi16(_mm256_add_epi16(y, _mm256_add_epi16(v, v)), _mm256_srai_epi16(rv, 8));
+    g = _mm256_add_epi16(_mm256_sub_epi16(y, v), _mm256_srai_epi16(guv, 8));
+    b = _mm256_add_epi16(_mm256_add_epi16(y, _mm256_add_epi16(u, u)), _mm256_srai_epi16(bu, 8));
+}
+#elif defined(PREPROCESS_SSE2)
+inline void yuv_to_rgb16(__m128i y, __m128i u, __m128i v, __m128i &r, __m128i &g, __m128i &b)
+{
+    const __m128i c = _mm_add_epi16(_mm_mullo_epi16(y, _mm_set1_epi16(42)), _mm_set1_epi16(128));
+    const __m128i rv = _mm_sub_epi16(c, _mm_mullo_epi16(v, _mm_set1_epi16(103)));
+    const __m128i gu = _mm_sub_epi16(c, _mm_mullo_epi16(u, _mm_set1_epi16(100)));
+    const __m128i guv = _mm_add_epi16(gu, _mm_mullo_epi16(v, _mm_set1_epi16(48)));
+    const __m128i bu = _mm_add_epi16(c, _mm_slli_epi16(u, 2));
+
+    r = _mm_add_epi16(_mm_add_epi16(y, _mm_add_epi16(v, v)), _mm_srai_epi16(rv, 8));
+    g = _mm_add_epi16(_mm_sub_epi16(y, v), _mm_srai_epi16(guv, 8));
+    b = _mm_add_epi16(_mm_add_epi16(y, _mm_add_epi16(u, u)), _mm_srai_epi16(bu, 8));
+}
+#endif
+
+#if defined(PREPROCESS_SSE2) || defined(PREPROCESS_AVX2)
+// 16 바이트 6 개 (3 채널 32 픽셀) 를 채널별로 나눈다. 같은 unpack 단계를 다섯 번 거치면
+// c[0..1] 이 채널 0, c[2..3] 이 채널 1, c[4..5] 가 채널 2 가 된다 (SSSE3 없이)
+inline void deinterleave3_epi8(__m128i c[6])
+{
+    for (int layer = 0; layer < 5; layer++) {
+        __m128i t[6];
+        for (int j = 0; j < 3; j++) {
+            t[2 * j] = _mm_unpacklo_epi8(c[j], c[j + 3]);
+            t[2 * j + 1] = _mm_unpackhi_epi8(c[j], c[j + 3]);
+        }
+        for (int j = 0; j < 6; j++)
+            c[j] = t[j];
+    }
+}
+#endif
+
+// 3 바이트 픽셀 한 행을 세 평면으로 나눈다 (BGR 은 c0 = B, c1 = G, c2 = R)
+void deinterleave3(const std::uint8_t *in, std::uint8_t *c0, std::uint8_t *c1, std::uint8_t *c2, int n,
+                   bool simd)
+{
+    int i = 0;
+
+    if (simd) {
+#if defined(PREPROCESS_NEON)
+        for (; i + 16 <= n; i += 16) {
+            uint8x16x3_t px = vld3q_u8(in + i * 3);
+            vst1q_u8(c0 + i, px.val[0]);
+            vst1q_u8(c1 + i, px.val[1]);
+            vst1q_u8(c2 + i, px.val[2]);
+        }
+#elif defined(PREPROCESS_AVX2) || defined(PREPROCESS_SSE2)
+        for (; i + 32 <= n; i += 32) {
+            __m128i c[6];
+            for (int k = 0; k < 6; k++)
+                c[k] = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + i * 3 + k * 16));
+            deinterleave3_epi8(c);
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(c0 + i), c[0]);
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(c0 + i + 16), c[1]);
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(c1 + i), c[2]);
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(c1 + i + 16), c[3]);
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(c2 + i), c[4]);
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(c2 + i + 16), c[5]);
+        }
+#endif
+    }
+    for (; i < n; i++) {
+        c0[i] = in[i * 3];
+        c1[i] = in[i * 3 + 1];
+        c2[i] = in[i * 3 + 2];
+    }
+}
+
+// 가로 배율 1 인 YUYV 한 행을 바로 R/G/B 평면으로, SIMD 로 처리한 픽셀 수를 돌려준다
+int yuyv_to_rgb_identity(const std::uint8_t *in, std::uint8_t *r, std::uint8_t *g, std::uint8_t *b, int n)
+{
+    int i = 0;
+
+#if defined(PREPROCESS_NEON)
+    const uint8x8_t k16 = vdup_n_u8(16), k128 = vdup_n_u8(128);
+    for (; i + 16 <= n; i += 16) {
+        // Y0 U Y1 V 가 8 묶음: 짝수 픽셀과 홀수 픽셀이 같은 U/V 를 쓴다
+        uint8x8x4_t px = vld4_u8(in + i * 2);
+        int16x8_t u = vreinterpretq_s16_u16(vsubl_u8(px.val[1], k128));
+        int16x8_t v = vreinterpretq_s16_u16(vsubl_u8(px.val[3], k128));
+        int16x8_t r0, g0, b0, r1, g1, b1;
+        yuv_to_rgb16(vreinterpretq_s16_u16(vsubl_u8(px.val[0], k16)), u, v, r0, g0, b0);
+        yuv_to_rgb16(vreinterpretq_s16_u16(vsubl_u8(px.val[2], k16)), u, v, r1, g1, b1);
+        vst2_u8(r + i, uint8x8x2_t{{vqmovun_s16(r0), vqmovun_s16(r1)}});
+        vst2_u8(g + i, uint8x8x2_t{{vqmovun_s16(g0), vqmovun_s16(g1)}});
+        vst2_u8(b + i, uint8x8x2_t{{vqmovun_s16(b0), vqmovun_s16(b1)}});
+    }
+#elif defined(PREPROCESS_AVX2)
+    const __m256i lo8 = _mm256_set1_epi16(0x00ff), lo16 = _mm256_set1_epi32(0xffff);
+    const __m256i k16 = _mm256_set1_epi16(16), k128 = _mm256_set1_epi16(128);
+    for (; i + 32 <= n; i += 32) {
+        __m256i rgb[3][2];
+        for (int h = 0; h < 2; h++) {
+            // 16 비트 칸마다 Y 와 U 또는 V 가 하나씩, U/V 를 32 비트 칸 안에서 두 픽셀로 복사한다
+            __m256i px = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(in + (i + h * 16) * 2));
+            __m256i y = _mm256_sub_epi16(_mm256_and_si256(px, lo8), k16);
+            __m256i uv = _mm256_sub_epi16(_mm256_srli_epi16(px, 8), k128);
+            __m256i u = _mm256_or_si256(_mm256_and_si256(uv, lo16), _mm256_slli_epi32(uv, 16));
+            __m256i v = _mm256_or_si256(_mm256_srli_epi32(uv, 16), _mm256_andnot_si256(lo16, uv));
+            yuv_to_rgb16(y, u, v, rgb[0][h], rgb[1][h], rgb[2][h]);
+        }
+        // packus 는 128 비트 레인마다 묶으므로 64 비트 단위로 순서를 되돌린다
+        std::uint8_t *out[3] = {r + i, g + i, b + i};
+        for (int c = 0; c < 3; c++)
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(out[c]),
+                                _mm256_permute4x64_epi64(_mm256_packus_epi16(rgb[c][0], rgb[c][1]), 0xd8));
+    }
+#elif defined(PREPROCESS_SSE2)
+    const __m128i lo8 = _mm_set1_epi16(0x00ff), lo16 = _mm_set1_epi32(0xffff);
+    const __m128i k16 = _mm_set1_epi16(16), k128 = _mm_set1_epi16(128);
+    for (; i + 16 <= n; i += 16) {
+        __m128i rgb[3][2];
+        for (int h = 0; h < 2; h++) {
+            // 16 비트 칸마다 Y 와 U 또는 V 가 하나씩, U/V 를 32 비트 칸 안에서 두 픽셀로 복사한다
+            __m128i px = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + (i + h * 8) * 2));
+            __m128i y = _mm_sub_epi16(_mm_and_si128(px, lo8), k16);
+            __m128i uv = _mm_sub_epi16(_mm_srli_epi16(px, 8), k128);
+            __m128i u = _mm_or_si128(_mm_and_si128(uv, lo16), _mm_slli_epi32(uv, 16));
+            __m128i v = _mm_or_si128(_mm_srli_epi32(uv, 16), _mm_andnot_si128(lo16, uv));
+            yuv_to_rgb16(y, u, v, rgb[0][h], rgb[1][h], rgb[2][h]);
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(r + i), _mm_packus_epi16(rgb[0][0], rgb[0][1]));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(g + i), _mm_packus_epi16(rgb[1][0], rgb[1][1]));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(b + i), _mm_packus_epi16(rgb[2][0], rgb[2][1]));
+    }
+#else
+    (void)in, (void)r, (void)g, (void)b, (void)n;
+#endif
+    return i;
+}
+
+// 평면 Y/U/V 바이트 (r/g/b 자리에 들어 있다) 를 제자리에서 R/G/B 로 바꾼다
+void yuv_planes_to_rgb(std::uint8_t *r, std::uint8_t *g, std::uint8_t *b, int n)
+{
+    int i = 0;
+
+#if defined(PREPROCESS_NEON)
+    const uint8x8_t k16 = vdup_n_u8(16), k128 = vdup_n_u8(128);
+    for (; i + 8 <= n; i += 8) {
+        int16x8_t y = vreinterpretq_s16_u16(vsubl_u8(vld1_u8(r + i), k16));
+        int16x8_t u = vreinterpretq_s16_u16(vsubl_u8(vld1_u8(g + i), k128));
+        int16x8_t v = vreinterpretq_s16_u16(vsubl_u8(vld1_u8(b + i), k128));
+        int16x8_t vr, vg, vb;
+        yuv_to_rgb16(y, u, v, vr, vg, vb);
+        vst1_u8(r + i, vqmovun_s16(vr));
+        vst1_u8(g + i, vqmovun_s16(vg));
+        vst1_u8(b + i, vqmovun_s16(vb));
+    }
+#elif defined(PREPROCESS_AVX2)
+    const __m256i k16 = _mm256_set1_epi16(16), k128 = _mm256_set1_epi16(128);
+    for (; i + 16 <= n; i += 16) {
+        __m256i y = _mm256_sub_epi16(
+            _mm256_cvtepu8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i *>(r + i))), k16);
+        __m256i u = _mm256_sub_epi16(
+            _mm256_cvtepu8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i *>(g + i))), k128);
+        __m256i v = _mm256_sub_epi16(
+            _mm256_cvtepu8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i *>(b + i))), k128);
+        __m256i vr, vg, vb;
+        yuv_to_rgb16(y, u, v, vr, vg, vb);
+        // 16 개를 한 레인에 모은다
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(r + i),
+                         _mm256_castsi256_si128(_mm256_permute4x64_epi64(_mm256_packus_epi16(vr, vr), 0xd8)));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(g + i),
+                         _mm256_castsi256_si128(_mm256_permute4x64_epi64(_mm256_packus_epi16(vg, vg), 0xd8)));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(b + i),
+                         _mm256_castsi256_si128(_mm256_permute4x64_epi64(_mm256_packus_epi16(vb, vb), 0xd8)));
+    }
+#elif defined(PREPROCESS_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i k16 = _mm_set1_epi16(16), k128 = _mm_set1_epi16(128);
+    for (; i + 8 <= n; i += 8) {
+        __m128i y = _mm_loadl_epi64(reinterpret_cast<const __m128i *>(r + i));
+        __m128i u = _mm_loadl_epi64(reinterpret_cast<const __m128i *>(g + i));
+        __m128i v = _mm_loadl_epi64(reinterpret_cast<const __m128i *>(b + i));
+        y = _mm_sub_epi16(_mm_unpacklo_epi8(y, zero), k16);
+        u = _mm_sub_epi16(_mm_unpacklo_epi8(u, zero), k128);
+        v = _mm_sub_epi16(_mm_unpacklo_epi8(v, zero), k128);
+        __m128i vr, vg, vb;
+        yuv_to_rgb16(y, u, v, vr, vg, vb);
+        _mm_storel_epi64(reinterpret_cast<__m128i *>(r + i), _mm_packus_epi16(vr, vr));
+        _mm_storel_epi64(reinterpret_cast<__m128i *>(g + i), _mm_packus_epi16(vg, vg));
+        _mm_storel_epi64(reinterpret_cast<__m128i *>(b + i), _mm_packus_epi16(vb, vb));
+    }
+#endif
+    for (; i < n; i++)
+        yuv_to_rgb(r[i] - 16, g[i] - 128, b[i] - 128, r[i], g[i], b[i]);
+}
+
+inline float pad_value(float *) { return kPadValue / 255.0f; }
+inline std::int8_t pad_value(std::int8_t *) { return std::int8_t(kPadValue - 128); }
+
+} // namespace
+
+Preprocessor::Preprocessor(int image_w, int image_h, PixelFormat format, int input_w, int input_h)
+    : lb_(make_letterbox(image_w, image_h, input_w, input_h)), format_(format)
+{
+    linear_taps(image_w, lb_.resized_w, x0_, x1_, xw_);
+    linear_taps(image_h, lb_.resized_h, y0_, y1_, yw_);
+    identity_x_ = lb_.resized_w == image_w;
+
+    blend_.resize(std::size_t(image_w) * bytes_per_pixel(format_));
+    planes_.resize(std::size_t(lb_.resized_w) * 3);
+}
+
+bool Preprocessor::matches(int image_w, int image_h, PixelFormat format, int input_w, int input_h) const
+{
+    return lb_.image_w == image_w && lb_.image_h == image_h && format_ == format &&
+           lb_.input_w == input_w && lb_.input_h == input_h;
+}
+
+const char *Preprocessor::simd_name()
+{
+#if defined(PREPROCESS_NEON)
+    return "neon";
+#elif defined(PREPROCESS_AVX2)
+    return "avx2";
+#elif defined(PREPROCESS_SSE2)
+    return "sse2";
+#else
+    return "scalar";
+#endif
+}
+
+void Preprocessor::gather_row(const std::uint8_t *row)
+{
+    const int n = lb_.resized_w;
+    std::uint8_t *r = planes_.data();
+    std::uint8_t *g = r + n;
+    std::uint8_t *b = g + n;
+
+    // 가로 배율이 1 이면 보간 없이 채널만 나눈다 (640x480 -> 640x640 이 이 경우)
+    if (format_ == PixelFormat::Bgr && identity_x_) {
+        deinterleave3(row, b, g, r, n, simd_);
+        return;
+    }
+
+    if (format_ == PixelFormat::Bgr) {
+        for (int dx = 0; dx < n; dx++) {
+            const std::uint8_t *p0 = row + x0_[dx] * 3;
+            const std::uint8_t *p1 = row + x1_[dx] * 3;
+            const int w = xw_[dx];
+
+            b[dx] = lerp(p0[0], p1[0], w);
+            g[dx] = lerp(p0[1], p1[1], w);
+            r[dx] = lerp(p0[2], p1[2], w);
+        }
+        return;
+    }
+
+    // YUYV: Y 는 픽셀마다, U/V 는 두 픽셀이 공유한다. 보간 후 BT.601 로 변환
+    int dx = 0;
+    if (simd_ && identity_x_) {
+        dx = yuyv_to_rgb_identity(row, r, g, b, n);
+    } else if (simd_) {
+        // 탭은 스칼라로 모아 Y/U/V 평면에 두고 변환만 SIMD 로 한다
+        for (; dx < n; dx++) {
+            const int x0 = x0_[dx], x1 = x1_[dx], w = xw_[dx];
+            const std::uint8_t *c0 = row + (x0 >> 1) * 4;
+            const std::uint8_t *c1 = row + (x1 >> 1) * 4;
+
+            r[dx] = lerp(row[x0 * 2], row[x1 * 2], w);
+            g[dx] = lerp(c0[1], c1[1], w);
+            b[dx] = lerp(c0[3], c1[3], w);
+        }
+        yuv_planes_to_rgb(r, g, b, n);
+        return;
+    }
+    for (; dx < n; dx++) {
+        const int x0 = x0_[dx], x1 = x1_[dx], w = xw_[dx];
+        const std::uint8_t *c0 = row + (x0 >> 1) * 4;
+        const std::uint8_t *c1 = row + (x1 >> 1) * 4;
+
+        yuv_to_rgb(lerp(row[x0 * 2], row[x1 * 2], w) - 16, lerp(c0[1], c1[1], w) - 128,
+                   lerp(c0[3], c1[3], w) - 128, r[dx], g[dx], b[dx]);
+    }
+}
+
+template <typename T>
+void Preprocessor::run_rows(const std::uint8_t *src, std::size_t stride, T *dst)
+{
+    const int in_w = lb_.input_w, in_h = lb_.input_h;
+    const int rw = lb_.resized_w, rh = lb_.resized_h;
+    const int left = lb_.pad_left, right = in_w - rw - left;
+    const std::size_t plane = std::size_t(in_w) * in_h;
+    const std::size_t row_bytes = blend_.size();
+    const T pad = pad_value(dst);
+
+    for (int y = 0; y < in_h; y++) {
+        const int sy = y - lb_.pad_top;
+
+        if (sy < 0 || sy >= rh) {
+            for (int c = 0; c < 3; c++)
+                std::fill_n(dst + c * plane + std::size_t(y) * in_w, in_w, pad);
+            continue;
+        }
+
+        // 가중치가 0 이면 원본 행을 그대로 쓴다 (정수 배율일 때 세로 보간이 없다)
+        const std::uint8_t *row = src + std::size_t(y0_[sy]) * stride;
+        if (yw_[sy]) {
+            blend_rows(row, src + std::size_t(y1_[sy]) * stride, yw_[sy], blend_.data(), row_bytes, simd_);
+            row = blend_.data();
+        }
+        gather_row(row);
+
+        for (int c = 0; c < 3; c++) {
+            T *out = dst + c * plane + std::size_t(y) * in_w;
+            std::fill_n(out, left, pad);
+            widen(planes_.data() + std::size_t(c) * rw, out + left, rw, 1.0f / 255.0f, simd_);
+            std::fill_n(out + left + rw, right, pad);
+        }
+    }
+}
+
+void Preprocessor::run(const std::uint8_t *src, std::size_t stride, float *dst)
+{
+    run_rows(src, stride, dst);
+}
+
+void Preprocessor::run(const std::uint8_t *src, std::size_t stride, std::int8_t *dst)
+{
+    run_rows(src, stride, dst);
+}
+
+} // namespace finger
@@ -0,0 +1,95 @@
+/*
+ * Fused YOLO input preprocessing
+ *
+ * One call goes from a camera frame (BGR24 or YUYV 4:2:2) straight into the
+ * network's [3, H, W] RGB input tensor: aspect-preserving bilinear resize,
+ * grey (114) letterbox border, colour conversion, BGR->RGB, scaling and
+ * HWC->CHW all happen row by row, so every source row is read once and the
+ * only intermediates are a few rows that stay in L1. It replaces
+ * cv::resize + cv::copyMakeBorder + cv::dnn::blobFromImage, which allocate
+ * and walk the full frame three times.
+ *
+ * Per output row the two source rows are blended vertically (SIMD), the
+ * horizontal taps are gathered into planar R/G/B bytes, and the planes are
+ * widened into the tensor (SIMD). When the width is not scaled (640x480 ->
+ * 640x640) the gather is a SIMD deinterleave, for YUYV fused with the
+ * BT.601 conversion; otherwise the taps are gathered in scalar code (the
+ * gather does not vectorise) and only the YUYV conversion is SIMD. The
+ * SIMD conversion is exact, it gives the same bytes as the scalar one.
+ * NEON, AVX2 and SSE2 paths are chosen at compile time with a scalar
+ * fallback; set_simd(false) forces the scalar code for comparison.
+ *
+ * Weights are 8-bit fixed point, so results may differ from cv::resize by
+ * one grey level.
+ */
+#ifndef FINGER_DETECT_PREPROCESS_HPP
+#define FINGER_DETECT_PREPROCESS_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "yolo.hpp"
+
+namespace finger {
+
+enum class PixelFormat {
+    Bgr,  // 3 바이트/픽셀, OpenCV 기본
+    Yuyv, // Y0 U Y1 V, 2 바이트/픽셀, V4L2 카메라 기본 (BT.601 limited range)
+};
+
+// 복사 없이 넘기는 프레임 (cv::Mat, 캡처 버퍼, 파일 매핑 어디든 가리킬 수 있다)
+struct ImageView {
+    const std::uint8_t *data = nullptr;
+    int width = 0, height = 0;
+    std::size_t stride = 0; // 한 행의 바이트 수
+    PixelFormat format = PixelFormat::Bgr;
+};
+
+inline int bytes_per_pixel(PixelFormat format)
+{
+    return format == PixelFormat::Yuyv ? 2 : 3;
+}
+
+class Preprocessor {
+public:
+    // 입력 크기/형식과 네트워크 입력 크기 조합마다 한 번 만든다 (좌표표를 미리 계산)
+    Preprocessor(int image_w, int image_h, PixelFormat format, int input_w, int input_h);
+
+    const Letterbox &letterbox() const { return lb_; }
+    PixelFormat format() const { return format_; }
+    bool matches(int image_w, int image_h, PixelFormat format, int input_w, int input_h) const;
+
+    // float 텐서: RGB / 255, 여백 114 / 255
+    void run(const std::uint8_t *src, std::size_t stride, float *dst);
+
+    // int8 텐서: 픽셀 - 128 (scale 1/255, zero point -128 로 양자화된 입력과 같다)
+    void run(const std::uint8_t *src, std::size_t stride, std::int8_t *dst);
+
+    void set_simd(bool on) { simd_ = on; }
+    static const char *simd_name();
+
+private:
+    template <typename T>
+    void run_rows(const std::uint8_t *src, std::size_t stride, T *dst);
+    void gather_row(const std::uint8_t *row);
+
+    Letterbox lb_;
+    PixelFormat format_;
+    bool simd_ = true;
+
+    // 출력 열 dx (여백 제외) 의 원본 두 탭 위치와 오른쪽 탭 가중치 (0..255)
+    std::vector<int> x0_, x1_;
+    std::vector<std::uint8_t> xw_;
+    bool identity_x_ = false;
+    // 출력 행 sy 의 원본 두 행과 아래 행 가중치
+    std::vector<int> y0_, y1_;
+    std::vector<std::uint8_t> yw_;
+
+    std::vector<std::uint8_t> blend_;  // 세로 보간한 원본 한 행
+    std::vector<std::uint8_t> planes_; // R, G, B 평면 한 행씩 (resized_w * 3)
+};
+
+} // namespace finger
+
+#endif // FINGER_DETECT_PREPROCESS_HPP
@@ -0,0 +1,124 @@
+/* Fused preprocessing microbenchmark
+File : preprocess_bench.cpp
+
+Usage: preprocess_bench [iterations]
+
+Times Preprocessor::run() for a 640x480 camera frame into 640x640 and
+320x320 network inputs, SIMD against the scalar path, for BGR and YUYV
+input and float / int8 output. When built with OpenCV (make bench finds
+opencv4 through pkg-config) the same BGR conversion is also timed with
+cv::resize + cv::copyMakeBorder + cv::dnn::blobFromImage, the calls the
+Detector used before, and the largest difference against it is printed. */
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <type_traits>
+#include <vector>
+
+#include "preprocess.hpp"
+
+#ifdef PREPROCESS_BENCH_OPENCV
+#include <opencv2/dnn.hpp>
+#include <opencv2/imgproc.hpp>
+#endif
+
+using finger::PixelFormat;
+using finger::Preprocessor;
+
+template <typename Op>
+static double bench(long iterations, Op op)
+{
+	using clock = std::chrono::steady_clock;
+
+	op();
+	auto start = clock::now();
+	for (long i = 0; i < iterations; i++)
+		op();
+	auto end = clock::now();
+
+	return std::chrono::duration<double, std::micro>(end - start).count() / iterations;
+}
+
+template <typename T>
+static float max_diff(const std::vector<T> &a, const std::vector<T> &b)
+{
+	float diff = 0;
+
+	for (std::size_t i = 0; i < a.size(); i++)
+		diff = std::max(diff, std::fabs(float(a[i]) - float(b[i])));
+	return diff;
+}
+
+template <typename T>
+static void run_case(const char *name, const std::vector<uint8_t> &frame, PixelFormat format,
+		     int width, int height, int input, long iterations)
+{
+	const std::size_t stride = std::size_t(width) * (format == PixelFormat::Yuyv ? 2 : 3);
+	Preprocessor pre(width, height, format, input, input);
+	std::vector<T> simd(3 * std::size_t(input) * input);
+	std::vector<T> scalar(simd.size());
+
+	double us_simd = bench(iterations, [&] { pre.run(frame.data(), stride, simd.data()); });
+	pre.set_simd(false);
+	double us_scalar = bench(iterations, [&] { pre.run(frame.data(), stride, scalar.data()); });
+
+	printf("%-28s %8.1f us %s %8.1f us scalar  x%.2f  diff=%g\n", name, us_simd,
+	       Preprocessor::simd_name(), us_scalar, us_scalar / us_simd, max_diff(simd, scalar));
+
+#ifdef PREPROCESS_BENCH_OPENCV
+	// OpenCV 비교는 BGR -> float 만 한다
+	if constexpr (std::is_same_v<T, float>) {
+		if (format != PixelFormat::Bgr)
+			return;
+
+		// Detector 가 예전에 하던 세 번의 호출
+		cv::Mat image(height, width, CV_8UC3, const_cast<uint8_t *>(frame.data()));
+		cv::Mat resized, padded, blob;
+		const finger::Letterbox &lb = pre.letterbox();
+		double us_cv = bench(iterations, [&] {
+			cv::resize(image, resized, cv::Size(lb.resized_w, lb.resized_h), 0, 0, cv::INTER_LINEAR);
+			cv::copyMakeBorder(resized, padded, lb.pad_top, input - lb.resized_h - lb.pad_top,
+					   lb.pad_left, input - lb.resized_w - lb.pad_left,
+					   cv::BORDER_CONSTANT, cv::Scalar(114, 114, 114));
+			cv::dnn::blobFromImage(padded, blob, 1.0 / 255.0, cv::Size(), cv::Scalar(), true, false, CV_32F);
+		});
+		std::vector<float> reference(blob.ptr<float>(), blob.ptr<float>() + simd.size());
+		printf("%-28s %8.1f us opencv  fused x%.2f  diff=%g\n", "  opencv resize+border+blob",
+		       us_cv, us_cv / us_simd, max_diff(simd, reference));
+	}
+#endif
+}
+
+int main(int argc, char **argv)
+{
+	const int width = 640, height = 480;
+	long iterations = argc > 1 ? atol(argv[1]) : 200;
+
+	if (iterations <= 0) {
+		printf("Usage: %s [iterations]\n", argv[0]);
+		return -1;
+	}
+
+	// 평평한 화면은 보간이 너무 쉬우므로 잡음 섞인 그라디언트를 쓴다
+	std::vector<uint8_t> bgr(std::size_t(width) * height * 3);
+	std::vector<uint8_t> yuyv(std::size_t(width) * height * 2);
+	srand(1);
+	for (std::size_t i = 0; i < bgr.size(); i++)
+		bgr[i] = uint8_t((i / 3 % width) / 3 + (i / 3 / width) / 3 + rand() % 32);
+	for (std::size_t i = 0; i < yuyv.size(); i++)
+		yuyv[i] = uint8_t(i & 1 ? 96 + rand() % 64 : 16 + (i / 2 % width) / 3 + rand() % 32);
+
+	printf("frame %dx%d iterations=%ld simd=%s\n", width, height, iterations, Preprocessor::simd_name());
+
+	run_case<float>("bgr  -> f32 640x640", bgr, PixelFormat::Bgr, width, height, 640, iterations);
+	run_case<float>("bgr  -> f32 320x320", bgr, PixelFormat::Bgr, width, height, 320, iterations);
+	run_case<int8_t>("bgr  -> i8  640x640", bgr, PixelFormat::Bgr, width, height, 640, iterations);
+	run_case<int8_t>("bgr  -> i8  320x320", bgr, PixelFormat::Bgr, width, height, 320, iterations);
+	run_case<float>("yuyv -> f32 640x640", yuyv, PixelFormat::Yuyv, width, height, 640, iterations);
+	run_case<float>("yuyv -> f32 320x320", yuyv, PixelFormat::Yuyv, width, height, 320, iterations);
+
+	return 0;
+}
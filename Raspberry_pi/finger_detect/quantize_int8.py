@@ -0,0 +1,233 @@
+"""best_fixed.onnx -> INT8 정적 양자화 + 정확도 비교
+
+사용법:
+    python3 quantize_int8.py --calib calib_images/ [--eval eval_images/] \
+        [--labels eval_labels/] [--model best_fixed.onnx] \
+        [--output best_fixed.int8.onnx] [--report report.json]
+
+- --calib  : 보정(calibration)에 쓸 이미지 폴더, 실제 카메라 프레임 100~300 장 권장
+- --eval   : 비교에 쓸 이미지 폴더 (없으면 --calib 폴더로 비교)
+- --labels : YOLO 라벨 폴더 (<이미지 이름>.txt 의 첫 줄 첫 값 = 클래스),
+             없으면 FP32 모델의 결과를 정답으로 보고 INT8 과의 일치율만 보고한다
+
+전처리는 finger_detect 와 같다 (비율 유지 리사이즈, 114 여백, BGR->RGB, /255).
+양자화 형식은 QDQ (활성값 uint8, 가중치 int8 채널별) 로, OpenCV DNN 과
+onnxruntime 모두 읽을 수 있다. 마지막 검출 헤드(DFL, 박스 디코딩)는 좌표
+오차가 커지므로 기본으로 FP32 로 남긴다 (--quantize-head 로 포함).
+
+finger_detect 는 --precision int8 (또는 auto) 로 이 모델을 선택한다.
+"""
+import argparse
+import glob
+import json
+import os
+import re
+import time
+
+import cv2
+import numpy as np
+import onnx
+import onnxruntime as ort
+from onnxruntime.quantization import (CalibrationDataReader, CalibrationMethod,
+                                      QuantFormat, QuantType, quantize_static)
+from onnxruntime.quantization.shape_inference import quant_pre_process
+
+CLASS_NAMES = ['dev1', 'dev2', 'dev3', 'dev4', 'off']
+IMAGE_EXTS = ('.jpg', '.jpeg', '.png', '.bmp')
+
+
+def list_images(folder):
+    return sorted(p for p in glob.glob(os.path.join(folder, '*'))
+                  if p.lower().endswith(IMAGE_EXTS))
+
+
+def letterbox(image, size):
+    # yolo.cpp make_letterbox() 와 같은 계산
+    h, w = image.shape[:2]
+    scale = min(size / w, size / h)
+    rw, rh = int(round(w * scale)), int(round(h * scale))
+    left = int(round((size - rw) / 2 - 0.1))
+    top = int(round((size - rh) / 2 - 0.1))
+    resized = cv2.resize(image, (rw, rh), interpolation=cv2.INTER_LINEAR)
+    padded = cv2.copyMakeBorder(resized, top, size - rh - top, left, size - rw - left,
+                                cv2.BORDER_CONSTANT, value=(114, 114, 114))
+    rgb = cv2.cvtColor(padded, cv2.COLOR_BGR2RGB)
+    return np.ascontiguousarray(rgb.transpose(2, 0, 1)[None], dtype=np.float32) / 255.0
+
+
+def input_info(model_path):
+    model = onnx.load(model_path, load_external_data=False)
+    inp = model.graph.input[0]
+    dims = [d.dim_value for d in inp.type.tensor_type.shape.dim]
+    size = dims[2] if len(dims) == 4 and dims[2] > 0 else 640
+    return inp.name, size
+
+
+class FrameReader(CalibrationDataReader):
+    def __init__(self, images, input_name, size):
+        self.images = images
+        self.input_name = input_name
+        self.size = size
+        self.index = 0
+
+    def get_next(self):
+        while self.index < len(self.images):
+            image = cv2.imread(self.images[self.index])
+            self.index += 1
+            if image is not None:
+                return {self.input_name: letterbox(image, self.size)}
+        return None
+
+    def rewind(self):
+        self.index = 0
+
+
+def head_nodes(model_path):
+    # ultralytics export 의 노드 이름은 /model.<번호>/... 이고 가장 큰 번호가 Detect 헤드다
+    model = onnx.load(model_path, load_external_data=False)
+
+    def index(node):
+        m = re.match(r'/model\.(\d+)/', node.name)
+        return int(m.group(1)) if m else -1
+
+    last = max(index(n) for n in model.graph.node)
+    return [n.name for n in model.graph.node if index(n) == last] if last >= 0 else []
+
+
+def top1(output, conf):
+    # 출력 [1, 4+nc, N] (또는 전치): 가장 점수가 높은 박스의 클래스, 없으면 -1
+    out = output[0]
+    nc = len(CLASS_NAMES)
+    if out.shape[0] != 4 + nc:
+        out = out.T
+    scores = out[4:4 + nc]
+    best = np.unravel_index(np.argmax(scores), scores.shape)
+    return int(best[0]) if scores[best] >= conf else -1
+
+
+def evaluate(model_path, images, size, conf, threads):
+    options = ort.SessionOptions()
+    options.intra_op_num_threads = threads
+    session = ort.InferenceSession(model_path, options, providers=['CPUExecutionProvider'])
+    name = session.get_inputs()[0].name
+    preds, times = [], []
+    for path in images:
+        image = cv2.imread(path)
+        if image is None:
+            preds.append(-1)
+            continue
+        blob = letterbox(image, size)
+        t0 = time.perf_counter()
+        output = session.run(None, {name: blob})[0]
+        times.append((time.perf_counter() - t0) * 1000.0)
+        preds.append(top1(output, conf))
+    return preds, times
+
+
+def read_labels(folder, images):
+    labels = []
+    for path in images:
+        txt = os.path.join(folder, os.path.splitext(os.path.basename(path))[0] + '.txt')
+        try:
+            with open(txt) as f:
+                first = f.readline().split()
+            labels.append(int(first[0]) if first else -1)
+        except OSError:
+            labels.append(None)
+    return labels
+
+
+def accuracy(preds, truth):
+    pairs = [(p, t) for p, t in zip(preds, truth) if t is not None]
+    total = {'n': len(pairs), 'acc': sum(p == t for p, t in pairs) / len(pairs) if pairs else 0.0}
+    per_class = {}
+    for c, name in enumerate(CLASS_NAMES + ['none']):
+        cls = c if c < len(CLASS_NAMES) else -1
+        sel = [(p, t) for p, t in pairs if t == cls]
+        if sel:
+            per_class[name] = {'n': len(sel), 'acc': sum(p == t for p, t in sel) / len(sel)}
+    total['per_class'] = per_class
+    return total
+
+
+def latency(times):
+    if not times:
+        return {}
+    t = np.array(times)
+    return {'mean_ms': float(t.mean()), 'p50_ms': float(np.percentile(t, 50)),
+            'p99_ms': float(np.percentile(t, 99))}
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Static INT8 quantization for best_fixed.onnx')
+    parser.add_argument('--model', default='best_fixed.onnx')
+    parser.add_argument('--output', default=None, help='default: <model>.int8.onnx')
+    parser.add_argument('--calib', required=True, help='calibration image directory')
+    parser.add_argument('--eval', default=None, help='evaluation image directory')
+    parser.add_argument('--labels', default=None, help='YOLO label directory for --eval')
+    parser.add_argument('--max-calib', type=int, default=300)
+    parser.add_argument('--method', choices=['minmax', 'entropy', 'percentile'], default='minmax')
+    parser.add_argument('--quantize-head', action='store_true')
+    parser.add_argument('--conf', type=float, default=0.5)
+    parser.add_argument('--threads', type=int, default=4)
+    parser.add_argument('--report', default=None, help='write the comparison as JSON')
+    args = parser.parse_args()
+
+    output = args.output or os.path.splitext(args.model)[0] + '.int8.onnx'
+    input_name, size = input_info(args.model)
+
+    calib = list_images(args.calib)[:args.max_calib]
+    if not calib:
+        raise SystemExit('no calibration images in ' + args.calib)
+
+    # 양자화 전에 shape inference / 상수 접기를 해 두어야 QDQ 배치가 안정적이다
+    prepared = output + '.prep.onnx'
+    quant_pre_process(args.model, prepared)
+
+    method = {'minmax': CalibrationMethod.MinMax, 'entropy': CalibrationMethod.Entropy,
+              'percentile': CalibrationMethod.Percentile}[args.method]
+    exclude = [] if args.quantize_head else head_nodes(prepared)
+    quantize_static(prepared, output, FrameReader(calib, input_name, size),
+                    quant_format=QuantFormat.QDQ, per_channel=True,
+                    activation_type=QuantType.QUInt8, weight_type=QuantType.QInt8,
+                    calibrate_method=method, nodes_to_exclude=exclude)
+    os.remove(prepared)
+    print(f'calibrated on {len(calib)} images, {len(exclude)} head nodes kept in FP32')
+    print(f'wrote {output}')
+
+    images = list_images(args.eval or args.calib)
+    fp32, fp32_ms = evaluate(args.model, images, size, args.conf, args.threads)
+    int8, int8_ms = evaluate(output, images, size, args.conf, args.threads)
+
+    report = {
+        'images': len(images),
+        'fp32': {'model': args.model, 'bytes': os.path.getsize(args.model), **latency(fp32_ms)},
+        'int8': {'model': output, 'bytes': os.path.getsize(output), **latency(int8_ms)},
+        # 라벨이 없어도 FP32 대비 top-1 일치율로 양자화 손실을 본다
+        'agreement': accuracy(int8, fp32),
+    }
+    if args.labels:
+        truth = read_labels(args.labels, images)
+        report['fp32']['accuracy'] = accuracy(fp32, truth)
+        report['int8']['accuracy'] = accuracy(int8, truth)
+    if fp32_ms and int8_ms:
+        report['speedup'] = float(np.mean(fp32_ms) / np.mean(int8_ms))
+
+    for key in ('fp32', 'int8'):
+        r = report[key]
+        line = f"{key}: {r['bytes'] / 1e6:.1f} MB mean={r.get('mean_ms', 0):.1f} ms p99={r.get('p99_ms', 0):.1f} ms"
+        if 'accuracy' in r:
+            line += f" acc={r['accuracy']['acc'] * 100:.1f}% (n={r['accuracy']['n']})"
+        print(line)
+    print(f"int8 vs fp32 top-1 agreement={report['agreement']['acc'] * 100:.1f}%"
+          f" speedup={report.get('speedup', 0):.2f}x")
+    for name, r in report['agreement']['per_class'].items():
+        print(f"  {name:5s} n={r['n']:4d} agreement={r['acc'] * 100:.1f}%")
+
+    if args.report:
+        with open(args.report, 'w') as f:
+            json.dump(report, f, indent=2)
+
+
+if __name__ == '__main__':
+    main()
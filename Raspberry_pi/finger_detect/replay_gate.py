@@ -0,0 +1,74 @@
+"""finger_detect --json 재생 결과를 기준(baseline)과 비교하는 회귀 검사
+
+사용법:
+    python3 replay_gate.py baseline.json replay.json [--fps-drop 0.10] \
+        [--latency-rise 0.20] [--accuracy-drop 0.01] [--switch-rise 0] \
+        [--bus-rise 0.05]
+
+- fps              : 기준보다 --fps-drop 비율 넘게 낮아지면 실패
+- 단계별/전체 p99  : 기준보다 --latency-rise 비율 넘게 길어지면 실패
+                     (1 ms 미만의 차이는 측정 잡음으로 보고 무시한다)
+- decision 정확도  : 기준보다 --accuracy-drop 넘게 떨어지면 실패
+- device_switches  : 기준보다 --switch-rise 넘게 늘면 실패
+- 프레임당 버스 트랜잭션 : 기준보다 --bus-rise 비율 넘게 늘면 실패
+  (tx/s 는 fps 를 따라 움직이므로 프레임당 값으로 비교한다)
+
+하나라도 실패하면 종료 코드 1. 같은 기계, 같은 영상으로 만든 기준과 비교해야 한다.
+"""
+import argparse
+import json
+import sys
+
+LATENCY_SLACK_MS = 1.0
+
+
+def load(path):
+    with open(path) as f:
+        return json.load(f)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('baseline')
+    parser.add_argument('current')
+    parser.add_argument('--fps-drop', type=float, default=0.10)
+    parser.add_argument('--latency-rise', type=float, default=0.20)
+    parser.add_argument('--accuracy-drop', type=float, default=0.01)
+    parser.add_argument('--switch-rise', type=int, default=0)
+    parser.add_argument('--bus-rise', type=float, default=0.05)
+    args = parser.parse_args()
+
+    base = load(args.baseline)
+    cur = load(args.current)
+    checks = []  # (이름, 기준, 현재, 통과)
+
+    checks.append(('fps', base['fps'], cur['fps'], cur['fps'] >= base['fps'] * (1 - args.fps_drop)))
+
+    latencies = [(f'{name} p99 ms', base['stages_ms'][name]['p99'], stage['p99'])
+                 for name, stage in cur['stages_ms'].items()
+                 if name in base['stages_ms'] and base['stages_ms'][name]['n'] and stage['n']]
+    latencies.append(('capture->decision p99 ms', base['latency_ms']['capture_to_decision']['p99'],
+                      cur['latency_ms']['capture_to_decision']['p99']))
+    for name, b, c in latencies:
+        checks.append((name, b, c, c <= b * (1 + args.latency_rise) or c - b < LATENCY_SLACK_MS))
+
+    if base.get('accuracy') and cur.get('accuracy'):
+        b, c = base['accuracy']['decision'], cur['accuracy']['decision']
+        checks.append(('decision accuracy', b, c, c >= b - args.accuracy_drop))
+
+    b, c = base['device_switches'], cur['device_switches']
+    checks.append(('device_switches', b, c, c <= b + args.switch_rise))
+
+    b, c = base['bus']['tx_per_frame'], cur['bus']['tx_per_frame']
+    checks.append(('bus tx per frame', b, c, c <= b * (1 + args.bus_rise)))
+
+    failed = 0
+    for name, b, c, ok in checks:
+        print(f'{"ok  " if ok else "FAIL"} {name:28s} {b:12.4f} -> {c:12.4f}')
+        failed += not ok
+    print(f'{len(checks) - failed}/{len(checks)} checks passed')
+    sys.exit(1 if failed else 0)
+
+
+if __name__ == '__main__':
+    main()
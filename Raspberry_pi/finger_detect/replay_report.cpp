@@ -0,0 +1,183 @@
+/*
+ * Offline replay scoring and the machine readable replay report
+ */
+#include "replay_report.hpp"
+
+#include <cerrno>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+
+namespace finger {
+
+namespace {
+
+constexpr unsigned long kMaxFrames = 10000000; // 잘못 쓴 범위로 메모리를 다 먹지 않게
+
+int find_class(const std::string &token, const std::vector<std::string> &names)
+{
+    for (std::size_t i = 0; i < names.size(); i++)
+        if (names[i] == token)
+            return int(i);
+
+    char *end;
+    long cls = std::strtol(token.c_str(), &end, 10);
+    if (!token.empty() && *end == '\0' && cls >= 0 && std::size_t(cls) < names.size())
+        return int(cls);
+    return -1;
+}
+
+void write_string(FILE *out, const std::string &s)
+{
+    fputc('"', out);
+    for (unsigned char c : s) {
+        if (c == '"' || c == '\\')
+            fprintf(out, "\\%c", c);
+        else if (c < 0x20)
+            fprintf(out, "\\u%04x", c);
+        else
+            fputc(c, out);
+    }
+    fputc('"', out);
+}
+
+void write_latency(FILE *out, const LatencyStats &ms)
+{
+    fprintf(out, "{\"n\": %zu, \"mean\": %.4f, \"p50\": %.4f, \"p99\": %.4f, \"max\": %.4f}",
+            ms.count(), ms.mean(), ms.percentile(50), ms.percentile(99), ms.max());
+}
+
+} // namespace
+
+int GroundTruth::load(const std::string &path, const std::vector<std::string> &names)
+{
+    std::ifstream in(path);
+    if (!in)
+        return -ENOENT;
+
+    labels_.clear();
+    labeled_ = 0;
+    error_line_ = 0;
+
+    std::string line;
+    for (int lineno = 1; std::getline(in, line); lineno++) {
+        std::string::size_type hash = line.find('#');
+        if (hash != std::string::npos)
+            line.erase(hash);
+
+        std::istringstream ss(line);
+        std::string range, name;
+        if (!(ss >> range))
+            continue;
+
+        unsigned long first = 0, last = 0;
+        int cls = -1;
+        if (ss >> name)
+            cls = find_class(name, names);
+        int n = std::sscanf(range.c_str(), "%lu-%lu", &first, &last);
+        if (n == 1)
+            last = first;
+        if (n < 1 || cls < 0 || first == 0 || last < first || last > kMaxFrames) {
+            error_line_ = lineno;
+            return -EINVAL;
+        }
+
+        if (labels_.size() <= last)
+            labels_.resize(last + 1, -1);
+        for (unsigned long f = first; f <= last; f++) {
+            labeled_ += labels_[f] < 0;
+            labels_[f] = cls;
+        }
+    }
+    return 0;
+}
+
+ReplayScore::ReplayScore(const GroundTruth &truth, int num_classes)
+    : truth_(truth), class_labeled_(num_classes, 0), class_correct_(num_classes, 0)
+{
+}
+
+void ReplayScore::add(unsigned long frame_id, int cls, int raw_cls)
+{
+    int expected = truth_.label(frame_id);
+    if (expected < 0)
+        return;
+
+    labeled_++;
+    class_labeled_[expected]++;
+    if (cls < 0)
+        undecided_++;
+    if (cls == expected) {
+        correct_++;
+        class_correct_[expected]++;
+    }
+    raw_correct_ += raw_cls == expected;
+}
+
+int write_replay_json(const std::string &path, const ReplayRun &run)
+{
+    FILE *out = fopen(path.c_str(), "w");
+    if (!out)
+        return -errno;
+
+    double fps = run.wall_s > 0 ? run.frames / run.wall_s : 0.0;
+    double infer_fps = run.wall_s > 0 ? run.inferred / run.wall_s : 0.0;
+    std::uint64_t bus = run.bus_writes + run.bus_reads;
+
+    fprintf(out, "{\n  \"source\": ");
+    write_string(out, run.source);
+    fprintf(out, ",\n  \"model\": ");
+    write_string(out, run.model);
+    fprintf(out, ",\n  \"precision\": ");
+    write_string(out, run.precision);
+    fprintf(out, ",\n  \"backend\": ");
+    write_string(out, run.backend);
+    fprintf(out, ",\n  \"frames\": %lu,\n  \"inferred\": %lu,\n  \"wall_s\": %.4f,\n", run.frames, run.inferred,
+            run.wall_s);
+    fprintf(out, "  \"fps\": %.3f,\n  \"infer_fps\": %.3f,\n", fps, infer_fps);
+
+    fprintf(out, "  \"stages_ms\": {");
+    for (std::size_t i = 0; i < run.stages.size(); i++) {
+        fprintf(out, "%s\n    \"%s\": ", i ? "," : "", run.stages[i].first);
+        write_latency(out, *run.stages[i].second);
+    }
+    fprintf(out, "\n  },\n  \"latency_ms\": {\n    \"capture_to_decision\": ");
+    write_latency(out, *run.decide_latency);
+    fprintf(out, ",\n    \"capture_to_actuation\": ");
+    write_latency(out, *run.actuate_latency);
+    fprintf(out, "\n  },\n");
+
+    fprintf(out, "  \"decision_changes\": %lu,\n  \"actuations\": %lu,\n  \"device_switches\": %lu,\n",
+            run.decision_changes, run.actuations, run.device_switches);
+    fprintf(out, "  \"bus\": {\"writes\": %llu, \"reads\": %llu, \"skipped_writes\": %llu, "
+                 "\"tx_per_s\": %.1f, \"tx_per_frame\": %.3f},\n",
+            (unsigned long long)run.bus_writes, (unsigned long long)run.bus_reads,
+            (unsigned long long)run.skipped_writes, run.wall_s > 0 ? bus / run.wall_s : 0.0,
+            run.frames ? double(bus) / run.frames : 0.0);
+
+    // 라벨이 없으면 정확도는 null
+    fprintf(out, "  \"accuracy\": ");
+    const ReplayScore *score = run.score;
+    if (!score) {
+        fprintf(out, "null\n}\n");
+    } else {
+        fprintf(out, "{\n    \"labeled\": %lu,\n    \"decision\": %.4f,\n    \"raw\": %.4f,\n"
+                     "    \"undecided\": %lu,\n    \"per_class\": {",
+                score->labeled(), score->accuracy(), score->raw_accuracy(), score->undecided());
+        bool first = true;
+        for (std::size_t c = 0; run.names && c < run.names->size(); c++) {
+            unsigned long n = score->class_labeled(int(c));
+            if (!n)
+                continue;
+            fprintf(out, "%s\n      ", first ? "" : ",");
+            write_string(out, (*run.names)[c]);
+            fprintf(out, ": {\"labeled\": %lu, \"decision\": %.4f}", n, double(score->class_correct(int(c))) / n);
+            first = false;
+        }
+        fprintf(out, "\n    }\n  }\n}\n");
+    }
+
+    return fclose(out) == 0 ? 0 : -errno;
+}
+
+} // namespace finger
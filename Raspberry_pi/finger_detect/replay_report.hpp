@@ -0,0 +1,111 @@
+/*
+ * Offline replay scoring and the machine readable replay report
+ *
+ * A recorded video or image directory is replayed through the whole
+ * pipeline (--no-drop, every frame in order) against the simulated FPGA
+ * bus. GroundTruth holds the expected class of each frame, ReplayScore
+ * compares it with the decisions the pipeline made, and write_replay_json()
+ * dumps throughput, per-stage latency, accuracy and bus traffic as one JSON
+ * object so replay_gate.py can compare a run against a stored baseline.
+ *
+ * Label file: one range per line, frame numbers start at 1 (the pipeline's
+ * frame id) and '#' starts a comment. Frames that are not listed are not
+ * scored.
+ *
+ *     1-45     dev1
+ *     46-120   2        # class index works too
+ *     121      off
+ *
+ * Errors follow libfpga: 0 or a negative errno.
+ */
+#ifndef FINGER_DETECT_REPLAY_REPORT_HPP
+#define FINGER_DETECT_REPLAY_REPORT_HPP
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "stats.hpp"
+
+namespace finger {
+
+class GroundTruth {
+public:
+    // 클래스는 이름이나 번호로 쓴다. 모르는 클래스나 잘못된 줄이 있으면 -EINVAL
+    int load(const std::string &path, const std::vector<std::string> &names);
+
+    // 프레임의 정답 클래스, 라벨이 없으면 -1
+    int label(unsigned long frame_id) const
+    {
+        return frame_id < labels_.size() ? labels_[frame_id] : -1;
+    }
+
+    bool empty() const { return labeled_ == 0; }
+    int error_line() const { return error_line_; }
+
+private:
+    std::vector<int> labels_; // [frame_id] (0 번은 쓰지 않는다)
+    unsigned long labeled_ = 0;
+    int error_line_ = 0;
+};
+
+class ReplayScore {
+public:
+    ReplayScore(const GroundTruth &truth, int num_classes);
+
+    /*
+     * Score one decision. 'cls' is the smoothed decision, 'raw_cls' the
+     * best box of that frame alone (-1 when none). Unlabeled frames are
+     * ignored.
+     */
+    void add(unsigned long frame_id, int cls, int raw_cls);
+
+    unsigned long labeled() const { return labeled_; }
+    unsigned long correct() const { return correct_; }
+    unsigned long raw_correct() const { return raw_correct_; }
+    unsigned long undecided() const { return undecided_; }
+    double accuracy() const { return labeled_ ? double(correct_) / labeled_ : 0.0; }
+    double raw_accuracy() const { return labeled_ ? double(raw_correct_) / labeled_ : 0.0; }
+
+    unsigned long class_labeled(int cls) const { return class_labeled_[cls]; }
+    unsigned long class_correct(int cls) const { return class_correct_[cls]; }
+
+private:
+    const GroundTruth &truth_;
+    std::vector<unsigned long> class_labeled_, class_correct_;
+    unsigned long labeled_ = 0, correct_ = 0, raw_correct_ = 0;
+    unsigned long undecided_ = 0; // 아직 결정이 없던 (-1) 라벨 프레임
+};
+
+struct ReplayRun {
+    std::string source;
+    std::string model;
+    std::string precision;
+    std::string backend;
+    const std::vector<std::string> *names = nullptr;
+
+    unsigned long frames = 0;
+    unsigned long inferred = 0;
+    double wall_s = 0.0;
+
+    std::vector<std::pair<const char *, const LatencyStats *>> stages;
+    const LatencyStats *decide_latency = nullptr;  // 캡처 -> 결정
+    const LatencyStats *actuate_latency = nullptr; // 캡처 -> 디바이스 쓰기
+
+    unsigned long decision_changes = 0;
+    unsigned long actuations = 0;
+    unsigned long device_switches = 0;
+    std::uint64_t bus_writes = 0;
+    std::uint64_t bus_reads = 0;
+    std::uint64_t skipped_writes = 0;
+
+    const ReplayScore *score = nullptr; // 라벨이 없으면 nullptr
+};
+
+int write_replay_json(const std::string &path, const ReplayRun &run);
+
+} // namespace finger
+
+#endif // FINGER_DETECT_REPLAY_REPORT_HPP
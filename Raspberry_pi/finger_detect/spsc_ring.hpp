@@ -0,0 +1,120 @@
+/*
+ * Lock-free single-producer / single-consumer ring of preallocated slots
+ *
+ * The producer fills the slot returned by write_slot() in place and then
+ * publishes it with push(); the consumer reads read_slot() in place and
+ * releases it with pop(). Slots are never moved or reallocated, so a slot
+ * holding a frame buffer keeps its memory across laps.
+ */
+#ifndef FINGER_DETECT_SPSC_RING_HPP
+#define FINGER_DETECT_SPSC_RING_HPP
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+
+namespace finger {
+
+template <typename T, std::size_t N>
+class SpscRing {
+    static_assert(N >= 2 && (N & (N - 1)) == 0, "ring size must be a power of two");
+
+public:
+    // 생산자: 비어 있는 슬롯, 가득 찼으면 nullptr
+    T *write_slot()
+    {
+        std::size_t head = head_.load(std::memory_order_relaxed);
+        if (head - tail_.load(std::memory_order_acquire) == N)
+            return nullptr;
+        return &slots_[head & (N - 1)];
+    }
+
+    void push() { head_.store(head_.load(std::memory_order_relaxed) + 1, std::memory_order_release); }
+
+    // 소비자: 가장 오래된 슬롯, 비었으면 nullptr
+    T *read_slot()
+    {
+        std::size_t tail = tail_.load(std::memory_order_relaxed);
+        if (tail == head_.load(std::memory_order_acquire))
+            return nullptr;
+        return &slots_[tail & (N - 1)];
+    }
+
+    void pop() { tail_.store(tail_.load(std::memory_order_relaxed) + 1, std::memory_order_release); }
+
+    /*
+     * Consumer side: release every queued slot except the newest one and
+     * return how many were dropped.
+     */
+    std::size_t drop_stale()
+    {
+        std::size_t tail = tail_.load(std::memory_order_relaxed);
+        std::size_t head = head_.load(std::memory_order_acquire);
+
+        if (head - tail <= 1)
+            return 0;
+        tail_.store(head - 1, std::memory_order_release);
+        return head - 1 - tail;
+    }
+
+    // 버리는 슬롯마다 release(slot) 을 먼저 부른다 (캡처 버퍼를 돌려줄 때)
+    template <typename Release>
+    std::size_t drop_stale(Release &&release)
+    {
+        std::size_t tail = tail_.load(std::memory_order_relaxed);
+        std::size_t head = head_.load(std::memory_order_acquire);
+
+        if (head - tail <= 1)
+            return 0;
+        for (std::size_t i = tail; i != head - 1; i++)
+            release(slots_[i & (N - 1)]);
+        tail_.store(head - 1, std::memory_order_release);
+        return head - 1 - tail;
+    }
+
+    std::size_t size() const
+    {
+        return head_.load(std::memory_order_acquire) - tail_.load(std::memory_order_acquire);
+    }
+    bool empty() const { return size() == 0; }
+    static constexpr std::size_t capacity() { return N; }
+
+    // 슬롯 버퍼를 미리 준비할 때만 사용 (스레드 시작 전)
+    std::array<T, N> &slots() { return slots_; }
+
+private:
+    alignas(64) std::atomic<std::size_t> head_{0};
+    alignas(64) std::atomic<std::size_t> tail_{0};
+    alignas(64) std::array<T, N> slots_{};
+};
+
+/*
+ * Sleep/wake helper for the consumer of a ring. The data path stays
+ * lock-free; the mutex is only taken to park an idle thread.
+ */
+class Doorbell {
+public:
+    void ring()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        cv_.notify_one();
+    }
+
+    template <typename Pred>
+    void wait(Pred ready, std::chrono::milliseconds timeout)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        cv_.wait_for(lock, timeout, ready);
+    }
+
+private:
+    std::mutex mutex_;
+    std::condition_variable cv_;
+};
+
+} // namespace finger
+
+#endif // FINGER_DETECT_SPSC_RING_HPP
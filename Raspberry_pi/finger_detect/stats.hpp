@@ -0,0 +1,77 @@
+/*
+ * Latency and utilization bookkeeping for finger_detect
+ */
+#ifndef FINGER_DETECT_STATS_HPP
+#define FINGER_DETECT_STATS_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <vector>
+
+namespace finger {
+
+using Clock = std::chrono::steady_clock;
+
+inline double ms_between(Clock::time_point from, Clock::time_point to)
+{
+    return std::chrono::duration<double, std::milli>(to - from).count();
+}
+
+/* 지연 시간 샘플(ms) 모음. 용량은 미리 잡아 두고 넘치면 더 기록하지 않는다 */
+class LatencyStats {
+public:
+    explicit LatencyStats(std::size_t capacity = 1 << 16) { samples_.reserve(capacity); }
+
+    void add(double ms)
+    {
+        count_++;
+        max_ = std::max(max_, ms);
+        sum_ += ms;
+        if (samples_.size() < samples_.capacity())
+            samples_.push_back(ms);
+    }
+
+    std::size_t count() const { return count_; }
+    double mean() const { return count_ ? sum_ / count_ : 0.0; }
+    double max() const { return max_; }
+
+    // p 는 0~100. 기록된 샘플에서 nearest-rank 로 계산한다
+    double percentile(double p) const
+    {
+        if (samples_.empty())
+            return 0.0;
+
+        std::vector<double> sorted(samples_);
+        std::size_t rank = std::size_t(p / 100.0 * (sorted.size() - 1) + 0.5);
+        std::nth_element(sorted.begin(), sorted.begin() + rank, sorted.end());
+        return sorted[rank];
+    }
+
+private:
+    std::vector<double> samples_;
+    std::size_t count_ = 0;
+    double sum_ = 0.0;
+    double max_ = 0.0;
+};
+
+/* 한 스테이지가 실제로 일한 시간의 합. 벽시계 시간으로 나누면 사용률 */
+struct StageTimer {
+    Clock::duration busy{};
+    unsigned long items = 0;
+
+    void add(Clock::time_point start, Clock::time_point end)
+    {
+        busy += end - start;
+        items++;
+    }
+
+    double utilization(Clock::duration wall) const
+    {
+        return wall.count() > 0 ? double(busy.count()) / double(wall.count()) : 0.0;
+    }
+};
+
+} // namespace finger
+
+#endif // FINGER_DETECT_STATS_HPP
@@ -0,0 +1,37 @@
+#!/bin/bash
+# 카메라 프레임 -> FPGA 레지스터 write 종단 지연 추적
+#
+# 사용법: sudo ./trace_latency.sh [finger_detect 옵션...]
+#   예) sudo ./trace_latency.sh --source v4l2:/dev/video0 --max-frames 600
+#
+# fpga:fpga_dev_write tracepoint 를 켜고 finger_detect --trace 를 실행한 뒤
+# ftrace 버퍼를 latency_trace.txt 로 저장하고 latency_join.py 로 단계별
+# 히스토그램을 출력한다. k6 드라이버들이 올라가 있어야 한다 (insmodall.sh).
+# 결정이 바뀐 프레임만 드라이버까지 가므로 손 모양을 여러 번 바꿔 가며 잰다.
+
+HERE=$(cd "$(dirname "$0")" && pwd)
+OUT=latency_trace.txt
+TRACEFS=/sys/kernel/tracing
+
+[ -d $TRACEFS/events ] || TRACEFS=/sys/kernel/debug/tracing
+[ -d $TRACEFS/events ] || mount -t tracefs nodev /sys/kernel/tracing
+[ -d $TRACEFS/events ] || TRACEFS=/sys/kernel/tracing
+[ -d $TRACEFS/events/fpga/fpga_dev_write ] || { echo "❌ fpga:fpga_dev_write not found, load fpga_interface_driver.ko first"; exit 1; }
+
+# 프레임마다 이벤트가 몇 개뿐이지만 긴 실행에서도 덮어쓰지 않게 버퍼를 넉넉히 잡는다
+echo 0 > $TRACEFS/tracing_on
+echo > $TRACEFS/trace
+echo 4096 > $TRACEFS/buffer_size_kb
+echo 1 > $TRACEFS/events/fpga/fpga_dev_write/enable
+echo 1 > $TRACEFS/tracing_on
+
+"$HERE/finger_detect" --trace "$@"
+STATUS=$?
+
+echo 0 > $TRACEFS/tracing_on
+echo 0 > $TRACEFS/events/fpga/fpga_dev_write/enable
+cat $TRACEFS/trace > $OUT
+echo "trace saved to $OUT"
+
+python3 "$HERE/latency_join.py" $OUT || STATUS=1
+exit $STATUS
@@ -0,0 +1,164 @@
+/*
+ * Hand ROI tracker: decides where the detector looks next
+ */
+#include "tracker.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace finger {
+
+void HandTracker::Axis::reset(float z, float r)
+{
+    x = z;
+    v = 0;
+    p00 = r;
+    p01 = 0;
+    p11 = r;
+}
+
+void HandTracker::Axis::predict(float q)
+{
+    // F = [1 1; 0 1], Q = diag(q, q)
+    x += v;
+    p00 += 2 * p01 + p11 + q;
+    p01 += p11;
+    p11 += q;
+}
+
+void HandTracker::Axis::correct(float z, float r)
+{
+    // H = [1 0]
+    float s = p00 + r;
+    float k0 = p00 / s;
+    float k1 = p01 / s;
+    float y = z - x;
+
+    x += k0 * y;
+    v += k1 * y;
+    p11 -= k1 * p01;
+    p01 -= k0 * p01;
+    p00 -= k0 * p00;
+}
+
+HandTracker::HandTracker(const TrackerOptions &options)
+    : options_(options)
+{
+}
+
+void HandTracker::start(const Detection &d)
+{
+    const float r = options_.measure_noise;
+
+    cx_.reset((d.x1 + d.x2) * 0.5f, r);
+    cy_.reset((d.y1 + d.y2) * 0.5f, r);
+    w_.reset(d.x2 - d.x1, r);
+    h_.reset(d.y2 - d.y1, r);
+    cls_ = d.cls;
+    misses_ = 0;
+    tracking_ = true;
+}
+
+Detection HandTracker::predicted() const
+{
+    Detection d;
+    d.x1 = cx_.x - w_.x * 0.5f;
+    d.y1 = cy_.x - h_.x * 0.5f;
+    d.x2 = cx_.x + w_.x * 0.5f;
+    d.y2 = cy_.x + h_.x * 0.5f;
+    d.score = 1.0f;
+    d.cls = cls_;
+    return d;
+}
+
+Roi HandTracker::plan(int image_w, int image_h)
+{
+    Roi roi;
+    roi.w = image_w;
+    roi.h = image_h;
+
+    if (!enabled())
+        return roi;
+
+    if (tracking_) {
+        const float q = options_.process_noise;
+        cx_.predict(q);
+        cy_.predict(q);
+        w_.predict(q);
+        h_.predict(q);
+    }
+
+    bool full = !tracking_ || ++since_full_ >= options_.redetect_interval;
+    int side = 0;
+
+    if (!full) {
+        float want = std::max(std::max(w_.x, h_.x) * options_.expand, float(options_.min_crop));
+        side = std::min(int(std::lround(want)), std::min(image_w, image_h));
+        // crop 이 프레임 대부분을 덮으면 잘라 봐야 이득이 없다
+        full = float(side) * side > options_.max_crop_ratio * image_w * image_h;
+    }
+
+    planned_full_ = full;
+    if (full) {
+        since_full_ = 0;
+        full_frames_++;
+        return roi;
+    }
+
+    // 예측 중심에 맞춘 정사각형 crop 을 프레임 안으로 밀어 넣는다
+    roi.full = false;
+    roi.w = roi.h = side;
+    roi.x = std::clamp(int(std::lround(cx_.x - side * 0.5f)), 0, image_w - side);
+    roi.y = std::clamp(int(std::lround(cy_.x - side * 0.5f)), 0, image_h - side);
+    roi_frames_++;
+    return roi;
+}
+
+const Detection *HandTracker::update(const std::vector<Detection> &dets)
+{
+    if (!enabled())
+        return nullptr;
+
+    if (tracking_) {
+        const Detection pred = predicted();
+        const Detection *match = nullptr;
+        float best = options_.min_iou;
+
+        for (const Detection &d : dets) {
+            float o = iou(pred, d);
+            if (o >= best) {
+                best = o;
+                match = &d;
+            }
+        }
+
+        if (match) {
+            const float r = options_.measure_noise;
+            cx_.correct((match->x1 + match->x2) * 0.5f, r);
+            cy_.correct((match->y1 + match->y2) * 0.5f, r);
+            w_.correct(match->x2 - match->x1, r);
+            h_.correct(match->y2 - match->y1, r);
+            cls_ = match->cls;
+            misses_ = 0;
+            return match;
+        }
+
+        // 전체 프레임에서도 예측 위치에 손이 없으면 바로 놓친 것으로 본다
+        if (++misses_ <= options_.max_misses && !planned_full_)
+            return nullptr;
+        tracking_ = false;
+        lost_++;
+    }
+
+    // 추적이 없으면 전체 프레임 검출 결과 중 점수가 가장 높은 손에서 시작한다
+    if (!planned_full_ || dets.empty())
+        return nullptr;
+    const Detection *best = &dets.front();
+    for (const Detection &d : dets)
+        if (d.score > best->score)
+            best = &d;
+    start(*best);
+    return best;
+}
+
+} // namespace finger
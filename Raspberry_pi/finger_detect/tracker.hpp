@@ -0,0 +1,89 @@
+/*
+ * Hand ROI tracker: decides where the detector looks next
+ *
+ * Once a hand has been found it almost always stays near the same place,
+ * so the detector does not have to look at the whole frame again. The
+ * tracker keeps a constant-velocity Kalman filter on the box centre and
+ * size (one independent [position, velocity] filter per coordinate) and
+ * associates new detections to the prediction by IoU.
+ *
+ * plan() returns a square crop around the predicted box, expanded by
+ * 'expand' so the hand can move between frames; the detector runs on that
+ * crop at the smaller ROI input size. A full-frame detection is planned
+ * every 'redetect_interval' frames, while no track exists, and after
+ * 'max_misses' frames without an associated detection (track lost).
+ */
+#ifndef FINGER_DETECT_TRACKER_HPP
+#define FINGER_DETECT_TRACKER_HPP
+
+#include <vector>
+
+#include "yolo.hpp"
+
+namespace finger {
+
+struct TrackerOptions {
+    int redetect_interval = 0;     // K: 이 프레임 수마다 전체 프레임 검출 (0: 추적 끔)
+    float expand = 2.0f;           // 예측 박스 긴 변 대비 crop 한 변의 배율
+    int min_crop = 160;            // crop 한 변의 최소 픽셀
+    float max_crop_ratio = 0.6f;   // crop 면적이 프레임의 이 비율을 넘으면 전체 검출
+    float min_iou = 0.1f;          // 예측 박스와 검출을 같은 손으로 볼 최소 IoU
+    int max_misses = 2;            // 연속으로 놓치면 추적을 버린다
+    float process_noise = 4.0f;    // 픽셀^2 / 프레임
+    float measure_noise = 16.0f;   // 픽셀^2
+};
+
+struct Roi {
+    int x = 0, y = 0, w = 0, h = 0;
+    bool full = true; // true 이면 전체 프레임
+};
+
+class HandTracker {
+public:
+    explicit HandTracker(const TrackerOptions &options);
+
+    bool enabled() const { return options_.redetect_interval > 0; }
+    bool tracking() const { return tracking_; }
+
+    // 다음 프레임에서 검출기가 볼 영역 (예측 단계도 여기서 진행한다)
+    Roi plan(int image_w, int image_h);
+
+    /*
+     * Feed the detections of the planned frame, in full-frame coordinates.
+     * Returns the detection associated with the track, or nullptr.
+     */
+    const Detection *update(const std::vector<Detection> &dets);
+
+    // 마지막 예측 박스 (전체 프레임 좌표)
+    Detection predicted() const;
+
+    unsigned long full_frames() const { return full_frames_; }
+    unsigned long roi_frames() const { return roi_frames_; }
+    unsigned long lost() const { return lost_; }
+
+private:
+    // [위치, 속도] 2상태 칼만 필터, 측정은 위치만
+    struct Axis {
+        float x = 0, v = 0;
+        float p00 = 0, p01 = 0, p11 = 0;
+
+        void reset(float z, float r);
+        void predict(float q);
+        void correct(float z, float r);
+    };
+
+    void start(const Detection &d);
+
+    TrackerOptions options_;
+    Axis cx_, cy_, w_, h_;
+    int cls_ = -1;
+    bool tracking_ = false;
+    bool planned_full_ = true;
+    int since_full_ = 0;
+    int misses_ = 0;
+    unsigned long full_frames_ = 0, roi_frames_ = 0, lost_ = 0;
+};
+
+} // namespace finger
+
+#endif // FINGER_DETECT_TRACKER_HPP
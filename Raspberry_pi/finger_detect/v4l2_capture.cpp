@@ -0,0 +1,435 @@
+/*
+ * Zero-copy raw frame sources: V4L2 streaming capture and raw file replay
+ */
+#include "v4l2_capture.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <thread>
+
+#include <fcntl.h>
+#include <linux/dma-buf.h>
+#include <linux/dma-heap.h>
+#include <linux/videodev2.h>
+#include <poll.h>
+#include <sys/ioctl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace finger {
+
+namespace {
+
+// EINTR 이면 다시 시도하는 ioctl
+int xioctl(int fd, unsigned long request, void *arg)
+{
+    int ret;
+
+    do {
+        ret = ioctl(fd, request, arg);
+    } while (ret < 0 && errno == EINTR);
+    return ret < 0 ? -errno : 0;
+}
+
+std::uint32_t fourcc(PixelFormat format)
+{
+    return format == PixelFormat::Yuyv ? V4L2_PIX_FMT_YUYV : V4L2_PIX_FMT_BGR24;
+}
+
+void dmabuf_sync(int fd, std::uint64_t flags)
+{
+    struct dma_buf_sync sync = {};
+
+    sync.flags = flags;
+    (void)xioctl(fd, DMA_BUF_IOCTL_SYNC, &sync);
+}
+
+bool starts_with(const std::string &s, const char *prefix)
+{
+    return s.compare(0, std::strlen(prefix), prefix) == 0;
+}
+
+} // namespace
+
+std::unique_ptr<RawSource> RawSource::open(const std::string &spec, const RawOptions &options, int &err)
+{
+    err = 0;
+    if (starts_with(spec, "v4l2:")) {
+        auto capture = std::make_unique<V4l2Capture>(options);
+        if ((err = capture->open(spec.substr(5))) < 0)
+            return nullptr;
+        return capture;
+    }
+    if (starts_with(spec, "raw:")) {
+        auto file = std::make_unique<RawFileSource>(options);
+        if ((err = file->open(spec.substr(4))) < 0)
+            return nullptr;
+        return file;
+    }
+    return nullptr;
+}
+
+/* ---------------------------------------------------------------- V4L2 */
+
+V4l2Capture::V4l2Capture(const RawOptions &options) : RawSource(options)
+{
+    options_.buffers = std::max(options_.buffers, RawOptions::kMinBuffers);
+}
+
+V4l2Capture::~V4l2Capture()
+{
+    close();
+}
+
+int V4l2Capture::open(const std::string &device)
+{
+    struct v4l2_capability cap = {};
+    int ret;
+
+    fd_ = ::open(device.c_str(), O_RDWR | O_NONBLOCK | O_CLOEXEC);
+    if (fd_ < 0)
+        return -errno;
+
+    if ((ret = xioctl(fd_, VIDIOC_QUERYCAP, &cap)) < 0)
+        goto fail;
+    if (!(cap.device_caps & V4L2_CAP_VIDEO_CAPTURE) || !(cap.device_caps & V4L2_CAP_STREAMING)) {
+        ret = -ENODEV;
+        goto fail;
+    }
+
+    if ((ret = set_format()) < 0)
+        goto fail;
+    ret = options_.io == RawOptions::Io::Dmabuf ? alloc_dmabuf() : alloc_mmap();
+    if (ret < 0)
+        goto fail;
+
+    for (std::size_t i = 0; i < buffers_.size(); i++)
+        if ((ret = queue(int(i))) < 0)
+            goto fail;
+
+    {
+        int type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
+        if ((ret = xioctl(fd_, VIDIOC_STREAMON, &type)) < 0)
+            goto fail;
+    }
+    streaming_ = true;
+    return 0;
+
+fail:
+    close();
+    return ret;
+}
+
+int V4l2Capture::set_format()
+{
+    struct v4l2_format fmt = {};
+    int ret;
+
+    fmt.type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
+    fmt.fmt.pix.width = options_.width;
+    fmt.fmt.pix.height = options_.height;
+    fmt.fmt.pix.pixelformat = fourcc(options_.format);
+    fmt.fmt.pix.field = V4L2_FIELD_NONE;
+    if ((ret = xioctl(fd_, VIDIOC_S_FMT, &fmt)) < 0)
+        return ret;
+
+    // 드라이버가 형식을 바꿔 버리면 전처리가 읽을 수 없다, 크기는 드라이버 값을 따른다
+    if (fmt.fmt.pix.pixelformat != fourcc(options_.format))
+        return -EINVAL;
+    options_.width = fmt.fmt.pix.width;
+    options_.height = fmt.fmt.pix.height;
+    stride_ = fmt.fmt.pix.bytesperline ? fmt.fmt.pix.bytesperline
+                                       : std::size_t(options_.width) * bytes_per_pixel(options_.format);
+    return 0;
+}
+
+int V4l2Capture::alloc_mmap()
+{
+    struct v4l2_requestbuffers req = {};
+    int ret;
+
+    req.count = options_.buffers;
+    req.type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
+    req.memory = V4L2_MEMORY_MMAP;
+    if ((ret = xioctl(fd_, VIDIOC_REQBUFS, &req)) < 0)
+        return ret;
+    if (req.count < unsigned(RawOptions::kMinBuffers))
+        return -ENOMEM;
+
+    buffers_.resize(req.count);
+    for (unsigned i = 0; i < req.count; i++) {
+        struct v4l2_buffer buf = {};
+
+        buf.type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
+        buf.memory = V4L2_MEMORY_MMAP;
+        buf.index = i;
+        if ((ret = xioctl(fd_, VIDIOC_QUERYBUF, &buf)) < 0)
+            return ret;
+
+        void *p = mmap(nullptr, buf.length, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, buf.m.offset);
+        if (p == MAP_FAILED)
+            return -errno;
+        buffers_[i].data = static_cast<std::uint8_t *>(p);
+        buffers_[i].length = buf.length;
+    }
+    return 0;
+}
+
+int V4l2Capture::alloc_dmabuf()
+{
+    static const char *const heaps[] = {"/dev/dma_heap/linux,cma", "/dev/dma_heap/system"};
+    struct v4l2_format fmt = {};
+    struct v4l2_requestbuffers req = {};
+    int heap = -1;
+    int ret;
+
+    // 카메라(ISP) 는 연속 메모리를 좋아하므로 CMA 힙을 먼저 시도한다
+    for (const char *path : heaps)
+        if ((heap = ::open(path, O_RDWR | O_CLOEXEC)) >= 0)
+            break;
+    if (heap < 0)
+        return -errno;
+
+    fmt.type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
+    if ((ret = xioctl(fd_, VIDIOC_G_FMT, &fmt)) < 0)
+        goto out;
+
+    req.count = options_.buffers;
+    req.type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
+    req.memory = V4L2_MEMORY_DMABUF;
+    if ((ret = xioctl(fd_, VIDIOC_REQBUFS, &req)) < 0)
+        goto out;
+    if (req.count < unsigned(RawOptions::kMinBuffers)) {
+        ret = -ENOMEM;
+        goto out;
+    }
+
+    buffers_.resize(req.count);
+    for (Buffer &b : buffers_) {
+        struct dma_heap_allocation_data alloc = {};
+
+        alloc.len = fmt.fmt.pix.sizeimage;
+        alloc.fd_flags = O_RDWR | O_CLOEXEC;
+        if ((ret = xioctl(heap, DMA_HEAP_IOCTL_ALLOC, &alloc)) < 0)
+            goto out;
+        b.dmabuf = alloc.fd;
+        b.length = alloc.len;
+
+        void *p = mmap(nullptr, b.length, PROT_READ, MAP_SHARED, b.dmabuf, 0);
+        if (p == MAP_FAILED) {
+            ret = -errno;
+            goto out;
+        }
+        b.data = static_cast<std::uint8_t *>(p);
+    }
+    ret = 0;
+
+out:
+    ::close(heap);
+    return ret;
+}
+
+int V4l2Capture::queue(int index)
+{
+    struct v4l2_buffer buf = {};
+    Buffer &b = buffers_[index];
+
+    buf.type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
+    buf.index = index;
+    if (b.dmabuf >= 0) {
+        buf.memory = V4L2_MEMORY_DMABUF;
+        buf.m.fd = b.dmabuf;
+        buf.length = b.length;
+    } else {
+        buf.memory = V4L2_MEMORY_MMAP;
+    }
+    return xioctl(fd_, VIDIOC_QBUF, &buf);
+}
+
+int V4l2Capture::acquire(RawFrame &frame, int timeout_ms)
+{
+    struct pollfd pfd = {fd_, POLLIN, 0};
+    struct v4l2_buffer got = {};
+    bool have = false;
+    int ret;
+
+    ret = poll(&pfd, 1, timeout_ms);
+    if (ret < 0)
+        return errno == EINTR ? -EAGAIN : -errno;
+    if (ret == 0)
+        return -EAGAIN;
+
+    // 채워진 버퍼를 모두 꺼내 가장 최근 것만 남긴다
+    for (;;) {
+        struct v4l2_buffer buf = {};
+
+        buf.type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
+        buf.memory = options_.io == RawOptions::Io::Dmabuf ? V4L2_MEMORY_DMABUF : V4L2_MEMORY_MMAP;
+        ret = xioctl(fd_, VIDIOC_DQBUF, &buf);
+        if (ret == -EAGAIN)
+            break;
+        if (ret < 0)
+            return ret;
+
+        if (buf.flags & V4L2_BUF_FLAG_ERROR) {
+            queue(buf.index);
+            continue;
+        }
+        if (have) {
+            queue(got.index);
+            dropped_++;
+        }
+        got = buf;
+        have = true;
+        if (!options_.latest)
+            break;
+    }
+    if (!have)
+        return -EAGAIN;
+
+    Buffer &b = buffers_[got.index];
+    if (b.dmabuf >= 0)
+        dmabuf_sync(b.dmabuf, DMA_BUF_SYNC_START | DMA_BUF_SYNC_READ);
+
+    frame.image.data = b.data;
+    frame.image.width = options_.width;
+    frame.image.height = options_.height;
+    frame.image.stride = stride_;
+    frame.image.format = options_.format;
+    frame.bytes = got.bytesused;
+    frame.index = int(got.index);
+    frame.sequence = got.sequence;
+    // libstdc++ 의 steady_clock 은 CLOCK_MONOTONIC 이므로 드라이버 시각을 그대로 쓸 수 있다
+    if ((got.flags & V4L2_BUF_FLAG_TIMESTAMP_MASK) == V4L2_BUF_FLAG_TIMESTAMP_MONOTONIC)
+        frame.timestamp = Clock::time_point(std::chrono::seconds(got.timestamp.tv_sec) +
+                                            std::chrono::microseconds(got.timestamp.tv_usec));
+    else
+        frame.timestamp = Clock::now();
+    return 0;
+}
+
+void V4l2Capture::release(const RawFrame &frame)
+{
+    if (frame.index < 0 || std::size_t(frame.index) >= buffers_.size())
+        return;
+    if (buffers_[frame.index].dmabuf >= 0)
+        dmabuf_sync(buffers_[frame.index].dmabuf, DMA_BUF_SYNC_END | DMA_BUF_SYNC_READ);
+    // 스트리밍이 멈춘 뒤라면 실패해도 상관없다
+    (void)queue(frame.index);
+}
+
+void V4l2Capture::close()
+{
+    if (fd_ < 0)
+        return;
+
+    if (streaming_) {
+        int type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
+        (void)xioctl(fd_, VIDIOC_STREAMOFF, &type);
+        streaming_ = false;
+    }
+    for (Buffer &b : buffers_) {
+        if (b.data)
+            munmap(b.data, b.length);
+        if (b.dmabuf >= 0)
+            ::close(b.dmabuf);
+    }
+    buffers_.clear();
+
+    struct v4l2_requestbuffers req = {};
+    req.type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
+    req.memory = options_.io == RawOptions::Io::Dmabuf ? V4L2_MEMORY_DMABUF : V4L2_MEMORY_MMAP;
+    (void)xioctl(fd_, VIDIOC_REQBUFS, &req);
+
+    ::close(fd_);
+    fd_ = -1;
+}
+
+/* ------------------------------------------------------------ raw file */
+
+RawFileSource::~RawFileSource()
+{
+    if (map_)
+        munmap(map_, map_size_);
+}
+
+int RawFileSource::open(const std::string &path)
+{
+    struct stat st;
+    int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    int ret = 0;
+
+    if (fd < 0)
+        return -errno;
+    if (fstat(fd, &st) < 0) {
+        ret = -errno;
+        goto out;
+    }
+
+    frame_bytes_ = std::size_t(options_.width) * options_.height * bytes_per_pixel(options_.format);
+    frames_ = std::size_t(st.st_size) / frame_bytes_;
+    if (frames_ == 0) {
+        ret = -ENODATA;
+        goto out;
+    }
+
+    map_size_ = frames_ * frame_bytes_;
+    {
+        void *p = mmap(nullptr, map_size_, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (p == MAP_FAILED) {
+            ret = -errno;
+            goto out;
+        }
+        map_ = static_cast<std::uint8_t *>(p);
+    }
+    (void)madvise(map_, map_size_, MADV_SEQUENTIAL);
+
+out:
+    ::close(fd);
+    return ret;
+}
+
+int RawFileSource::acquire(RawFrame &frame, int timeout_ms)
+{
+    Clock::time_point now = Clock::now();
+
+    if (played_++ == 0)
+        start_ = now;
+
+    // 카메라처럼 일정한 속도로 재생한다: 늦었으면 건너뛰고, 이르면 기다린다
+    if (options_.fps > 0) {
+        const std::chrono::duration<double> period(1.0 / options_.fps);
+        std::size_t due = std::size_t((now - start_) / period);
+
+        if (options_.latest && due > next_) {
+            dropped_ += due - next_;
+            next_ = due;
+        }
+        auto at = start_ + std::chrono::duration_cast<Clock::duration>(period * double(next_));
+        if (at > now) {
+            if (at - now > std::chrono::milliseconds(timeout_ms))
+                return -EAGAIN;
+            std::this_thread::sleep_until(at);
+        }
+    }
+
+    if (next_ >= frames_ && !options_.loop)
+        return -ENODATA;
+
+    const std::size_t index = next_ % frames_;
+    frame.image.data = map_ + index * frame_bytes_;
+    frame.image.width = options_.width;
+    frame.image.height = options_.height;
+    frame.image.stride = std::size_t(options_.width) * bytes_per_pixel(options_.format);
+    frame.image.format = options_.format;
+    frame.bytes = frame_bytes_;
+    frame.index = -1;
+    frame.sequence = std::uint32_t(next_);
+    frame.timestamp = Clock::now();
+    next_++;
+    return 0;
+}
+
+} // namespace finger
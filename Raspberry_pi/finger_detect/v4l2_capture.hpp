@@ -0,0 +1,156 @@
+/*
+ * Zero-copy raw frame sources: V4L2 streaming capture and raw file replay
+ *
+ * V4l2Capture asks the camera driver for 'buffers' streaming buffers with
+ * VIDIOC_REQBUFS, either driver-allocated and mmap()ed (Io::Mmap) or
+ * allocated from a DMA-BUF heap and imported by fd (Io::Dmabuf). A frame
+ * returned by acquire() points straight into the dequeued buffer; the
+ * preprocessing kernel reads it in place and release() queues the buffer
+ * back to the driver, so no frame is copied or converted on the way in.
+ *
+ * With 'latest' set, acquire() drains every buffer that is already filled
+ * and hands out only the newest one; older ones go straight back to the
+ * driver (counted in dropped()). That keeps capture-to-inference latency
+ * at one frame instead of the driver queue depth. Frames held by the
+ * caller are out of the driver queue, so 'buffers' must be larger than
+ * the number of frames the pipeline keeps in flight (the frame ring + 2);
+ * V4l2Capture raises it to RawOptions::kMinBuffers and fails with -ENOMEM
+ * if the driver grants fewer.
+ *
+ * RawFileSource replays a file of back-to-back raw frames (for example
+ * recorded with 'v4l2-ctl --stream-mmap --stream-to=hand.yuyv') through
+ * the same interface, mmap()ed and returned without copying, so the
+ * capture path can be exercised without a camera. With 'fps' set it
+ * paces the replay like a camera and skips frames a slow consumer missed.
+ *
+ * Errors follow libfpga: 0 or a negative errno.
+ */
+#ifndef FINGER_DETECT_V4L2_CAPTURE_HPP
+#define FINGER_DETECT_V4L2_CAPTURE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "preprocess.hpp"
+#include "stats.hpp"
+
+namespace finger {
+
+struct RawOptions {
+    enum class Io { Mmap, Dmabuf };
+
+    int width = 640;
+    int height = 480;
+    PixelFormat format = PixelFormat::Yuyv;
+    // 프레임 링 4 + 추론 중 1 + 캡처 중 1 보다 하나 더 있어야 드라이버 큐가 비지 않는다
+    static constexpr int kMinBuffers = 7;
+
+    int buffers = kMinBuffers; // 드라이버 큐 깊이
+    Io io = Io::Mmap;
+    bool latest = true;    // 밀린 프레임은 버리고 가장 최근 것만 준다
+    double fps = 0.0;      // 파일 재생 속도, 0 이면 소비자 속도대로
+    bool loop = false;     // 파일 끝에서 처음으로 돌아간다
+};
+
+struct RawFrame {
+    ImageView image;
+    std::size_t bytes = 0;
+    int index = -1;              // 드라이버 버퍼 번호 (release 에 필요)
+    std::uint32_t sequence = 0;  // 드라이버가 매긴 프레임 번호, 빠진 번호 = 놓친 프레임
+    Clock::time_point timestamp; // 센서에서 버퍼가 채워진 시각 (CLOCK_MONOTONIC)
+};
+
+class RawSource {
+public:
+    virtual ~RawSource() = default;
+
+    /*
+     * Wait up to timeout_ms for a frame. Returns 0, -EAGAIN on timeout,
+     * -ENODATA at the end of a replayed file or another negative errno.
+     * Every successful acquire() must be paired with release().
+     */
+    virtual int acquire(RawFrame &frame, int timeout_ms) = 0;
+    virtual void release(const RawFrame &frame) = 0;
+
+    const RawOptions &options() const { return options_; }
+    // latest 동작이나 재생 속도 때문에 건너뛴 프레임 수 (acquire 스레드에서만 갱신)
+    unsigned long dropped() const { return dropped_; }
+
+    /*
+     * "v4l2:/dev/video0" opens a camera, "raw:/path/file" replays a file.
+     * Returns nullptr for any other spec (err = 0) or on failure (err < 0).
+     */
+    static std::unique_ptr<RawSource> open(const std::string &spec, const RawOptions &options, int &err);
+
+protected:
+    explicit RawSource(const RawOptions &options) : options_(options) {}
+
+    RawOptions options_;
+    unsigned long dropped_ = 0;
+};
+
+class V4l2Capture : public RawSource {
+public:
+    // buffers 는 RawOptions::kMinBuffers 이상으로 올린다
+    explicit V4l2Capture(const RawOptions &options);
+    ~V4l2Capture() override;
+
+    V4l2Capture(const V4l2Capture &) = delete;
+    V4l2Capture &operator=(const V4l2Capture &) = delete;
+
+    // 형식 설정, 버퍼 할당, 큐잉, STREAMON 까지 한다
+    int open(const std::string &device);
+
+    int acquire(RawFrame &frame, int timeout_ms) override;
+    void release(const RawFrame &frame) override;
+
+private:
+    struct Buffer {
+        std::uint8_t *data = nullptr;
+        std::size_t length = 0;
+        int dmabuf = -1; // Io::Dmabuf 일 때 힙에서 받은 fd
+    };
+
+    int set_format();
+    int alloc_mmap();
+    int alloc_dmabuf();
+    int queue(int index);
+    void close();
+
+    int fd_ = -1;
+    std::vector<Buffer> buffers_;
+    std::size_t stride_ = 0;
+    bool streaming_ = false;
+};
+
+class RawFileSource : public RawSource {
+public:
+    explicit RawFileSource(const RawOptions &options) : RawSource(options) {}
+    ~RawFileSource() override;
+
+    RawFileSource(const RawFileSource &) = delete;
+    RawFileSource &operator=(const RawFileSource &) = delete;
+
+    int open(const std::string &path);
+
+    int acquire(RawFrame &frame, int timeout_ms) override;
+    void release(const RawFrame &) override {}
+
+    std::size_t frames() const { return frames_; }
+
+private:
+    std::uint8_t *map_ = nullptr;
+    std::size_t map_size_ = 0;
+    std::size_t frame_bytes_ = 0;
+    std::size_t frames_ = 0;
+    std::size_t next_ = 0;
+    unsigned long played_ = 0;
+    Clock::time_point start_;
+};
+
+} // namespace finger
+
+#endif // FINGER_DETECT_V4L2_CAPTURE_HPP
@@ -0,0 +1,114 @@
+/*
+ * YOLO pre/post-processing helpers for finger_detect
+ */
+#include "yolo.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace finger {
+
+Letterbox make_letterbox(int image_w, int image_h, int input_w, int input_h)
+{
+    Letterbox lb;
+
+    lb.image_w = image_w;
+    lb.image_h = image_h;
+    lb.input_w = input_w;
+    lb.input_h = input_h;
+    lb.scale = std::min(float(input_w) / image_w, float(input_h) / image_h);
+    lb.resized_w = int(std::lround(image_w * lb.scale));
+    lb.resized_h = int(std::lround(image_h * lb.scale));
+
+    // 남는 여백을 양쪽으로 나누고, 홀수일 때는 오른쪽/아래쪽이 1 픽셀 더 갖는다
+    lb.pad_left = int(std::lround((input_w - lb.resized_w) / 2.0f - 0.1f));
+    lb.pad_top = int(std::lround((input_h - lb.resized_h) / 2.0f - 0.1f));
+    return lb;
+}
+
+float iou(const Detection &a, const Detection &b)
+{
+    float w = std::min(a.x2, b.x2) - std::max(a.x1, b.x1);
+    float h = std::min(a.y2, b.y2) - std::max(a.y1, b.y1);
+
+    if (w <= 0.0f || h <= 0.0f)
+        return 0.0f;
+
+    float inter = w * h;
+    float area_a = (a.x2 - a.x1) * (a.y2 - a.y1);
+    float area_b = (b.x2 - b.x1) * (b.y2 - b.y1);
+    return inter / (area_a + area_b - inter);
+}
+
+void nms(std::vector<Detection> &dets, float iou_threshold, std::size_t max_det, bool agnostic)
+{
+    std::size_t kept = 0;
+
+    for (std::size_t i = 0; i < dets.size() && kept < max_det; i++) {
+        bool suppressed = false;
+
+        for (std::size_t k = 0; k < kept; k++) {
+            if (!agnostic && dets[k].cls != dets[i].cls)
+                continue;
+            if (iou(dets[k], dets[i]) > iou_threshold) {
+                suppressed = true;
+                break;
+            }
+        }
+        if (!suppressed)
+            dets[kept++] = dets[i];
+    }
+    dets.resize(kept);
+}
+
+void decode(const float *output, int rows, int cols, int num_classes,
+            const Letterbox &lb, const DecodeParams &params,
+            std::vector<Detection> &out)
+{
+    const int attrs = 4 + num_classes;
+    // [attrs, anchors] 이면 열 방향으로, [anchors, attrs] 이면 행 방향으로 읽는다
+    const bool transposed = rows == attrs;
+    const int anchors = transposed ? cols : rows;
+    const std::size_t attr_stride = transposed ? anchors : 1;
+    const std::size_t anchor_stride = transposed ? 1 : attrs;
+
+    out.clear();
+    if ((transposed ? rows : cols) != attrs)
+        return;
+
+    for (int i = 0; i < anchors; i++) {
+        const float *p = output + i * anchor_stride;
+        int best = 0;
+        float best_score = p[4 * attr_stride];
+
+        for (int c = 1; c < num_classes; c++) {
+            float s = p[(4 + c) * attr_stride];
+            if (s > best_score) {
+                best_score = s;
+                best = c;
+            }
+        }
+        if (best_score <= params.conf_threshold)
+            continue;
+
+        float cx = p[0], cy = p[attr_stride], w = p[2 * attr_stride], h = p[3 * attr_stride];
+        Detection d;
+        d.x1 = (cx - w * 0.5f - lb.pad_left) / lb.scale;
+        d.y1 = (cy - h * 0.5f - lb.pad_top) / lb.scale;
+        d.x2 = (cx + w * 0.5f - lb.pad_left) / lb.scale;
+        d.y2 = (cy + h * 0.5f - lb.pad_top) / lb.scale;
+        d.x1 = std::clamp(d.x1, 0.0f, float(lb.image_w));
+        d.y1 = std::clamp(d.y1, 0.0f, float(lb.image_h));
+        d.x2 = std::clamp(d.x2, 0.0f, float(lb.image_w));
+        d.y2 = std::clamp(d.y2, 0.0f, float(lb.image_h));
+        d.score = best_score;
+        d.cls = best;
+        out.push_back(d);
+    }
+
+    std::sort(out.begin(), out.end(),
+              [](const Detection &a, const Detection &b) { return a.score > b.score; });
+    nms(out, params.iou_threshold, params.max_det, params.agnostic);
+}
+
+} // namespace finger
@@ -0,0 +1,62 @@
+/*
+ * YOLO pre/post-processing helpers for finger_detect
+ *
+ * Nothing in here depends on OpenCV: the letterbox geometry, the output
+ * decoder and NMS work on plain float buffers so they can be reused by
+ * every inference backend.
+ *
+ * The decoder expects the ultralytics YOLOv8 ONNX export layout,
+ * [1, 4 + num_classes, num_anchors] (or its transpose), with boxes as
+ * (cx, cy, w, h) in network input pixels and no objectness column.
+ */
+#ifndef FINGER_DETECT_YOLO_HPP
+#define FINGER_DETECT_YOLO_HPP
+
+#include <cstddef>
+#include <vector>
+
+namespace finger {
+
+struct Detection {
+    float x1, y1, x2, y2; // 원본 이미지 좌표
+    float score;
+    int cls;
+};
+
+/* 원본 이미지를 네트워크 입력 크기에 맞출 때의 배율과 여백 */
+struct Letterbox {
+    float scale = 1.0f;
+    int resized_w = 0, resized_h = 0;
+    int pad_left = 0, pad_top = 0;
+    int input_w = 0, input_h = 0;
+    int image_w = 0, image_h = 0;
+};
+
+// ultralytics LetterBox(auto=False, center=True) 와 같은 계산
+Letterbox make_letterbox(int image_w, int image_h, int input_w, int input_h);
+
+struct DecodeParams {
+    float conf_threshold = 0.25f;
+    float iou_threshold = 0.7f;
+    std::size_t max_det = 300;
+    bool agnostic = false;
+};
+
+/*
+ * Decode one output tensor into detections in original image coordinates.
+ * 'rows' and 'cols' are the last two output dimensions; the layout is
+ * detected from which of them equals 4 + num_classes.
+ * Results are sorted by score, highest first, like ultralytics Results.
+ */
+void decode(const float *output, int rows, int cols, int num_classes,
+            const Letterbox &lb, const DecodeParams &params,
+            std::vector<Detection> &out);
+
+float iou(const Detection &a, const Detection &b);
+
+// 점수 내림차순으로 정렬된 후보에 대해 NMS 를 적용한다 (제자리 처리)
+void nms(std::vector<Detection> &dets, float iou_threshold, std::size_t max_det, bool agnostic);
+
+} // namespace finger
+
+#endif // FINGER_DETECT_YOLO_HPP
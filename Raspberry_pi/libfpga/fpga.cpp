@@ -0,0 +1,771 @@
+/*
+ * libfpga - user space client library for the FPGA peripherals
+ *
+ * The simulator paths below mirror the register writes done by the
+ * *_k6 kernel drivers, so a Board on Backend::Sim produces the same bus
+ * transactions (address, value, count) as the real hardware path.
+ */
+#include "fpga.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/ioctl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+namespace fpga {
+
+Backend default_backend()
+{
+    static const Backend backend = [] {
+        const char *env = std::getenv("FPGA_BACKEND");
+        return (env && std::strcmp(env, "sim") == 0) ? Backend::Sim : Backend::Device;
+    }();
+    return backend;
+}
+
+void SimBus::write(unsigned addr, std::uint8_t value)
+{
+    regs_[addr & (kAddressSpace - 1)].store(value, std::memory_order_relaxed);
+    writes_.fetch_add(1, std::memory_order_relaxed);
+}
+
+std::uint8_t SimBus::read(unsigned addr)
+{
+    reads_.fetch_add(1, std::memory_order_relaxed);
+    return regs_[addr & (kAddressSpace - 1)].load(std::memory_order_relaxed);
+}
+
+std::uint8_t SimBus::peek(unsigned addr) const
+{
+    return regs_[addr & (kAddressSpace - 1)].load(std::memory_order_relaxed);
+}
+
+void SimBus::reset()
+{
+    for (auto &reg : regs_)
+        reg.store(0, std::memory_order_relaxed);
+    writes_.store(0, std::memory_order_relaxed);
+    reads_.store(0, std::memory_order_relaxed);
+}
+
+SimBus &sim_bus()
+{
+    static SimBus bus;
+    return bus;
+}
+
+/* ---------------------------------------------------------------------- */
+
+Device::Device(const char *node, Access access, Backend backend)
+    : node_(node)
+{
+    if (backend == Backend::Sim) {
+        sim_ = true;
+        err_ = 0;
+        return;
+    }
+
+    int flags = access == Access::Read ? O_RDONLY : access == Access::Write ? O_WRONLY : O_RDWR;
+    fd_ = ::open(node, flags | O_CLOEXEC);
+    err_ = fd_ < 0 ? -errno : 0;
+}
+
+Device::~Device()
+{
+    close_fd();
+}
+
+Device::Device(Device &&other) noexcept
+    : fd_(other.fd_), sim_(other.sim_), err_(other.err_), node_(other.node_), cookie_(other.cookie_)
+{
+    other.fd_ = -1;
+    other.sim_ = false;
+    other.err_ = -1;
+}
+
+Device &Device::operator=(Device &&other) noexcept
+{
+    if (this != &other) {
+        close_fd();
+        fd_ = other.fd_;
+        sim_ = other.sim_;
+        err_ = other.err_;
+        node_ = other.node_;
+        cookie_ = other.cookie_;
+        other.fd_ = -1;
+        other.sim_ = false;
+        other.err_ = -1;
+    }
+    return *this;
+}
+
+void Device::close_fd()
+{
+    if (fd_ >= 0)
+        ::close(fd_);
+    fd_ = -1;
+}
+
+int Device::write_bytes(const void *buf, std::size_t len) const
+{
+    if (fd_ < 0)
+        return -EBADF;
+
+    // 쿠키는 pwrite 의 offset 으로 드라이버까지 간다 (드라이버는 offset 을 데이터에 쓰지 않는다)
+    ssize_t ret = cookie_ ? ::pwrite(fd_, buf, len, static_cast<off_t>(cookie_)) : ::write(fd_, buf, len);
+    if (ret < 0)
+        return -errno;
+    // 일부만 쓰였으면 호출한 쪽이 섀도에 남기지 않도록 실패로 알린다
+    if (static_cast<std::size_t>(ret) != len)
+        return -EIO;
+    return 0;
+}
+
+int Device::read_bytes(void *buf, std::size_t len) const
+{
+    if (fd_ < 0)
+        return -EBADF;
+
+    ssize_t ret = ::read(fd_, buf, len);
+    if (ret < 0)
+        return -errno;
+    if (static_cast<std::size_t>(ret) != len)
+        return -EIO;
+    return 0;
+}
+
+/* ---------------------------------------------------------------------- */
+
+Led Led::open(Backend backend)
+{
+    return Led(kLedDevice, Access::ReadWrite, backend);
+}
+
+int Led::set(std::uint8_t value)
+{
+    if (sim()) {
+        sim_bus().write(kLedAddress, value);
+        return 0;
+    }
+    return write_bytes(&value, 1);
+}
+
+int Led::get(std::uint8_t &value)
+{
+    if (sim()) {
+        value = sim_bus().read(kLedAddress);
+        return 0;
+    }
+    return read_bytes(&value, 1);
+}
+
+Fnd Fnd::open(Backend backend)
+{
+    return Fnd(kFndDevice, Access::ReadWrite, backend);
+}
+
+int Fnd::set(const FndDigits &digits)
+{
+    if (sim()) {
+        // fpga_fnd_driver.c 와 같은 방식으로 두 자리씩 한 레지스터에 묶는다
+        sim_bus().write(kFnd1Address, (digits[0] & 0x0F) << 4 | (digits[1] & 0x0F));
+        sim_bus().write(kFnd2Address, (digits[2] & 0x0F) << 4 | (digits[3] & 0x0F));
+        return 0;
+    }
+    return write_bytes(digits.data(), digits.size());
+}
+
+int Fnd::set_number(unsigned number)
+{
+    FndDigits digits;
+
+    number %= 10000;
+    for (std::size_t i = kFndDigits; i-- > 0; number /= 10)
+        digits[i] = number % 10;
+    return set(digits);
+}
+
+int Fnd::get(FndDigits &digits)
+{
+    if (sim()) {
+        std::uint8_t data1 = sim_bus().read(kFnd1Address);
+        std::uint8_t data2 = sim_bus().read(kFnd2Address);
+        digits = {std::uint8_t(data1 >> 4), std::uint8_t(data1 & 0x0F),
+                  std::uint8_t(data2 >> 4), std::uint8_t(data2 & 0x0F)};
+        return 0;
+    }
+    return read_bytes(digits.data(), digits.size());
+}
+
+Dot Dot::open(Backend backend)
+{
+    return Dot(kDotDevice, Access::Write, backend);
+}
+
+int Dot::set(const DotFrame &frame)
+{
+    if (sim()) {
+        for (std::size_t i = 0; i < frame.size(); i++)
+            sim_bus().write(kDotAddress + i, frame[i] & 0x7F);
+        return 0;
+    }
+    if (mode_ != FPGA_DOT_RAW) {
+        int ret = set_mode(FPGA_DOT_RAW, 0);
+        if (ret < 0)
+            return ret;
+    }
+    return write_bytes(frame.data(), frame.size());
+}
+
+int Dot::set_mode(std::uint32_t mode, unsigned step_ms)
+{
+    if (sim())
+        return -ENOTTY;
+    if (fd() < 0)
+        return -EBADF;
+
+    fpga_dot_mode req{};
+    req.mode = mode;
+    req.step_ms = step_ms;
+    if (::ioctl(fd(), FPGA_IOC_DOT_MODE, &req) < 0)
+        return -errno;
+    mode_ = mode;
+    return 0;
+}
+
+int Dot::show_char(char c)
+{
+    if (mode_ != FPGA_DOT_TEXT) {
+        int ret = set_mode(FPGA_DOT_TEXT, 0);
+        if (ret < 0)
+            return ret;
+    }
+    return write_bytes(&c, 1);
+}
+
+int Dot::scroll(std::string_view text, unsigned step_ms)
+{
+    if (text.empty() || text.size() > FPGA_DOT_SCROLL_MAX)
+        return -EINVAL;
+    // 간격이 바뀔 수 있으므로 매번 모드를 다시 고른다
+    int ret = set_mode(FPGA_DOT_SCROLL, step_ms);
+    if (ret < 0)
+        return ret;
+    return write_bytes(text.data(), text.size());
+}
+
+int Dot::upload_glyph(std::uint8_t code, const DotFrame &rows)
+{
+    if (sim())
+        return -ENOTTY;
+    if (fd() < 0)
+        return -EBADF;
+
+    fpga_dot_glyph req{};
+    req.code = code;
+    std::memcpy(req.rows, rows.data(), rows.size());
+    if (::ioctl(fd(), FPGA_IOC_DOT_GLYPH, &req) < 0)
+        return -errno;
+    return 0;
+}
+
+TextLcdBuffer make_text_lcd(std::string_view line1, std::string_view line2)
+{
+    TextLcdBuffer text;
+
+    text.fill(' ');
+    std::memcpy(text.data(), line1.data(), std::min(line1.size(), kTextLcdLine));
+    std::memcpy(text.data() + kTextLcdLine, line2.data(), std::min(line2.size(), kTextLcdLine));
+    return text;
+}
+
+TextLcd TextLcd::open(Backend backend)
+{
+    return TextLcd(kTextLcdDevice, Access::Write, backend);
+}
+
+int TextLcd::set(const TextLcdBuffer &text)
+{
+    if (sim()) {
+        for (std::size_t i = 0; i < text.size(); i++)
+            sim_bus().write(kTextLcdAddress + i, static_cast<std::uint8_t>(text[i]));
+        return 0;
+    }
+    return write_bytes(text.data(), text.size());
+}
+
+int TextLcd::set_lines(std::string_view line1, std::string_view line2)
+{
+    return set(make_text_lcd(line1, line2));
+}
+
+Buzzer Buzzer::open(Backend backend)
+{
+    return Buzzer(kBuzzerDevice, Access::ReadWrite, backend);
+}
+
+int Buzzer::set(bool on)
+{
+    std::uint8_t value = on ? 1 : 0;
+
+    if (sim()) {
+        sim_bus().write(kBuzzerAddress, value);
+        return 0;
+    }
+    return write_bytes(&value, 1);
+}
+
+PushSwitch PushSwitch::open(Backend backend)
+{
+    return PushSwitch(kPushSwitchDevice, Access::Read, backend);
+}
+
+int PushSwitch::get(PushSwitchState &state)
+{
+    if (sim()) {
+        for (std::size_t i = 0; i < state.size(); i++)
+            state[i] = sim_bus().read(kPushSwitchAddress + i);
+        return 0;
+    }
+    return read_bytes(state.data(), state.size());
+}
+
+DipSwitch DipSwitch::open(Backend backend)
+{
+    return DipSwitch(kDipSwitchDevice, Access::Read, backend);
+}
+
+int DipSwitch::get(std::uint8_t &value)
+{
+    if (sim()) {
+        value = sim_bus().read(kDipSwitchAddress);
+        return 0;
+    }
+    return read_bytes(&value, 1);
+}
+
+StepMotor StepMotor::open(Backend backend)
+{
+    return StepMotor(kStepMotorDevice, Access::Write, backend);
+}
+
+int StepMotor::set(bool on, bool right, std::uint8_t speed)
+{
+    std::uint8_t state[3] = {std::uint8_t(on), std::uint8_t(right), speed};
+
+    if (sim()) {
+        sim_bus().write(kStepMotorOnAddress, state[0] & 0xF);
+        sim_bus().write(kStepMotorDirAddress, state[1] & 0xF);
+        sim_bus().write(kStepMotorSpeedAddress, state[2]);
+        return 0;
+    }
+    return write_bytes(state, sizeof(state));
+}
+
+/* ---------------------------------------------------------------------- */
+
+StatusPage StatusPage::open(Backend backend)
+{
+    StatusPage status;
+
+    if (backend == Backend::Sim) {
+        status.sim_ = true;
+        status.err_ = 0;
+        return status;
+    }
+
+    int fd = ::open(kStatusDevice, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        status.err_ = -errno;
+        return status;
+    }
+    // 매핑은 fd 를 닫아도 남는다
+    void *page = ::mmap(nullptr, sysconf(_SC_PAGESIZE), PROT_READ, MAP_SHARED, fd, 0);
+    status.err_ = page == MAP_FAILED ? -errno : 0;
+    ::close(fd);
+    if (page == MAP_FAILED)
+        return status;
+
+    status.page_ = static_cast<const fpga_status *>(page);
+    if (status.page_->magic != FPGA_STATUS_MAGIC || status.page_->version != FPGA_STATUS_VERSION) {
+        status.unmap();
+        status.err_ = -EPROTO;
+    }
+    return status;
+}
+
+StatusPage::~StatusPage()
+{
+    unmap();
+}
+
+StatusPage::StatusPage(StatusPage &&other) noexcept
+    : page_(other.page_), sim_(other.sim_), err_(other.err_)
+{
+    other.page_ = nullptr;
+    other.sim_ = false;
+    other.err_ = -1;
+}
+
+StatusPage &StatusPage::operator=(StatusPage &&other) noexcept
+{
+    if (this != &other) {
+        unmap();
+        page_ = other.page_;
+        sim_ = other.sim_;
+        err_ = other.err_;
+        other.page_ = nullptr;
+        other.sim_ = false;
+        other.err_ = -1;
+    }
+    return *this;
+}
+
+void StatusPage::unmap()
+{
+    if (page_)
+        ::munmap(const_cast<fpga_status *>(page_), sysconf(_SC_PAGESIZE));
+    page_ = nullptr;
+}
+
+int StatusPage::snapshot(fpga_status &status) const
+{
+    if (sim_) {
+        // 시뮬레이터 레지스터로 같은 모양을 만든다 (카운터와 시각은 없음)
+        const SimBus &bus = sim_bus();
+        std::memset(&status, 0, sizeof(status));
+        status.magic = FPGA_STATUS_MAGIC;
+        status.version = FPGA_STATUS_VERSION;
+        status.size = sizeof(status);
+        status.dip_switch = bus.peek(kDipSwitchAddress);
+        for (unsigned i = 0; i < sizeof(status.fnd); i++)
+            status.fnd[i] = bus.peek(kFnd1Address + i);
+        for (unsigned i = 0; i < sizeof(status.step_motor); i++)
+            status.step_motor[i] = bus.peek(kStepMotorOnAddress + i);
+        status.led = bus.peek(kLedAddress);
+        for (unsigned i = 0; i < sizeof(status.push_switch); i++)
+            status.push_switch[i] = bus.peek(kPushSwitchAddress + i);
+        status.buzzer = bus.peek(kBuzzerAddress);
+        for (unsigned i = 0; i < sizeof(status.text_lcd); i++)
+            status.text_lcd[i] = bus.peek(kTextLcdAddress + i);
+        for (unsigned i = 0; i < sizeof(status.dot); i++)
+            status.dot[i] = bus.peek(kDotAddress + i);
+        return 0;
+    }
+    if (!page_)
+        return -EBADF;
+
+    // 커널이 고치는 중(홀수)이거나 복사하는 동안 seq 가 바뀌었으면 다시 읽는다
+    unsigned seq;
+    do {
+        seq = __atomic_load_n(&page_->seq, __ATOMIC_ACQUIRE);
+        std::memcpy(&status, page_, sizeof(status));
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    } while ((seq & 1) || seq != __atomic_load_n(&page_->seq, __ATOMIC_RELAXED));
+    return 0;
+}
+
+/* ---------------------------------------------------------------------- */
+
+std::size_t encode_batch(const Batch &batch, unsigned mask, fpga_cmd *cmds)
+{
+    std::size_t n = 0;
+
+    auto add = [&](std::uint8_t device, const void *data, std::size_t len) {
+        fpga_cmd &cmd = cmds[n++];
+        std::memset(&cmd, 0, offsetof(fpga_cmd, data));
+        cmd.cookie = batch.cookie;
+        cmd.device = device;
+        cmd.len = std::uint8_t(len);
+        std::memcpy(cmd.data, data, len);
+    };
+
+    // 데이터는 각 드라이버의 write() 와 같은 형식이다
+    if (mask & Batch::kLed)
+        add(FPGA_CMD_LED, &batch.led, 1);
+    if (mask & Batch::kFnd)
+        add(FPGA_CMD_FND, batch.fnd.data(), batch.fnd.size());
+    if (mask & Batch::kDot)
+        add(FPGA_CMD_DOT, batch.dot.data(), batch.dot.size());
+    if (mask & Batch::kTextLcd)
+        add(FPGA_CMD_TEXT_LCD, batch.text_lcd.data(), batch.text_lcd.size());
+    if (mask & Batch::kBuzzer) {
+        std::uint8_t value = batch.buzzer ? 1 : 0;
+        add(FPGA_CMD_BUZZER, &value, 1);
+    }
+    return n;
+}
+
+Board::Board(Backend backend, unsigned devices)
+    : requested_(devices & Batch::kAll), ioctl_(backend == Backend::Device),
+      kernel_scenes_(backend == Backend::Device)
+{
+    if (requested_ & Batch::kLed) {
+        led_ = Led::open(backend);
+        if (led_.ok())
+            opened_ |= Batch::kLed;
+    }
+    if (requested_ & Batch::kFnd) {
+        fnd_ = Fnd::open(backend);
+        if (fnd_.ok())
+            opened_ |= Batch::kFnd;
+    }
+    if (requested_ & Batch::kDot) {
+        dot_ = Dot::open(backend);
+        if (dot_.ok())
+            opened_ |= Batch::kDot;
+    }
+    if (requested_ & Batch::kTextLcd) {
+        text_lcd_ = TextLcd::open(backend);
+        if (text_lcd_.ok())
+            opened_ |= Batch::kTextLcd;
+    }
+    if (requested_ & Batch::kBuzzer) {
+        buzzer_ = Buzzer::open(backend);
+        if (buzzer_.ok())
+            opened_ |= Batch::kBuzzer;
+    }
+}
+
+bool Board::ok() const
+{
+    return opened_ == requested_;
+}
+
+int Board::command_fd() const
+{
+    const Device *devices[] = {&led_, &fnd_, &dot_, &text_lcd_, &buzzer_};
+
+    for (const Device *device : devices) {
+        if (device->fd() >= 0)
+            return device->fd();
+    }
+    return -EBADF;
+}
+
+// todo 의 디바이스를 명령 배치 하나로 보낸다, 드라이버가 모르는 ioctl 이면 -ENOTTY
+int Board::submit_ioctl(const Batch &batch, unsigned todo)
+{
+    fpga_cmd cmds[5];
+    fpga_cmd_batch req{};
+    int fd = command_fd();
+
+    if (fd < 0)
+        return fd;
+    req.cmds = reinterpret_cast<std::uintptr_t>(cmds);
+    req.count = encode_batch(batch, todo, cmds);
+    if (::ioctl(fd, FPGA_IOC_SUBMIT, &req) < 0)
+        return -errno;
+    return 0;
+}
+
+int Board::submit(const Batch &batch)
+{
+    unsigned todo = batch.mask & opened_;
+    int written = 0;
+    int ret;
+
+    if (batch.mask & ~opened_)
+        return -ENODEV;
+
+    // 직전에 쓴 값과 같으면 버스 트랜잭션을 생략한다
+    if ((known_ & Batch::kLed) && shadow_.led == batch.led)
+        todo &= ~Batch::kLed;
+    if ((known_ & Batch::kFnd) && shadow_.fnd == batch.fnd)
+        todo &= ~Batch::kFnd;
+    if ((known_ & Batch::kDot) && shadow_.dot == batch.dot)
+        todo &= ~Batch::kDot;
+    if ((known_ & Batch::kTextLcd) && shadow_.text_lcd == batch.text_lcd)
+        todo &= ~Batch::kTextLcd;
+    if ((known_ & Batch::kBuzzer) && shadow_.buzzer == batch.buzzer)
+        todo &= ~Batch::kBuzzer;
+
+    skipped_ += __builtin_popcount(batch.mask & ~todo);
+    if (!todo)
+        return 0;
+
+    if (ioctl_) {
+        ret = submit_ioctl(batch, todo);
+        if (ret == 0) {
+            // 배치는 전부 쓰이거나 하나도 쓰이지 않는다
+            if (todo & Batch::kLed)
+                shadow_.led = batch.led;
+            if (todo & Batch::kFnd)
+                shadow_.fnd = batch.fnd;
+            if (todo & Batch::kDot)
+                shadow_.dot = batch.dot;
+            if (todo & Batch::kTextLcd)
+                shadow_.text_lcd = batch.text_lcd;
+            if (todo & Batch::kBuzzer)
+                shadow_.buzzer = batch.buzzer;
+            known_ |= todo;
+            return __builtin_popcount(todo);
+        }
+        if (ret != -ENOTTY)
+            goto fail;
+        // FPGA_IOC_SUBMIT 이 없는 드라이버: 이후로는 디바이스마다 write()
+        ioctl_ = false;
+    }
+
+    if (todo & Batch::kLed)
+        led_.set_trace_cookie(batch.cookie);
+    if (todo & Batch::kFnd)
+        fnd_.set_trace_cookie(batch.cookie);
+    if (todo & Batch::kDot)
+        dot_.set_trace_cookie(batch.cookie);
+    if (todo & Batch::kTextLcd)
+        text_lcd_.set_trace_cookie(batch.cookie);
+    if (todo & Batch::kBuzzer)
+        buzzer_.set_trace_cookie(batch.cookie);
+
+    if (todo & Batch::kLed) {
+        if ((ret = led_.set(batch.led)) < 0)
+            goto fail;
+        shadow_.led = batch.led;
+        known_ |= Batch::kLed;
+        written++;
+    }
+    if (todo & Batch::kFnd) {
+        if ((ret = fnd_.set(batch.fnd)) < 0)
+            goto fail;
+        shadow_.fnd = batch.fnd;
+        known_ |= Batch::kFnd;
+        written++;
+    }
+    if (todo & Batch::kDot) {
+        if ((ret = dot_.set(batch.dot)) < 0)
+            goto fail;
+        shadow_.dot = batch.dot;
+        known_ |= Batch::kDot;
+        written++;
+    }
+    if (todo & Batch::kTextLcd) {
+        if ((ret = text_lcd_.set(batch.text_lcd)) < 0)
+            goto fail;
+        shadow_.text_lcd = batch.text_lcd;
+        known_ |= Batch::kTextLcd;
+        written++;
+    }
+    if (todo & Batch::kBuzzer) {
+        if ((ret = buzzer_.set(batch.buzzer)) < 0)
+            goto fail;
+        shadow_.buzzer = batch.buzzer;
+        known_ |= Batch::kBuzzer;
+        written++;
+    }
+    return written;
+
+fail:
+    // 실패한 디바이스는 실제 상태를 알 수 없으므로 섀도를 버린다
+    known_ &= ~todo;
+    return ret;
+}
+
+Board::Scene *Board::find_scene(std::string_view name)
+{
+    for (Scene &scene : scenes_) {
+        if (name == scene.name)
+            return &scene;
+    }
+    return nullptr;
+}
+
+int Board::scene_ioctl(unsigned long request, const Scene &scene, std::uint64_t cookie)
+{
+    fpga_cmd cmds[5];
+    fpga_scene req{};
+    int fd = command_fd();
+    int ret;
+
+    if (fd < 0)
+        return fd;
+    std::memcpy(req.name, scene.name, sizeof(req.name));
+    if (request == FPGA_IOC_SCENE_SET) {
+        req.cmds = reinterpret_cast<std::uintptr_t>(cmds);
+        req.count = encode_batch(scene.batch, scene.batch.mask, cmds);
+    }
+    req.cookie = cookie;
+    ret = ::ioctl(fd, request, &req);
+    return ret < 0 ? -errno : ret;
+}
+
+int Board::upload_scene(std::string_view name, const Batch &batch)
+{
+    Scene scene{};
+
+    if (name.empty() || name.size() >= sizeof(scene.name))
+        return -ENAMETOOLONG;
+    if (!batch.mask)
+        return -EINVAL;
+    if (batch.mask & ~opened_)
+        return -ENODEV;
+    name.copy(scene.name, name.size());
+    scene.batch = batch;
+    scene.batch.cookie = 0;
+
+    if (kernel_scenes_) {
+        int ret = scene_ioctl(FPGA_IOC_SCENE_SET, scene, 0);
+        // 장면을 모르는 드라이버: submit() 으로 대신한다
+        if (ret == -ENOTTY)
+            kernel_scenes_ = false;
+        else if (ret < 0)
+            return ret;
+    }
+
+    if (Scene *old = find_scene(name))
+        *old = scene;
+    else
+        scenes_.push_back(scene);
+    return 0;
+}
+
+int Board::activate_scene(std::string_view name, std::uint64_t cookie)
+{
+    Scene *scene = find_scene(name);
+    unsigned mask;
+    int ret;
+
+    if (!scene)
+        return -ENOENT;
+    mask = scene->batch.mask;
+
+    if (!kernel_scenes_) {
+        Batch tagged = scene->batch;
+        tagged.cookie = cookie;
+        return submit(tagged);
+    }
+
+    ret = scene_ioctl(FPGA_IOC_SCENE_ACTIVATE, *scene, cookie);
+    // 인터페이스 드라이버를 다시 올리면 장면이 사라진다, 한 번 다시 올리고 재시도
+    if (ret == -ENOENT) {
+        ret = scene_ioctl(FPGA_IOC_SCENE_SET, *scene, 0);
+        if (ret == 0)
+            ret = scene_ioctl(FPGA_IOC_SCENE_ACTIVATE, *scene, cookie);
+    }
+    if (ret < 0) {
+        known_ &= ~mask;
+        return ret;
+    }
+
+    // 커널이 버스와 비교해서 보냈으므로 장면의 디바이스는 이제 장면 값이다
+    if (mask & Batch::kLed)
+        shadow_.led = scene->batch.led;
+    if (mask & Batch::kFnd)
+        shadow_.fnd = scene->batch.fnd;
+    if (mask & Batch::kDot)
+        shadow_.dot = scene->batch.dot;
+    if (mask & Batch::kTextLcd)
+        shadow_.text_lcd = scene->batch.text_lcd;
+    if (mask & Batch::kBuzzer)
+        shadow_.buzzer = scene->batch.buzzer;
+    known_ |= mask;
+    if (!ret)
+        skipped_ += __builtin_popcount(mask);
+    return ret;
+}
+
+} // namespace fpga
@@ -0,0 +1,410 @@
+/*
+ * libfpga - user space client library for the FPGA peripherals
+ *
+ * Every peripheral driver (/dev/fpga_led, /dev/fpga_fnd, ...) gets an RAII
+ * handle that opens the node once and closes it on destruction. Write and
+ * read calls work on fixed size buffers on the stack, so the hot path makes
+ * no heap allocations.
+ *
+ * Two backends are available:
+ * - Backend::Device : the real character devices under /dev.
+ * - Backend::Sim    : an in-process register file that performs the same
+ *                     bus writes as the kernel drivers. Used for benchmarks
+ *                     and for running the pipeline without the FPGA board.
+ * FPGA_BACKEND=sim in the environment selects the simulator by default.
+ *
+ * Latency tracing: a non-zero trace cookie (Batch::cookie, usually the
+ * pipeline's frame id) is passed to the drivers as the pwrite() offset. The
+ * k6 drivers ignore the offset for the data and report it in the
+ * fpga:fpga_dev_write tracepoint, so a kernel trace can be joined with the
+ * frame that caused each write.
+ *
+ * Device commands: when the k6 drivers support FPGA_IOC_SUBMIT
+ * (fpga_ioctl.h), Board::submit() sends all changed devices of a Batch in
+ * one ioctl instead of one write() per device, and the kernel puts their
+ * register writes on the bus as one batch. Older drivers answer -ENOTTY and
+ * the Board keeps using write() from then on. fpga_uring.hpp submits the
+ * same commands through io_uring.
+ *
+ * Scenes: Board::upload_scene() stores a named Batch in the kernel
+ * (FPGA_IOC_SCENE_SET) and activate_scene() switches to it with one ioctl;
+ * the kernel sends only the registers that differ from the bus. Without
+ * kernel scenes (old drivers, Backend::Sim) activation falls back to
+ * submit() of the stored Batch.
+ *
+ * Dot text: Dot::show_char() and Dot::scroll() let the dot driver render
+ * characters from its kernel glyph cache (FPGA_IOC_DOT_MODE) and push only
+ * the rows that change; a scrolling string keeps running in the kernel
+ * without further syscalls. set() switches the driver back to raw rows.
+ *
+ * StatusPage maps the interface driver's status page (/dev/fpga_status)
+ * and reads the last bus value of every peripheral without a syscall.
+ *
+ * Errors are reported as return codes: 0 on success, -errno on failure.
+ */
+#ifndef FPGA_HPP
+#define FPGA_HPP
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+#include "fpga_font.hpp"
+#include "../example/fpga_interface_driver_k6/fpga_ioctl.h"
+#include "../example/fpga_interface_driver_k6/fpga_status.h"
+
+namespace fpga {
+
+/* 디바이스 노드 경로 (mknodall.sh 참고) */
+constexpr const char *kLedDevice = "/dev/fpga_led";
+constexpr const char *kFndDevice = "/dev/fpga_fnd";
+constexpr const char *kDotDevice = "/dev/fpga_dot";
+constexpr const char *kTextLcdDevice = "/dev/fpga_text_lcd";
+constexpr const char *kBuzzerDevice = "/dev/fpga_buzzer";
+constexpr const char *kPushSwitchDevice = "/dev/fpga_push_switch";
+constexpr const char *kDipSwitchDevice = "/dev/fpga_dip_switch";
+constexpr const char *kStepMotorDevice = "/dev/fpga_step_motor";
+constexpr const char *kStatusDevice = "/dev/fpga_status";
+
+/* 각 드라이버가 사용하는 FPGA 물리 주소 */
+constexpr unsigned kDipSwitchAddress = 0x000;
+constexpr unsigned kFnd1Address = 0x003;
+constexpr unsigned kFnd2Address = 0x004;
+constexpr unsigned kStepMotorOnAddress = 0x00C;
+constexpr unsigned kStepMotorDirAddress = 0x00E;
+constexpr unsigned kStepMotorSpeedAddress = 0x010;
+constexpr unsigned kLedAddress = 0x016;
+constexpr unsigned kPushSwitchAddress = 0x050;
+constexpr unsigned kBuzzerAddress = 0x070;
+constexpr unsigned kTextLcdAddress = 0x090;
+constexpr unsigned kDotAddress = 0x210;
+
+constexpr std::size_t kFndDigits = 4;
+constexpr std::size_t kTextLcdLine = 16;
+constexpr std::size_t kTextLcdSize = 32;
+constexpr std::size_t kPushSwitchButtons = 9;
+
+using FndDigits = std::array<std::uint8_t, kFndDigits>;
+using TextLcdBuffer = std::array<char, kTextLcdSize>;
+using PushSwitchState = std::array<std::uint8_t, kPushSwitchButtons>;
+
+enum class Backend { Device, Sim };
+
+// FPGA_BACKEND 환경 변수로 기본 백엔드를 고른다 ("sim" 이면 시뮬레이터)
+Backend default_backend();
+
+/*
+ * Simulated FPGA bus. Holds the 11-bit register space behind the interface
+ * driver and counts bus transactions, one per iom_fpga_itf_write/read.
+ */
+class SimBus {
+public:
+    static constexpr unsigned kAddressSpace = 1u << 11;
+
+    void write(unsigned addr, std::uint8_t value);
+    std::uint8_t read(unsigned addr);
+    // 읽기 횟수를 세지 않고 레지스터 값만 본다
+    std::uint8_t peek(unsigned addr) const;
+
+    std::uint64_t writes() const { return writes_.load(std::memory_order_relaxed); }
+    std::uint64_t reads() const { return reads_.load(std::memory_order_relaxed); }
+    void reset();
+
+private:
+    std::array<std::atomic<std::uint8_t>, kAddressSpace> regs_{};
+    std::atomic<std::uint64_t> writes_{0};
+    std::atomic<std::uint64_t> reads_{0};
+};
+
+SimBus &sim_bus();
+
+enum class Access { Read, Write, ReadWrite };
+
+/*
+ * RAII handle owning one opened device node (move only). A default
+ * constructed handle is closed; use the open() factory of each peripheral.
+ */
+class Device {
+public:
+    Device() = default;
+    ~Device();
+
+    Device(Device &&other) noexcept;
+    Device &operator=(Device &&other) noexcept;
+    Device(const Device &) = delete;
+    Device &operator=(const Device &) = delete;
+
+    bool ok() const { return sim_ || fd_ >= 0; }
+    bool sim() const { return sim_; }
+    int error() const { return err_; }
+    int fd() const { return fd_; }
+    const char *node() const { return node_; }
+
+    // 다음 write 들에 붙일 추적 쿠키 (0: 쿠키 없이 보통 write)
+    void set_trace_cookie(std::uint64_t cookie) { cookie_ = cookie; }
+
+protected:
+    Device(const char *node, Access access, Backend backend);
+
+    int write_bytes(const void *buf, std::size_t len) const;
+    int read_bytes(void *buf, std::size_t len) const;
+
+private:
+    void close_fd();
+
+    int fd_ = -1;
+    bool sim_ = false;
+    int err_ = -1;
+    const char *node_ = nullptr;
+    std::uint64_t cookie_ = 0;
+};
+
+class Led : public Device {
+public:
+    Led() = default;
+    static Led open(Backend backend = default_backend());
+    int set(std::uint8_t value);
+    int get(std::uint8_t &value);
+
+private:
+    using Device::Device;
+};
+
+class Fnd : public Device {
+public:
+    Fnd() = default;
+    static Fnd open(Backend backend = default_backend());
+    int set(const FndDigits &digits);
+    // 0~9999 를 오른쪽 정렬로 표시
+    int set_number(unsigned number);
+    int get(FndDigits &digits);
+
+private:
+    using Device::Device;
+};
+
+class Dot : public Device {
+public:
+    Dot() = default;
+    static Dot open(Backend backend = default_backend());
+    int set(const DotFrame &frame);
+    int show_digit(int digit) { return set(dot_digit(digit)); }
+    int clear() { return set(kDotBlank); }
+
+    // 드라이버의 글리프 캐시로 그린다 (FPGA_IOC_DOT_MODE, 오래된 드라이버와 Sim 은 -ENOTTY)
+    int show_char(char c);
+    // FPGA_DOT_SCROLL_MAX 자까지, 커널이 step_ms 마다 한 열씩 민다 (0: 드라이버 기본값)
+    int scroll(std::string_view text, unsigned step_ms = 0);
+    // code 의 글리프를 바꾼다, 모듈을 다시 올릴 때까지 유지된다
+    int upload_glyph(std::uint8_t code, const DotFrame &rows);
+
+private:
+    using Device::Device;
+
+    int set_mode(std::uint32_t mode, unsigned step_ms);
+
+    std::uint32_t mode_ = FPGA_DOT_RAW;
+};
+
+class TextLcd : public Device {
+public:
+    TextLcd() = default;
+    static TextLcd open(Backend backend = default_backend());
+    int set(const TextLcdBuffer &text);
+    // 두 줄을 각각 16자로 자르고 남는 칸은 공백으로 채운다
+    int set_lines(std::string_view line1, std::string_view line2);
+
+private:
+    using Device::Device;
+};
+
+class Buzzer : public Device {
+public:
+    Buzzer() = default;
+    static Buzzer open(Backend backend = default_backend());
+    int set(bool on);
+
+private:
+    using Device::Device;
+};
+
+class PushSwitch : public Device {
+public:
+    PushSwitch() = default;
+    static PushSwitch open(Backend backend = default_backend());
+    int get(PushSwitchState &state);
+
+private:
+    using Device::Device;
+};
+
+class DipSwitch : public Device {
+public:
+    DipSwitch() = default;
+    static DipSwitch open(Backend backend = default_backend());
+    int get(std::uint8_t &value);
+
+private:
+    using Device::Device;
+};
+
+class StepMotor : public Device {
+public:
+    StepMotor() = default;
+    static StepMotor open(Backend backend = default_backend());
+    int set(bool on, bool right, std::uint8_t speed);
+
+private:
+    using Device::Device;
+};
+
+TextLcdBuffer make_text_lcd(std::string_view line1, std::string_view line2);
+
+/*
+ * Read-only mapping of the interface driver's status page (fpga_status.h):
+ * the last bus value of every peripheral register with an update counter
+ * and timestamp per peripheral. snapshot() copies a consistent page under
+ * its seqcount, with no syscall and no bus traffic, so it can be called at
+ * any rate. On Backend::Sim the registers come from the simulated bus and
+ * the counters stay 0.
+ */
+class StatusPage {
+public:
+    StatusPage() = default;
+    ~StatusPage();
+
+    StatusPage(StatusPage &&other) noexcept;
+    StatusPage &operator=(StatusPage &&other) noexcept;
+    StatusPage(const StatusPage &) = delete;
+    StatusPage &operator=(const StatusPage &) = delete;
+
+    static StatusPage open(Backend backend = default_backend());
+
+    bool ok() const { return sim_ || page_ != nullptr; }
+    int error() const { return err_; }
+
+    int snapshot(fpga_status &status) const;
+
+private:
+    void unmap();
+
+    const fpga_status *page_ = nullptr;
+    bool sim_ = false;
+    int err_ = -1;
+};
+
+/*
+ * Desired state for several output devices at once. Only the devices whose
+ * bit is set in 'mask' are touched by Board::submit().
+ */
+struct Batch {
+    enum : unsigned {
+        kLed = 1u << 0,
+        kFnd = 1u << 1,
+        kDot = 1u << 2,
+        kTextLcd = 1u << 3,
+        kBuzzer = 1u << 4,
+        kAll = kLed | kFnd | kDot | kTextLcd | kBuzzer,
+    };
+
+    unsigned mask = 0;
+    std::uint8_t led = 0;
+    FndDigits fnd{};
+    DotFrame dot{};
+    TextLcdBuffer text_lcd{};
+    bool buzzer = false;
+    std::uint64_t cookie = 0; // 드라이버 tracepoint 에 남길 추적 쿠키 (0: 없음, 2^63 미만)
+
+    Batch &set_led(std::uint8_t v) { led = v; mask |= kLed; return *this; }
+    Batch &set_fnd(const FndDigits &v) { fnd = v; mask |= kFnd; return *this; }
+    Batch &set_dot(const DotFrame &v) { dot = v; mask |= kDot; return *this; }
+    Batch &set_text_lcd(const TextLcdBuffer &v) { text_lcd = v; mask |= kTextLcd; return *this; }
+    Batch &set_buzzer(bool v) { buzzer = v; mask |= kBuzzer; return *this; }
+};
+
+/*
+ * Convert the devices of 'mask' in a Batch into FPGA_IOC_SUBMIT commands,
+ * each tagged with batch.cookie. 'cmds' needs room for 5 commands. Returns
+ * the number of commands filled in.
+ */
+std::size_t encode_batch(const Batch &batch, unsigned mask, fpga_cmd *cmds);
+
+/*
+ * All output devices used by the detection pipeline, opened once.
+ * submit() applies a Batch and skips devices whose last written value is
+ * already equal to the requested one, so repeated decisions cost no bus
+ * traffic.
+ */
+class Board {
+public:
+    explicit Board(Backend backend = default_backend(), unsigned devices = Batch::kAll);
+
+    // 요청한 디바이스가 모두 열렸으면 true
+    bool ok() const;
+    unsigned opened() const { return opened_; }
+
+    // 성공하면 실제로 쓴 디바이스 수, 실패하면 -errno
+    int submit(const Batch &batch);
+    // 섀도 상태를 무효화해서 다음 submit 이 모든 디바이스를 다시 쓰게 한다
+    void invalidate() { known_ = 0; }
+
+    const Batch &shadow() const { return shadow_; }
+    std::uint64_t skipped() const { return skipped_; }
+
+    // submit() 가 FPGA_IOC_SUBMIT 한 번으로 보내는지 (드라이버가 지원하지 않으면 false)
+    bool uses_ioctl() const { return ioctl_; }
+    // 명령 배치를 받을 fd (열린 출력 디바이스 아무거나), 없으면 -EBADF
+    int command_fd() const;
+
+    /*
+     * Store 'batch' as scene 'name' (shorter than FPGA_SCENE_NAME) in the
+     * kernel, replacing a scene of the same name. The Board keeps a copy
+     * to update its shadow on activation, so this allocates; call it at
+     * setup, not per frame. activate_scene() makes the devices of the
+     * scene show its state with one ioctl and returns the number of
+     * register writes the kernel needed (devices written when it falls
+     * back to submit()), or -errno.
+     */
+    int upload_scene(std::string_view name, const Batch &batch);
+    int activate_scene(std::string_view name, std::uint64_t cookie = 0);
+    // activate_scene() 이 커널 장면으로 처리되는지
+    bool uses_kernel_scenes() const { return kernel_scenes_; }
+
+    Led &led() { return led_; }
+    Fnd &fnd() { return fnd_; }
+    Dot &dot() { return dot_; }
+    TextLcd &text_lcd() { return text_lcd_; }
+    Buzzer &buzzer() { return buzzer_; }
+
+private:
+    struct Scene {
+        char name[FPGA_SCENE_NAME];
+        Batch batch;
+    };
+
+    int submit_ioctl(const Batch &batch, unsigned todo);
+    int scene_ioctl(unsigned long request, const Scene &scene, std::uint64_t cookie);
+    Scene *find_scene(std::string_view name);
+
+    Led led_;
+    Fnd fnd_;
+    Dot dot_;
+    TextLcd text_lcd_;
+    Buzzer buzzer_;
+
+    unsigned requested_;
+    unsigned opened_ = 0;
+    unsigned known_ = 0;
+    bool ioctl_ = false;
+    bool kernel_scenes_ = false;
+    Batch shadow_;
+    std::vector<Scene> scenes_;
+    std::uint64_t skipped_ = 0;
+};
+
+} // namespace fpga
+
+#endif // FPGA_HPP
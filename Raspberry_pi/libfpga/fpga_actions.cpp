@@ -0,0 +1,275 @@
+/*
+ * Class -> device action table
+ */
+#include "fpga_actions.hpp"
+
+#include <cerrno>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+
+namespace fpga {
+
+const char kDefaultActions[] = R"(
+[dev1]
+dot = 1
+reset dot = 0
+
+[dev2]
+led = 2
+reset led = 0
+
+[dev3]
+text_lcd = "hello" "3"
+reset text_lcd = " " "0"
+
+[dev4]
+fnd = 4
+reset fnd = 0
+
+# buzzer 는 다른 클래스로 바뀌어도 끄지 않는다 (yolo_last.py 와 동일)
+[off]
+buzzer = off
+)";
+
+namespace {
+
+struct DeviceKey {
+    const char *name;
+    unsigned bit;
+};
+
+constexpr DeviceKey kDevices[] = {
+    {"led", Batch::kLed},
+    {"fnd", Batch::kFnd},
+    {"dot", Batch::kDot},
+    {"text_lcd", Batch::kTextLcd},
+    {"buzzer", Batch::kBuzzer},
+};
+
+// 공백으로 나누고 "..." 는 한 토큰으로 묶는다, 따옴표 밖의 '#' 부터는 주석
+bool tokenize(const std::string &line, std::vector<std::string> &tokens)
+{
+    tokens.clear();
+    std::size_t i = 0;
+
+    while (i < line.size()) {
+        char c = line[i];
+        if (c == ' ' || c == '\t' || c == '\r') {
+            i++;
+        } else if (c == '#') {
+            break;
+        } else if (c == '"') {
+            std::size_t end = line.find('"', i + 1);
+            if (end == std::string::npos)
+                return false;
+            tokens.push_back(line.substr(i + 1, end - i - 1));
+            i = end + 1;
+        } else if (c == '=') {
+            tokens.emplace_back("=");
+            i++;
+        } else {
+            std::size_t end = line.find_first_of(" \t\r#=\"", i);
+            if (end == std::string::npos)
+                end = line.size();
+            tokens.push_back(line.substr(i, end - i));
+            i = end;
+        }
+    }
+    return true;
+}
+
+bool parse_number(const std::string &token, long min, long max, long &value)
+{
+    char *end;
+    value = std::strtol(token.c_str(), &end, 0);
+    return !token.empty() && *end == '\0' && value >= min && value <= max;
+}
+
+// values 를 batch 의 해당 디바이스 값으로 옮긴다
+bool parse_value(unsigned bit, const std::vector<std::string> &values, Batch &batch)
+{
+    long v;
+
+    switch (bit) {
+    case Batch::kLed:
+        if (values.size() != 1 || !parse_number(values[0], 0, 255, v))
+            return false;
+        batch.set_led(std::uint8_t(v));
+        return true;
+    case Batch::kFnd: {
+        // fpga_fnd_set_digits 처럼 첫 자리부터 채운다
+        FndDigits digits{};
+        if (values.size() != 1 || values[0].empty() || values[0].size() > kFndDigits)
+            return false;
+        for (std::size_t i = 0; i < values[0].size(); i++) {
+            if (values[0][i] < '0' || values[0][i] > '9')
+                return false;
+            digits[i] = values[0][i] - '0';
+        }
+        batch.set_fnd(digits);
+        return true;
+    }
+    case Batch::kDot:
+        if (values.size() != 1)
+            return false;
+        if (values[0] == "blank")
+            batch.set_dot(kDotBlank);
+        else if (values[0] == "full")
+            batch.set_dot(kDotFull);
+        else if (parse_number(values[0], 0, 9, v))
+            batch.set_dot(dot_digit(int(v)));
+        else
+            return false;
+        return true;
+    case Batch::kTextLcd:
+        if (values.empty() || values.size() > 2)
+            return false;
+        batch.set_text_lcd(make_text_lcd(values[0], values.size() > 1 ? values[1] : std::string()));
+        return true;
+    case Batch::kBuzzer:
+        if (values.size() != 1)
+            return false;
+        if (values[0] == "on" || values[0] == "1")
+            batch.set_buzzer(true);
+        else if (values[0] == "off" || values[0] == "0")
+            batch.set_buzzer(false);
+        else
+            return false;
+        return true;
+    }
+    return false;
+}
+
+// src 에서 mask 에 해당하는 디바이스 값만 dst 로 옮긴다
+void merge(Batch &dst, const Batch &src, unsigned mask)
+{
+    mask &= src.mask;
+    if (mask & Batch::kLed)
+        dst.set_led(src.led);
+    if (mask & Batch::kFnd)
+        dst.set_fnd(src.fnd);
+    if (mask & Batch::kDot)
+        dst.set_dot(src.dot);
+    if (mask & Batch::kTextLcd)
+        dst.set_text_lcd(src.text_lcd);
+    if (mask & Batch::kBuzzer)
+        dst.set_buzzer(src.buzzer);
+}
+
+} // namespace
+
+int ActionTable::load(const std::string &path, const std::vector<std::string> &names)
+{
+    std::ifstream in(path);
+    if (!in)
+        return -ENOENT;
+
+    std::stringstream text;
+    text << in.rdbuf();
+    return parse(text.str(), names);
+}
+
+int ActionTable::parse(std::string_view text, const std::vector<std::string> &names)
+{
+    const int n = int(names.size());
+    std::vector<Batch> drive(n), reset(n);
+    std::vector<bool> seen(n, false);
+    std::vector<std::string> tokens, values;
+    std::istringstream in{std::string(text)};
+    std::string line;
+    std::vector<std::string> unknown;
+    int cls = -1;
+    bool skip = false; // 모델에 없는 클래스의 섹션
+
+    error_line_ = 0;
+    for (int lineno = 1; std::getline(in, line); lineno++) {
+        if (!tokenize(line, tokens)) {
+            error_line_ = lineno;
+            return -EINVAL;
+        }
+        if (tokens.empty())
+            continue;
+
+        // [클래스 이름]
+        if (tokens.size() == 1 && tokens[0].size() > 2 && tokens[0].front() == '[' && tokens[0].back() == ']') {
+            std::string name = tokens[0].substr(1, tokens[0].size() - 2);
+            cls = -1;
+            for (int i = 0; i < n; i++)
+                if (names[i] == name)
+                    cls = i;
+            if (cls >= 0 && seen[cls]) {
+                error_line_ = lineno;
+                return -EINVAL;
+            }
+            skip = cls < 0;
+            if (skip)
+                unknown.push_back(name);
+            else
+                seen[cls] = true;
+            continue;
+        }
+        if (skip)
+            continue;
+
+        // [reset] <device> = <value...>, 클래스 섹션 안에서만
+        std::size_t k = tokens[0] == "reset" ? 1 : 0;
+        unsigned bit = 0;
+        if (cls >= 0 && k + 1 < tokens.size() && tokens[k + 1] == "=") {
+            for (const DeviceKey &device : kDevices)
+                if (tokens[k] == device.name)
+                    bit = device.bit;
+        }
+        if (!bit) {
+            error_line_ = lineno;
+            return -EINVAL;
+        }
+        Batch &batch = k ? reset[cls] : drive[cls];
+        values.assign(tokens.begin() + k + 2, tokens.end());
+        if ((batch.mask & bit) || !parse_value(bit, values, batch)) {
+            error_line_ = lineno;
+            return -EINVAL;
+        }
+    }
+
+    // 모든 (이전 클래스, 새 클래스) 조합의 Batch 를 미리 만들어 둔다
+    std::vector<Batch> table((n + 1) * n);
+    std::vector<unsigned> drive_mask(n);
+    std::vector<std::string> devices(n);
+    for (int c = 0; c < n; c++) {
+        drive_mask[c] = drive[c].mask;
+        for (const DeviceKey &device : kDevices) {
+            if (drive[c].mask & device.bit)
+                devices[c] += (devices[c].empty() ? "" : "+") + std::string(device.name);
+        }
+        if (devices[c].empty())
+            devices[c] = "none";
+    }
+    for (int prev = -1; prev < n; prev++) {
+        for (int c = 0; c < n; c++) {
+            Batch &batch = table[(prev + 1) * n + c];
+            if (prev >= 0 && prev != c)
+                merge(batch, reset[prev], ~drive[c].mask);
+            merge(batch, drive[c], Batch::kAll);
+        }
+    }
+    // 장면: 자기 디바이스 + 나머지 디바이스의 리셋 값 (먼저 나온 클래스의 값)
+    std::vector<Batch> scenes(n);
+    for (int c = 0; c < n; c++) {
+        merge(scenes[c], drive[c], Batch::kAll);
+        for (int other = 0; other < n; other++) {
+            if (other != c)
+                merge(scenes[c], reset[other], ~scenes[c].mask);
+        }
+    }
+
+    classes_ = n;
+    table_ = std::move(table);
+    scenes_ = std::move(scenes);
+    drive_mask_ = std::move(drive_mask);
+    devices_ = std::move(devices);
+    unknown_ = std::move(unknown);
+    return 0;
+}
+
+} // namespace fpga
@@ -0,0 +1,95 @@
+/*
+ * Class -> device action table
+ *
+ * A small text config says what each detected class does to the output
+ * devices and how those devices are cleared again when another class takes
+ * over. load() compiles it into one prebuilt Batch per (previous class,
+ * new class) transition, so applying a decision is one table lookup and
+ * one Board::submit(), with no branching on device types.
+ *
+ *     # comment
+ *     [dev1]                  class name from the model
+ *     dot = 1                 driven while the class is active
+ *     reset dot = 0           written when another class takes over
+ *
+ *     [dev3]
+ *     text_lcd = "hello" "3"
+ *     reset text_lcd = " " "0"
+ *
+ * Devices and values:
+ *     led      = 0~255 (0x.. allowed)
+ *     fnd      = 1~4 digits, filled with 0 on the right ("4" -> 4 0 0 0)
+ *     dot      = 0~9 | blank | full
+ *     text_lcd = "line 1" ["line 2"]
+ *     buzzer   = on | off
+ *
+ * A class may drive several devices. On a transition the reset values of
+ * the previous class are written only for devices the new class does not
+ * drive itself. Classes without a section are ignored; sections for names
+ * the model does not have are skipped and listed by unknown_classes() so
+ * the caller can warn about typos.
+ *
+ * scene(cls) is the complete state the class stands for: its own devices
+ * plus the reset values (of any class) for the devices it does not drive.
+ * It is meant for Board::upload_scene(), where the kernel diff against the
+ * bus replaces the per-transition tables.
+ *
+ * load() leaves the current table untouched when the file has an error, so
+ * a bad edit during a hot reload keeps the old mapping running.
+ *
+ * Errors follow the rest of libfpga: 0 on success, -errno on failure.
+ */
+#ifndef FPGA_ACTIONS_HPP
+#define FPGA_ACTIONS_HPP
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "fpga.hpp"
+
+namespace fpga {
+
+// yolo_last.py 의 원래 class_map 과 같은 설정 (설정 파일이 없을 때 쓴다)
+extern const char kDefaultActions[];
+
+class ActionTable {
+public:
+    // names: 모델의 클래스 이름 (클래스 번호 순서)
+    int load(const std::string &path, const std::vector<std::string> &names);
+    int parse(std::string_view text, const std::vector<std::string> &names);
+
+    bool has(int cls) const { return cls >= 0 && cls < classes_ && drive_mask_[cls] != 0; }
+
+    // prev 가 -1 이면 아직 아무 클래스도 없던 상태
+    const Batch &transition(int prev, int cls) const { return table_[(prev + 1) * classes_ + cls]; }
+
+    // 구동하는 디바이스 조합이 바뀌는 전환인지 (디바이스 전환 횟수 통계용)
+    bool switches(int prev, int cls) const
+    {
+        return prev < 0 || drive_mask_[prev] != drive_mask_[cls];
+    }
+
+    // 클래스가 켜져 있을 때의 전체 상태 (다른 디바이스는 리셋 값)
+    const Batch &scene(int cls) const { return scenes_[cls]; }
+
+    // "dot", "led+fnd" 처럼 클래스가 구동하는 디바이스 이름
+    const std::string &devices(int cls) const { return devices_[cls]; }
+
+    int classes() const { return classes_; }
+    int error_line() const { return error_line_; }
+    const std::vector<std::string> &unknown_classes() const { return unknown_; }
+
+private:
+    int classes_ = 0;
+    std::vector<Batch> table_;        // [(prev + 1) * classes_ + cls]
+    std::vector<Batch> scenes_;       // [cls]
+    std::vector<unsigned> drive_mask_; // [cls]
+    std::vector<std::string> devices_; // [cls]
+    std::vector<std::string> unknown_;
+    int error_line_ = 0;
+};
+
+} // namespace fpga
+
+#endif // FPGA_ACTIONS_HPP
@@ -0,0 +1,112 @@
+/* libfpga per-call overhead microbenchmark
+File : fpga_bench.cpp
+
+Usage: fpga_bench [sim|dev] [iterations]
+
+Times each device operation in a tight loop and prints ns/call, bus
+transactions per call (sim backend) and the number of heap allocations
+made inside the timed loop, which must stay 0. */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+#include "fpga.hpp"
+
+static unsigned long long allocations;
+
+void *operator new(std::size_t size)
+{
+	allocations++;
+	if (void *p = std::malloc(size ? size : 1))
+		return p;
+	throw std::bad_alloc();
+}
+
+// 배열 할당도 같은 카운터로 센다
+void *operator new[](std::size_t size)
+{
+	return operator new(size);
+}
+
+void operator delete(void *p) noexcept { std::free(p); }
+void operator delete(void *p, std::size_t) noexcept { std::free(p); }
+void operator delete[](void *p) noexcept { std::free(p); }
+void operator delete[](void *p, std::size_t) noexcept { std::free(p); }
+
+template <typename Op>
+static void bench(const char *name, long iterations, Op op)
+{
+	using clock = std::chrono::steady_clock;
+
+	unsigned long long bus_before = fpga::sim_bus().writes() + fpga::sim_bus().reads();
+	unsigned long long alloc_before = allocations;
+	int errors = 0;
+
+	auto start = clock::now();
+	for (long i = 0; i < iterations; i++)
+		errors += op(i) < 0;
+	auto end = clock::now();
+
+	double ns = std::chrono::duration<double, std::nano>(end - start).count() / iterations;
+	unsigned long long bus = fpga::sim_bus().writes() + fpga::sim_bus().reads() - bus_before;
+
+	printf("%-24s %10.1f ns/call %6.1f bus/call %4llu allocs %d errors\n",
+	       name, ns, (double)bus / iterations, allocations - alloc_before, errors);
+}
+
+int main(int argc, char **argv)
+{
+	fpga::Backend backend = fpga::Backend::Sim;
+	long iterations = 100000;
+
+	if (argc > 1 && strcmp(argv[1], "dev") == 0)
+		backend = fpga::Backend::Device;
+	if (argc > 2)
+		iterations = atol(argv[2]);
+	if (iterations <= 0) {
+		printf("Usage: %s [sim|dev] [iterations]\n", argv[0]);
+		return -1;
+	}
+
+	fpga::Board board(backend);
+	if (!board.ok()) {
+		printf("Device open error : opened mask 0x%x\n", board.opened());
+		return -1;
+	}
+
+	printf("backend=%s iterations=%ld\n", backend == fpga::Backend::Sim ? "sim" : "dev", iterations);
+
+	bench("led.set", iterations, [&](long i) { return board.led().set(i & 0xff); });
+	bench("led.get", iterations, [&](long) { uint8_t v; return board.led().get(v); });
+	bench("fnd.set_number", iterations, [&](long i) { return board.fnd().set_number(i); });
+	bench("fnd.get", iterations, [&](long) { fpga::FndDigits d; return board.fnd().get(d); });
+	bench("dot.show_digit", iterations, [&](long i) { return board.dot().show_digit(i % 10); });
+	bench("text_lcd.set_lines", iterations, [&](long i) {
+		return board.text_lcd().set_lines(i & 1 ? "hello" : "world", "3");
+	});
+	bench("buzzer.set", iterations, [&](long i) { return board.buzzer().set(i & 1); });
+
+	// 상태 페이지는 버스를 읽지 않는다 (bus/call 0)
+	fpga::StatusPage status = fpga::StatusPage::open(backend);
+	fpga_status snap;
+	if (status.ok())
+		bench("status.snapshot", iterations, [&](long) { return status.snapshot(snap); });
+	else
+		printf("%-24s open error %d\n", "status.snapshot", status.error());
+
+	// 같은 상태를 반복해서 제출하면 섀도 비교만 하고 버스를 건드리지 않는다
+	fpga::Batch same;
+	same.set_led(2).set_fnd({4, 0, 0, 0}).set_dot(fpga::dot_digit(1));
+	bench("board.submit(same)", iterations, [&](long) { return board.submit(same); });
+
+	bench("board.submit(changing)", iterations, [&](long i) {
+		fpga::Batch batch;
+		batch.set_led(i & 0xff).set_dot(fpga::dot_digit(i % 10));
+		return board.submit(batch);
+	});
+
+	return 0;
+}
@@ -0,0 +1,131 @@
+/*
+ * libfpga C interface
+ */
+#include "fpga_c.h"
+
+#include <cerrno>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "fpga.hpp"
+#include "fpga_actions.hpp"
+
+namespace {
+
+std::unique_ptr<fpga::Board> board;
+fpga::ActionTable actions;
+int actions_error_line = 0;
+int active_class = -1; // 마지막으로 적용한 클래스 (리셋할 디바이스를 고를 때 쓴다)
+
+int submit(const fpga::Batch &batch)
+{
+    if (!board)
+        return -ENODEV;
+
+    int ret = board->submit(batch);
+    return ret < 0 ? ret : 0;
+}
+
+} // namespace
+
+extern "C" int fpga_open(void)
+{
+    if (board)
+        return 0;
+
+    board = std::make_unique<fpga::Board>();
+    if (!board->ok()) {
+        board.reset();
+        return -ENODEV;
+    }
+    return 0;
+}
+
+extern "C" void fpga_close(void)
+{
+    board.reset();
+}
+
+extern "C" int fpga_led_set(unsigned char value)
+{
+    return submit(fpga::Batch().set_led(value));
+}
+
+extern "C" int fpga_fnd_set_digits(const char *digits)
+{
+    fpga::FndDigits data{};
+
+    for (std::size_t i = 0; i < fpga::kFndDigits && digits[i]; i++) {
+        if (digits[i] < '0' || digits[i] > '9')
+            return -EINVAL;
+        data[i] = digits[i] - '0';
+    }
+    return submit(fpga::Batch().set_fnd(data));
+}
+
+extern "C" int fpga_dot_show_digit(int digit)
+{
+    if (digit < 0 || digit > 9)
+        return -EINVAL;
+    return submit(fpga::Batch().set_dot(fpga::dot_digit(digit)));
+}
+
+extern "C" int fpga_text_lcd_set(const char *line1, const char *line2)
+{
+    return submit(fpga::Batch().set_text_lcd(fpga::make_text_lcd(line1, line2)));
+}
+
+extern "C" int fpga_buzzer_set(int on)
+{
+    return submit(fpga::Batch().set_buzzer(on != 0));
+}
+
+extern "C" unsigned long long fpga_skipped_writes(void)
+{
+    return board ? board->skipped() : 0;
+}
+
+extern "C" int fpga_actions_load(const char *path, const char *names)
+{
+    std::vector<std::string> list;
+    const char *p = names;
+
+    while (p && *p) {
+        const char *comma = std::strchr(p, ',');
+        std::size_t len = comma ? std::size_t(comma - p) : std::strlen(p);
+        list.emplace_back(p, len);
+        p += len + (comma ? 1 : 0);
+    }
+
+    // 새 표를 다 만든 다음에 바꾼다, 오류면 쓰던 표가 그대로 남는다
+    fpga::ActionTable table;
+    int ret = path ? table.load(path, list) : table.parse(fpga::kDefaultActions, list);
+    actions_error_line = table.error_line();
+    if (ret < 0)
+        return ret;
+
+    actions = std::move(table);
+    if (active_class >= actions.classes())
+        active_class = -1;
+    return 0;
+}
+
+extern "C" int fpga_actions_error_line(void)
+{
+    return actions_error_line;
+}
+
+extern "C" int fpga_actions_apply(int class_id)
+{
+    if (!board)
+        return -ENODEV;
+    if (!actions.has(class_id))
+        return 0;
+
+    int ret = board->submit(actions.transition(active_class, class_id));
+    if (ret >= 0)
+        active_class = class_id;
+    return ret;
+}
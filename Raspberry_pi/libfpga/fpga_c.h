@@ -0,0 +1,45 @@
+/*
+ * libfpga C interface
+ *
+ * A thin C ABI over fpga::Board for callers that cannot use C++ directly
+ * (yolo_last.py loads libfpga.so through ctypes). All functions operate on
+ * one process-wide Board and return 0 (or a count) on success, -errno on
+ * failure.
+ */
+#ifndef FPGA_C_H
+#define FPGA_C_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* LED, FND, Dot, Text LCD, Buzzer 를 한 번 열어 둔다 */
+int fpga_open(void);
+void fpga_close(void);
+
+int fpga_led_set(unsigned char value);
+/* "1234" 형식, 4자리보다 짧으면 뒤를 0 으로 채운다 (fpga_test_fnd 와 동일) */
+int fpga_fnd_set_digits(const char *digits);
+int fpga_dot_show_digit(int digit);
+int fpga_text_lcd_set(const char *line1, const char *line2);
+int fpga_buzzer_set(int on);
+
+/* 직전 값과 같아서 생략된 디바이스 쓰기 횟수 */
+unsigned long long fpga_skipped_writes(void);
+
+/*
+ * 클래스 -> 디바이스 동작 표 (fpga_actions.hpp 의 설정 형식)
+ * path 가 NULL 이면 기본 표(원래 class_map), names 는 "dev1,dev2,..." 처럼
+ * 모델 클래스 순서의 이름. 오류면 -errno 이고 기존 표는 그대로 남는다
+ * (fpga_actions_error_line() 에 오류 줄 번호). 다시 불러도 된다 (SIGHUP 재적재).
+ */
+int fpga_actions_load(const char *path, const char *names);
+int fpga_actions_error_line(void);
+/* 클래스 하나의 동작 적용 (표 조회 + Batch 한 번), 표에 없는 클래스는 무시 */
+int fpga_actions_apply(int class_id);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* FPGA_C_H */
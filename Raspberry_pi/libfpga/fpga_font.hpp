@@ -0,0 +1,48 @@
+/*
+ * FPGA Dot Matrix glyph tables for libfpga
+ *
+ * The 10x7 dot matrix takes one byte per row (bit 6 = leftmost column).
+ * These tables replace the per-program copies of 'fpga_dot_font.h' and
+ * live in .rodata as constexpr data, so nothing is built at run time.
+ */
+#ifndef FPGA_FONT_HPP
+#define FPGA_FONT_HPP
+
+#include <array>
+#include <cstdint>
+
+namespace fpga {
+
+constexpr std::size_t kDotRows = 10;
+
+using DotFrame = std::array<std::uint8_t, kDotRows>;
+
+// 숫자 0~9 글리프 (fpga_dot_font.h 의 fpga_number 와 동일한 데이터)
+constexpr std::array<DotFrame, 10> kDotDigits = {{
+    {0x3e, 0x7f, 0x63, 0x73, 0x73, 0x6f, 0x67, 0x63, 0x7f, 0x3e}, // 0
+    {0x0c, 0x1c, 0x1c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x1e}, // 1
+    {0x7e, 0x7f, 0x03, 0x03, 0x3f, 0x7e, 0x60, 0x60, 0x7f, 0x7f}, // 2
+    {0xfe, 0x7f, 0x03, 0x03, 0x7f, 0x7f, 0x03, 0x03, 0x7f, 0x7e}, // 3
+    {0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x7f, 0x7f, 0x06, 0x06}, // 4
+    {0x7f, 0x7f, 0x60, 0x60, 0x7e, 0x7f, 0x03, 0x03, 0x7f, 0x7e}, // 5
+    {0x60, 0x60, 0x60, 0x60, 0x7e, 0x7f, 0x63, 0x63, 0x7f, 0x3e}, // 6
+    {0x7f, 0x7f, 0x63, 0x63, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03}, // 7
+    {0x3e, 0x7f, 0x63, 0x63, 0x7f, 0x7f, 0x63, 0x63, 0x7f, 0x3e}, // 8
+    {0x3e, 0x7f, 0x63, 0x63, 0x7f, 0x3f, 0x03, 0x03, 0x03, 0x03}, // 9
+}};
+
+constexpr DotFrame kDotFull = {0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f};
+constexpr DotFrame kDotBlank = {};
+
+// 범위를 벗어난 숫자는 빈 화면으로 처리
+constexpr const DotFrame &dot_digit(int n)
+{
+    return (n >= 0 && n <= 9) ? kDotDigits[n] : kDotBlank;
+}
+
+static_assert(dot_digit(1)[9] == 0x1e, "digit table out of sync with fpga_dot_font.h");
+static_assert(&dot_digit(10) == &kDotBlank, "out of range digits must map to blank");
+
+} // namespace fpga
+
+#endif // FPGA_FONT_HPP
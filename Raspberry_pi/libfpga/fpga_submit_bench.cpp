@@ -0,0 +1,173 @@
+/* FPGA device command submission benchmark
+File : fpga_submit_bench.cpp
+
+Usage: fpga_submit_bench [iterations] [depth]
+
+Sends the same stream of frames (led + fnd + dot + text_lcd, 4 device
+updates each) to the k6 drivers three ways and prints ops/s and CPU per
+frame:
+  write     one write() per device (the path before FPGA_IOC_SUBMIT)
+  ioctl     one ioctl(FPGA_IOC_SUBMIT) per frame
+  io_uring  depth frames per io_uring_enter, completions reaped in bulk
+'nop' times the same ring with IORING_OP_NOP entries, i.e. the cost of the
+ring itself.
+
+proc cpu is getrusage() of this process; sys cpu is the busy time of all
+CPUs from /proc/stat and also counts the kernel workers that finish the
+io_uring batches (jiffy resolution, use enough iterations). Needs the k6
+drivers loaded; fpga_interface_driver sim=1 is fine on a board without
+the FPGA. */
+
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <sys/ioctl.h>
+#include <sys/resource.h>
+#include <unistd.h>
+#include <vector>
+
+#include "fpga.hpp"
+#include "fpga_uring.hpp"
+
+// 모든 CPU 의 busy 시간 (ns), 읽지 못하면 0
+static double system_busy_ns()
+{
+	FILE *fp = fopen("/proc/stat", "r");
+	unsigned long long user, nice, sys, idle, iowait, irq, softirq;
+
+	if (!fp)
+		return 0;
+	int n = fscanf(fp, "cpu %llu %llu %llu %llu %llu %llu %llu",
+		       &user, &nice, &sys, &idle, &iowait, &irq, &softirq);
+	fclose(fp);
+	if (n != 7)
+		return 0;
+	return (double)(user + nice + sys + irq + softirq) * 1e9 / sysconf(_SC_CLK_TCK);
+}
+
+static double process_cpu_ns()
+{
+	struct rusage ru;
+
+	getrusage(RUSAGE_SELF, &ru);
+	return (ru.ru_utime.tv_sec + ru.ru_stime.tv_sec) * 1e9 +
+	       (ru.ru_utime.tv_usec + ru.ru_stime.tv_usec) * 1e3;
+}
+
+// 반복마다 바뀌는 프레임 (섀도 비교에 걸리지 않도록)
+static fpga::Batch make_frame(long i)
+{
+	fpga::Batch batch;
+	batch.set_led(i & 0xff)
+		.set_fnd({uint8_t(i / 1000 % 10), uint8_t(i / 100 % 10), uint8_t(i / 10 % 10), uint8_t(i % 10)})
+		.set_dot(fpga::dot_digit(i % 10))
+		.set_text_lcd(fpga::make_text_lcd(i & 1 ? "hello" : "world", "3"));
+	return batch;
+}
+
+template <typename Op>
+static void bench(const char *name, long frames, Op op)
+{
+	using clock = std::chrono::steady_clock;
+
+	double sys_before = system_busy_ns();
+	double proc_before = process_cpu_ns();
+	auto start = clock::now();
+	long errors = op();
+	auto end = clock::now();
+	double proc = process_cpu_ns() - proc_before;
+	double sys = system_busy_ns() - sys_before;
+
+	double sec = std::chrono::duration<double>(end - start).count();
+	printf("%-10s %10.0f ops/s %8.2f us/op %8.2f us proc cpu/op %8.2f us sys cpu/op %ld errors\n",
+	       name, frames / sec, sec * 1e6 / frames, proc / 1e3 / frames, sys / 1e3 / frames, errors);
+}
+
+int main(int argc, char **argv)
+{
+	long iterations = 100000;
+	unsigned depth = 8;
+
+	if (argc > 1)
+		iterations = atol(argv[1]);
+	if (argc > 2)
+		depth = atoi(argv[2]);
+	if (iterations <= 0 || depth == 0 || depth > 256) {
+		printf("Usage: %s [iterations] [depth]\n", argv[0]);
+		return -1;
+	}
+
+	const unsigned frame_mask = fpga::Batch::kLed | fpga::Batch::kFnd | fpga::Batch::kDot | fpga::Batch::kTextLcd;
+	fpga::Board board(fpga::Backend::Device, frame_mask);
+	if (!board.ok()) {
+		printf("Device open error : opened mask 0x%x\n", board.opened());
+		return -1;
+	}
+	int fd = board.command_fd();
+
+	printf("iterations=%ld depth=%u\n", iterations, depth);
+
+	bench("write", iterations, [&] {
+		long errors = 0;
+		for (long i = 0; i < iterations; i++) {
+			fpga::Batch batch = make_frame(i);
+			errors += board.led().set(batch.led) < 0;
+			errors += board.fnd().set(batch.fnd) < 0;
+			errors += board.dot().set(batch.dot) < 0;
+			errors += board.text_lcd().set(batch.text_lcd) < 0;
+		}
+		return errors;
+	});
+
+	fpga_cmd cmds[5];
+	fpga_cmd_batch req{};
+	req.cmds = reinterpret_cast<uintptr_t>(cmds);
+	req.count = fpga::encode_batch(make_frame(0), frame_mask, cmds);
+	if (ioctl(fd, FPGA_IOC_SUBMIT, &req) < 0) {
+		printf("ioctl(FPGA_IOC_SUBMIT) : %s, drivers without device commands\n", strerror(errno));
+		return 0;
+	}
+
+	bench("ioctl", iterations, [&] {
+		long errors = 0;
+		for (long i = 0; i < iterations; i++) {
+			req.count = fpga::encode_batch(make_frame(i), frame_mask, cmds);
+			errors += ioctl(fd, FPGA_IOC_SUBMIT, &req) < 0;
+		}
+		return errors;
+	});
+
+	fpga::CommandRing ring(depth);
+	if (!ring.ok()) {
+		printf("io_uring_setup : %s\n", strerror(-ring.error()));
+		return 0;
+	}
+
+	// 한 번에 depth 프레임을 넣고 한 번의 io_uring_enter 로 모두 끝날 때까지 기다린다
+	auto run_ring = [&](bool nop) {
+		std::vector<fpga_cmd> slots(depth * 5);
+		long errors = 0;
+		for (long i = 0; i < iterations; ) {
+			unsigned n = 0;
+			for (; n < depth && i < iterations; n++, i++) {
+				fpga_cmd *frame = &slots[n * 5];
+				unsigned count = fpga::encode_batch(make_frame(i), frame_mask, frame);
+				errors += (nop ? ring.queue_nop(i) : ring.queue(fd, frame, count, i)) < 0;
+			}
+			errors += ring.submit(n) < 0;
+
+			uint64_t user_data;
+			int res;
+			while (ring.reap(user_data, res) == 0)
+				errors += res < 0;
+		}
+		return errors;
+	};
+
+	bench("nop", iterations, [&] { return run_ring(true); });
+	bench("io_uring", iterations, [&] { return run_ring(false); });
+
+	return 0;
+}
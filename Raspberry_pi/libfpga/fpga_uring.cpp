@@ -0,0 +1,181 @@
+/*
+ * io_uring submission of FPGA device commands
+ */
+#include "fpga_uring.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace fpga {
+
+namespace {
+
+unsigned *ring_field(void *ring, unsigned offset)
+{
+    return reinterpret_cast<unsigned *>(static_cast<char *>(ring) + offset);
+}
+
+} // namespace
+
+CommandRing::CommandRing(unsigned entries)
+{
+    io_uring_params params{};
+
+    fd_ = int(::syscall(__NR_io_uring_setup, entries, &params));
+    if (fd_ < 0) {
+        err_ = -errno;
+        return;
+    }
+    entries_ = params.sq_entries;
+
+    sq_ring_size_ = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    cq_ring_size_ = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+    // 5.4 이후 커널은 SQ/CQ 링을 한 번의 mmap 으로 준다
+    if (params.features & IORING_FEAT_SINGLE_MMAP)
+        sq_ring_size_ = cq_ring_size_ = std::max(sq_ring_size_, cq_ring_size_);
+
+    sq_ring_ = ::mmap(nullptr, sq_ring_size_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                      fd_, IORING_OFF_SQ_RING);
+    if (sq_ring_ == MAP_FAILED)
+        goto fail;
+    if (params.features & IORING_FEAT_SINGLE_MMAP) {
+        cq_ring_ = sq_ring_;
+    } else {
+        cq_ring_ = ::mmap(nullptr, cq_ring_size_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                          fd_, IORING_OFF_CQ_RING);
+        if (cq_ring_ == MAP_FAILED)
+            goto fail;
+    }
+    sqes_ = static_cast<io_uring_sqe *>(::mmap(nullptr, params.sq_entries * sizeof(io_uring_sqe),
+                                               PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                                               fd_, IORING_OFF_SQES));
+    if (sqes_ == MAP_FAILED)
+        goto fail;
+
+    sq_head_ = ring_field(sq_ring_, params.sq_off.head);
+    sq_tail_ = ring_field(sq_ring_, params.sq_off.tail);
+    sq_array_ = ring_field(sq_ring_, params.sq_off.array);
+    sq_mask_ = *ring_field(sq_ring_, params.sq_off.ring_mask);
+    sq_tail_local_ = *sq_tail_;
+    cq_head_ = ring_field(cq_ring_, params.cq_off.head);
+    cq_tail_ = ring_field(cq_ring_, params.cq_off.tail);
+    cqes_ = reinterpret_cast<io_uring_cqe *>(static_cast<char *>(cq_ring_) + params.cq_off.cqes);
+    cq_mask_ = *ring_field(cq_ring_, params.cq_off.ring_mask);
+    return;
+
+fail:
+    err_ = -errno;
+    if (sqes_ == MAP_FAILED)
+        sqes_ = nullptr;
+    if (cq_ring_ == MAP_FAILED)
+        cq_ring_ = nullptr;
+    if (sq_ring_ == MAP_FAILED)
+        sq_ring_ = nullptr;
+    release();
+}
+
+CommandRing::~CommandRing()
+{
+    release();
+}
+
+void CommandRing::release()
+{
+    if (sqes_)
+        ::munmap(sqes_, entries_ * sizeof(io_uring_sqe));
+    if (cq_ring_ && cq_ring_ != sq_ring_)
+        ::munmap(cq_ring_, cq_ring_size_);
+    if (sq_ring_)
+        ::munmap(sq_ring_, sq_ring_size_);
+    if (fd_ >= 0)
+        ::close(fd_);
+    fd_ = -1;
+    sqes_ = nullptr;
+    cq_ring_ = sq_ring_ = nullptr;
+}
+
+io_uring_sqe *CommandRing::next_sqe()
+{
+    // tail 은 이 객체만 움직이고 head 는 커널이 움직인다
+    unsigned tail = sq_tail_local_;
+
+    if (!ok() || tail - __atomic_load_n(sq_head_, __ATOMIC_ACQUIRE) >= entries_)
+        return nullptr;
+
+    io_uring_sqe *sqe = &sqes_[tail & sq_mask_];
+    std::memset(sqe, 0, sizeof(*sqe));
+    sq_array_[tail & sq_mask_] = tail & sq_mask_;
+    sq_tail_local_ = tail + 1;
+    pending_++;
+    return sqe;
+}
+
+int CommandRing::queue(int fd, const fpga_cmd *cmds, unsigned count, std::uint64_t user_data)
+{
+    io_uring_sqe *sqe = next_sqe();
+    fpga_cmd_batch batch{};
+
+    if (!sqe)
+        return ok() ? -EBUSY : err_;
+
+    batch.cmds = reinterpret_cast<std::uintptr_t>(cmds);
+    batch.count = count;
+    sqe->opcode = IORING_OP_URING_CMD;
+    sqe->fd = fd;
+    sqe->cmd_op = FPGA_IOC_SUBMIT;
+    sqe->user_data = user_data;
+    // 64 바이트 SQE 의 마지막 16 바이트 (addr3 자리) 가 명령 칸이다
+    static_assert(sizeof(batch) == 16, "fpga_cmd_batch must fit the SQE command area");
+    std::memcpy(&sqe->addr3, &batch, sizeof(batch));
+    return 0;
+}
+
+int CommandRing::queue_nop(std::uint64_t user_data)
+{
+    io_uring_sqe *sqe = next_sqe();
+
+    if (!sqe)
+        return ok() ? -EBUSY : err_;
+    sqe->opcode = IORING_OP_NOP;
+    sqe->user_data = user_data;
+    return 0;
+}
+
+int CommandRing::submit(unsigned wait)
+{
+    if (!ok())
+        return err_;
+
+    // 커널이 SQE 를 읽기 전에 tail 이 보이도록 release 로 올린다
+    __atomic_store_n(sq_tail_, sq_tail_local_, __ATOMIC_RELEASE);
+
+    int ret = int(::syscall(__NR_io_uring_enter, fd_, pending_, wait, wait ? IORING_ENTER_GETEVENTS : 0,
+                            nullptr, 0));
+    if (ret < 0)
+        return -errno;
+    pending_ -= std::min(unsigned(ret), pending_);
+    return ret;
+}
+
+int CommandRing::reap(std::uint64_t &user_data, int &res)
+{
+    if (!ok())
+        return err_;
+
+    unsigned head = *cq_head_;
+    if (head == __atomic_load_n(cq_tail_, __ATOMIC_ACQUIRE))
+        return -EAGAIN;
+
+    const io_uring_cqe &cqe = cqes_[head & cq_mask_];
+    user_data = cqe.user_data;
+    res = cqe.res;
+    __atomic_store_n(cq_head_, head + 1, __ATOMIC_RELEASE);
+    return 0;
+}
+
+} // namespace fpga
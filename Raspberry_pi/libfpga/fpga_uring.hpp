@@ -0,0 +1,84 @@
+/*
+ * io_uring submission of FPGA device commands
+ *
+ * CommandRing queues FPGA_IOC_SUBMIT batches (fpga_ioctl.h) as
+ * IORING_OP_URING_CMD entries: struct fpga_cmd_batch travels in the 16
+ * command bytes of a normal 64 byte SQE, the kernel copies the commands
+ * when the entry is issued and finishes the bus batch on a worker, so one
+ * io_uring_enter() can hand several frames to the drivers and the caller
+ * reaps the completions later. Completions carry the number of commands
+ * (or -errno) and arrive in submission order.
+ *
+ * The ring is set up with the raw syscalls, libfpga does not depend on
+ * liburing. Keep each fpga_cmd array alive until its completion has been
+ * reaped.
+ *
+ * Errors follow the rest of libfpga: 0 on success, -errno on failure.
+ */
+#ifndef FPGA_URING_HPP
+#define FPGA_URING_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+#include "fpga.hpp"
+
+struct io_uring_sqe;
+struct io_uring_cqe;
+
+namespace fpga {
+
+class CommandRing {
+public:
+    explicit CommandRing(unsigned entries = 32);
+    ~CommandRing();
+
+    CommandRing(const CommandRing &) = delete;
+    CommandRing &operator=(const CommandRing &) = delete;
+
+    bool ok() const { return fd_ >= 0; }
+    int error() const { return err_; }
+    unsigned entries() const { return entries_; }
+    // 넣었지만 아직 커널이 가져가지 않은 엔트리 수
+    unsigned pending() const { return pending_; }
+
+    // fd (FPGA 출력 디바이스) 로 갈 명령 배치 하나를 SQ 에 넣는다, SQ 가 차 있으면 -EBUSY
+    int queue(int fd, const fpga_cmd *cmds, unsigned count, std::uint64_t user_data);
+    // 아무 일도 하지 않는 엔트리 (링 자체의 비용을 잴 때)
+    int queue_nop(std::uint64_t user_data);
+
+    // 넣어 둔 엔트리를 io_uring_enter 한 번으로 제출하고 wait 개가 끝날 때까지 기다린다
+    // 제출한 엔트리 수를 돌려준다
+    int submit(unsigned wait = 0);
+    // 끝난 엔트리 하나를 꺼낸다, 없으면 -EAGAIN
+    int reap(std::uint64_t &user_data, int &res);
+
+private:
+    io_uring_sqe *next_sqe();
+    void release();
+
+    int fd_ = -1;
+    int err_ = 0;
+    unsigned entries_ = 0;
+    unsigned pending_ = 0;
+
+    void *sq_ring_ = nullptr;
+    void *cq_ring_ = nullptr;
+    std::size_t sq_ring_size_ = 0;
+    std::size_t cq_ring_size_ = 0;
+    io_uring_sqe *sqes_ = nullptr;
+
+    unsigned *sq_head_ = nullptr;
+    unsigned *sq_tail_ = nullptr;
+    unsigned *sq_array_ = nullptr;
+    unsigned sq_mask_ = 0;
+    unsigned sq_tail_local_ = 0;  // 다음 SQE 자리 (submit() 에서 sq_tail_ 로 공개)
+    unsigned *cq_head_ = nullptr;
+    unsigned *cq_tail_ = nullptr;
+    io_uring_cqe *cqes_ = nullptr;
+    unsigned cq_mask_ = 0;
+};
+
+} // namespace fpga
+
+#endif // FPGA_URING_HPP
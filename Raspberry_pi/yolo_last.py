@@ -1,68 +1,70 @@
 from ultralytics import YOLO
-import subprocess
+import ctypes
+import os
+import signal
 import time
 
 # YOLO 모델 로드
 model = YOLO("best_fixed.onnx")
 
-# 클래스 매핑 (YOLO 클래스명 -> 디바이스 및 값)
-class_map = {
-    'dev1': ('dot_matrix', 1),
-    'dev2': ('led', 2),
-    'dev3': ('text_lcd', 3),
-    'dev4': ('fnd', 4),
-    'off': ('buzzer', 0)
-}
+HERE = os.path.dirname(os.path.abspath(__file__))
 
-# 이전에 활성화된 디바이스 정보
-prev_device = None
+
+def find_libfpga():
+    # LIBFPGA 환경 변수 > 이 저장소의 libfpga 빌드 > 시스템 라이브러리 경로
+    path = os.environ.get("LIBFPGA")
+    if path:
+        return path
+    local = os.path.join(HERE, "libfpga", "libfpga.so")
+    return local if os.path.exists(local) else "libfpga.so"
+
+
+# libfpga 로드: 디바이스를 한 번만 열어 두고 프레임마다 프로세스를 띄우지 않는다
+# (FPGA_BACKEND=sim 이면 보드 없이 시뮬레이터로 동작)
+fpga = ctypes.CDLL(find_libfpga())
+fpga.fpga_actions_load.argtypes = [ctypes.c_char_p, ctypes.c_char_p]
+if fpga.fpga_open() < 0:
+    raise SystemExit("FPGA device open error")
+
+# 클래스 -> 디바이스 동작은 actions.conf 에 있다 (없으면 libfpga 의 기본 표).
+# libfpga 가 (이전 클래스, 새 클래스) 마다 쓸 값을 미리 만들어 두므로
+# 프레임마다 fpga_actions_apply() 한 번이면 이전 디바이스 초기화까지 끝난다.
+ACTIONS = os.environ.get("FPGA_ACTIONS", os.path.join(HERE, "actions.conf"))
+NAMES = ",".join(model.names[i] for i in sorted(model.names)).encode()
+
+
+def load_actions():
+    path = ACTIONS.encode() if os.path.exists(ACTIONS) else None
+    ret = fpga.fpga_actions_load(path, NAMES)
+    if ret < 0:
+        print(f"actions error: {ACTIONS} line {fpga.fpga_actions_error_line()} ({ret}), keeping the old table")
+    else:
+        print(f"actions: {ACTIONS if path else '(built-in)'}")
+    return ret
+
+
+if load_actions() < 0:
+    raise SystemExit(1)
+
+# kill -HUP 으로 설정을 다시 읽는다 (다음 프레임에서)
+reload_requested = False
+
+
+def hangup(signum, frame):
+    global reload_requested
+    reload_requested = True
+
+
+signal.signal(signal.SIGHUP, hangup)
 
 # YOLO 추론 실행
 for result in model.predict(source=0, show=True, stream=True):
+    if reload_requested:
+        reload_requested = False
+        load_actions()
+
     if len(result.boxes) > 0:
-        cls_id = int(result.boxes.cls[0].item())
-        class_name = model.names[cls_id]
-
-        if class_name in class_map:
-            device_type, value = class_map[class_name]
-
-            # 디바이스 변경 시 이전 디바이스 초기화
-            if prev_device != device_type:
-                if prev_device == 'dot_matrix':
-                    subprocess.run(["/home/kjh/Modules/fpga_test_dot", "0"])
-                    #print("초기화: dot matrix off")
-                elif prev_device == 'led':
-                    subprocess.run(["/home/kjh/Modules/fpga_test_led", "0"])
-                    #print("초기화: led off")
-                elif prev_device == 'text_lcd':
-                    subprocess.run(["/home/kjh/Modules/fpga_test_text_lcd", " ", "0"])
-                    #print("초기화: text lcd clear")
-                elif prev_device == 'fnd':
-                    subprocess.run(["/home/kjh/Modules/fpga_test_fnd", "0"])
-                    #print("초기화: fnd off")
-                # buzzer는 off 필요 없음 (원하면 추가 가능)
-
-                prev_device = device_type
-
-            # 현재 디바이스 실행
-            if device_type == 'dot_matrix':
-                #print(f"YOLO detect: {class_name}, dot matrix : {value}")
-                subprocess.run(["/home/kjh/Modules/fpga_test_dot", str(value)])
-            elif device_type == 'led':
-                #print(f"YOLO detect: {class_name}, led : {value}")
-                subprocess.run(["/home/kjh/Modules/fpga_test_led", str(value)])
-            elif device_type == 'text_lcd':
-                #print(f"YOLO detect: {class_name}, text lcd : {value}")
-                subprocess.run(["/home/kjh/Modules/fpga_test_text_lcd", "hello", str(value)])
-            elif device_type == 'fnd':
-                #print(f"YOLO detect: {class_name}, fnd : {value}")
-                subprocess.run(["/home/kjh/Modules/fpga_test_fnd", str(value)])
-            elif device_type == 'buzzer':
-                #print(f"YOLO detect: buzzer")
-                subprocess.run(["/home/kjh/Modules/fpga_test_buzzer"])
-        #else:
-            #print(f"unknown: {class_name}")
-    #else:
-        #print("Not detecting")
+        # 표에 없는 클래스는 libfpga 가 무시한다
+        fpga.fpga_actions_apply(int(result.boxes.cls[0].item()))
 
     time.sleep(0.3)